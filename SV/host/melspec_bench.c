@@ -0,0 +1,134 @@
+/*
+ * log-mel front-end frame 처리 비용 벤치마크 (host 전용)
+ *
+ * 같은 3초 오디오(NUM_FRAMES frame)를 각 경로로 계산하여 frame당 비용을 출력합니다.
+ *   f32    : 단계별 float 경로 (melspec_compute_f32, fused 이전)
+ *   fused  : 단일 pass float kernel (melspec_compute_fused)
+ *   batch  : 두 frame을 FFT 한 번에 (melspec_compute_batch)
+ *   q15    : 고정소수점 경로 (melspec_compute_q15)
+ * x86에서는 TSC cycle, 그 외에는 ns 단위입니다. fused 결과가 f32와 얼마나 다른지도 함께 출력합니다.
+ *
+ * 빌드 (SV/host 에서):
+ *   make melspec_bench
+ *   make melspec_bench POWER_MEL=1   (power 영역 mel 근사)
+ */
+
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>  // __rdtsc
+#endif
+
+#include "melspec.h"
+
+
+//=========================== define ===========================
+#define BENCH_ROUNDS 200   // 3초 창 반복 횟수 (각 경로)
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BENCH_UNIT "cycles"
+#else
+#define BENCH_UNIT "ns"
+#endif
+
+
+//=========================== typedef ===========================
+typedef void (*compute_fn_t)(const int16_t* audio, float* out);
+
+
+//=========================== variables ===========================
+static int16_t audio[AUDIO_BUFFER_LEN];
+static float out_ref[MELSPEC_OUTPUT_SIZE];
+static float out[MELSPEC_OUTPUT_SIZE];
+
+static uint32_t rng_state = 2024u;
+
+
+//=========================== prototypes ==========================
+static uint64_t _now(void);
+static void _batch_all(const int16_t* audio_data, float* freq_data);
+static double _bench(const char* name, compute_fn_t compute, int per_frame);
+
+
+//=========================== public ==============================
+int main(void) {
+    if (melspec_init() != 0) {
+        printf("init failed\n");
+        return -1;
+    }
+
+    // 레벨이 0.5초마다 바뀌는 노이즈 (조용한 구간 포함)
+    for (int n = 0; n < AUDIO_BUFFER_LEN; ++n) {
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 17;
+        rng_state ^= rng_state << 5;
+        float level = (float)((n / (SAMPLE_RATE / 2)) % 4) / 3.0f;
+        audio[n] = (int16_t)((int32_t)(rng_state >> 16) - 32768) * level;
+    }
+
+    printf("\n=== log-mel front-end benchmark (%d frames x %d rounds, %s per frame) ===\n",
+           NUM_FRAMES, BENCH_ROUNDS, BENCH_UNIT);
+    printf("MELSPEC_FUSED_POWER_MEL=%d\n\n", MELSPEC_FUSED_POWER_MEL);
+
+    double base = _bench("f32", melspec_compute_f32, 1);
+    memcpy(out_ref, out, sizeof(out_ref));
+    double fused = _bench("fused", melspec_compute_fused, 1);
+
+    float max_diff = 0.0f;
+    for (int i = 0; i < MELSPEC_OUTPUT_SIZE; ++i) {
+        max_diff = fmaxf(max_diff, fabsf(out[i] - out_ref[i]));
+    }
+
+    _bench("batch", _batch_all, 0);
+    _bench("q15", melspec_compute_q15, 1);
+
+    printf("\nfused speedup vs f32: %.2fx, max |fused - f32| = %g\n", base / fused, max_diff);
+
+    melspec_deinit();
+    return 0;
+}
+
+
+//=========================== private ==============================
+static uint64_t _now(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static void _batch_all(const int16_t* audio_data, float* freq_data) {
+    melspec_compute_batch(audio_data, NUM_FRAMES, freq_data);
+}
+
+// per_frame: 1이면 frame마다 compute 호출, 0이면 창 전체를 한 번에 넘김
+static double _bench(const char* name, compute_fn_t compute, int per_frame) {
+    uint64_t best = UINT64_MAX;
+
+    // 반복마다 창 전체 시간을 재고 가장 빠른 값 사용 (스케줄링 잡음 제거)
+    for (int r = 0; r < BENCH_ROUNDS; ++r) {
+        uint64_t start = _now();
+        if (per_frame) {
+            for (int f = 0; f < NUM_FRAMES; ++f) {
+                compute(&audio[f * FRAME_STEP], &out[f * NUM_MEL_BINS]);
+            }
+        } else {
+            compute(audio, out);
+        }
+        uint64_t elapsed = _now() - start;
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    double per = (double)best / NUM_FRAMES;
+    printf("%-6s %10.0f\n", name, per);
+    return per;
+}
@@ -0,0 +1,178 @@
+/*
+ * Q15 log-mel front-end 오차 리포트 (host 전용)
+ *
+ * 합성 음성과 백색 노이즈를 여러 레벨로 만들어
+ * melspec_compute_f32(직접 DFT와 같음)와 melspec_compute_q15의 log-mel 출력을 frame마다 비교합니다.
+ *   speech : 배음 + 약한 노이즈
+ *   clean  : 배음만 (배음 사이/위 골짜기가 깊음)
+ *   offset : speech + 마이크 DC offset (1000 LSB)
+ *   noise  : 백색 노이즈
+ *   raw    : log-mel (자연로그) 차이, 40/60 dB 열은 frame의 최대 mel 대비 그 범위 안의 bin만
+ *   norm   : normalize() 후 차이 (모델 입력 기준)
+ * 각 경로의 host 처리 시간(frame당)도 함께 출력합니다.
+ *
+ * 빌드 (SV/host 에서):
+ *   make melspec_q15_report
+ */
+
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "melspec.h"
+
+
+//=========================== define ===========================
+#define NUM_LEVELS 4
+#define NUM_SIGNALS 4   // 0: 합성 음성, 1: 노이즈 없는 배음, 2: 음성 + DC offset, 3: 백색 노이즈
+#define NEAR_DB 40.0f   // frame 최대 mel 대비 이 범위 안의 bin 오차를 따로 집계
+#define FLOOR_DB 60.0f
+#define DC_OFFSET 1000
+
+
+//=========================== variables ===========================
+// 신호 최대 레벨 (dBFS)
+static const float levels_db[NUM_LEVELS] = {0.0f, -20.0f, -40.0f, -60.0f};
+static const char* signal_names[NUM_SIGNALS] = {"speech", "clean", "offset", "noise"};
+
+static int16_t audio[AUDIO_BUFFER_LEN];
+static float out_f32[MELSPEC_OUTPUT_SIZE];
+static float out_q15[MELSPEC_OUTPUT_SIZE];
+
+static uint32_t rng_state = 12345u;
+
+
+//=========================== prototypes ==========================
+static float _randn(void);
+static float _db_to_nats(float db);
+static void _make_signal(int kind, float level_db);
+static double _run(void (*compute)(const int16_t*, float*), float* out);
+
+
+//=========================== public ==============================
+int main(void) {
+    if (melspec_init() != 0) {
+        printf("init failed\n");
+        return -1;
+    }
+
+    printf("\n=== Q15 log-mel front-end error report (%d frames x %d bins per case) ===\n",
+           NUM_FRAMES, NUM_MEL_BINS);
+    printf("%-7s %6s | %9s %9s %9s %9s | %9s %9s | %8s %8s\n", "signal", "dBFS",
+           "raw mean", "40 dB", "60 dB", "raw max", "norm mean", "norm max", "f32 us", "q15 us");
+
+    for (int s = 0; s < NUM_SIGNALS; ++s) {
+        for (int l = 0; l < NUM_LEVELS; ++l) {
+            _make_signal(s, levels_db[l]);
+            double us_f32 = _run(melspec_compute_f32, out_f32);
+            double us_q15 = _run(melspec_compute_q15, out_q15);
+
+            double raw_sum = 0.0;
+            float raw_max = 0.0f, near_max = 0.0f, floor_max = 0.0f;
+            for (int f = 0; f < NUM_FRAMES; ++f) {
+                const float* a = &out_f32[f * NUM_MEL_BINS];
+                const float* b = &out_q15[f * NUM_MEL_BINS];
+                float frame_max = a[0];
+                for (int i = 1; i < NUM_MEL_BINS; ++i) {
+                    frame_max = fmaxf(frame_max, a[i]);
+                }
+                float near = frame_max - _db_to_nats(NEAR_DB);
+                float floor = frame_max - _db_to_nats(FLOOR_DB);
+                for (int i = 0; i < NUM_MEL_BINS; ++i) {
+                    float d = fabsf(a[i] - b[i]);
+                    raw_sum += d;
+                    raw_max = fmaxf(raw_max, d);
+                    if (a[i] >= near) {
+                        near_max = fmaxf(near_max, d);
+                    }
+                    if (a[i] >= floor) {
+                        floor_max = fmaxf(floor_max, d);
+                    }
+                }
+            }
+
+            normalize(out_f32, NUM_FRAMES);
+            normalize(out_q15, NUM_FRAMES);
+            double norm_sum = 0.0;
+            float norm_max = 0.0f;
+            for (int i = 0; i < MELSPEC_OUTPUT_SIZE; ++i) {
+                float d = fabsf(out_f32[i] - out_q15[i]);
+                norm_sum += d;
+                norm_max = fmaxf(norm_max, d);
+            }
+
+            printf("%-7s %6.0f | %9.5f %9.5f %9.5f %9.5f | %9.5f %9.5f | %8.2f %8.2f\n",
+                   signal_names[s], levels_db[l], raw_sum / MELSPEC_OUTPUT_SIZE, near_max, floor_max, raw_max,
+                   norm_sum / MELSPEC_OUTPUT_SIZE, norm_max, us_f32, us_q15);
+        }
+    }
+    printf("\n%.0f dB / %.0f dB: max error over bins within that range of the frame's peak mel (float path)\n",
+           NEAR_DB, FLOOR_DB);
+    printf("host timings are for reference only; the target gain comes from avoiding FPU ops\n");
+
+    melspec_deinit();
+    return 0;
+}
+
+
+//=========================== private ==============================
+static float _randn(void) {
+    // Box-Muller (xorshift32)
+    float u[2];
+    for (int k = 0; k < 2; ++k) {
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 17;
+        rng_state ^= rng_state << 5;
+        u[k] = ((rng_state >> 8) + 0.5f) / 16777216.0f;
+    }
+    return sqrtf(-2.0f * logf(u[0])) * cosf(6.2831853f * u[1]);
+}
+
+// log-mel은 magnitude 합의 log이므로 dB = 20·log10
+static float _db_to_nats(float db) {
+    return db * logf(10.0f) / 20.0f;
+}
+
+static void _make_signal(int kind, float level_db) {
+    static float buf[AUDIO_BUFFER_LEN];
+    float peak = 0.0f;
+    double phase = 0.0;
+
+    for (int n = 0; n < AUDIO_BUFFER_LEN; ++n) {
+        float v;
+        if (kind < 3) {
+            // f0 100~220 Hz로 천천히 변하는 배음 (고역으로 갈수록 감쇠) + 약한 노이즈 (clean 제외)
+            double f0 = 160.0 + 60.0 * sin(2.0 * M_PI * 0.7 * n / SAMPLE_RATE);
+            phase += 2.0 * M_PI * f0 / SAMPLE_RATE;
+            v = 0.0f;
+            for (int h = 1; h * f0 < SAMPLE_RATE / 2 && h <= 40; ++h) {
+                v += (float)(sin(h * phase) / h);
+            }
+            if (kind != 1) {
+                v += 0.01f * _randn();
+            }
+        } else {
+            v = _randn();
+        }
+        buf[n] = v;
+        peak = fmaxf(peak, fabsf(v));
+    }
+
+    // offset은 DC를 더해도 int16 범위에 남도록 peak를 DC_OFFSET만큼 줄임
+    int dc = (kind == 2) ? DC_OFFSET : 0;
+    float gain = (32767.0f - dc) * powf(10.0f, level_db / 20.0f) / peak;
+    for (int n = 0; n < AUDIO_BUFFER_LEN; ++n) {
+        audio[n] = (int16_t)(lrintf(buf[n] * gain) + dc);
+    }
+}
+
+static double _run(void (*compute)(const int16_t*, float*), float* out) {
+    clock_t start = clock();
+    for (int f = 0; f < NUM_FRAMES; ++f) {
+        compute(&audio[f * FRAME_STEP], &out[f * NUM_MEL_BINS]);
+    }
+    return (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / NUM_FRAMES;
+}
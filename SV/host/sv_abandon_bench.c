@@ -0,0 +1,168 @@
+/*
+ * early-abandon 탐색 벤치마크 (host 전용)
+ *
+ * 같은 화자 목록을 SV_SCAN_FULL / SV_SCAN_EARLY_ABANDON 두 handle에 등록하고,
+ * 등록 화자 쿼리(잡음 추가)와 미등록 화자 쿼리를 섞어 판정 시간과 결과 일치를 비교합니다.
+ * 차원별 분산이 같은 임베딩(투영 없음)과 앞쪽 차원에 분산이 몰린 임베딩(PCA/LDA projection 출력과 유사)을
+ * 각각 측정합니다. abandon %는 포기율 감시(SV_ABANDON_MAX_WORK)를 통과해 early-abandon으로 판정한 쿼리 비율입니다.
+ *
+ * 빌드 (SV/host 에서):
+ *   gcc -O2 -I../main/include sv_abandon_bench.c ../main/speaker_verifier.c ../main/sv_kernels.c ../main/sv_store.c ../main/sv_pool.c ../main/sv_backend.c ../main/sv_ivf.c -lm -pthread -o sv_abandon_bench
+ * 실행:
+ *   ./sv_abandon_bench [화자 수 (기본 2000)] [threshold (기본 0.5)]
+ */
+
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h> // dup, dup2
+
+#include "speaker_verifier.h"
+
+
+//=========================== define ===========================
+#define BENCH_NUM_QUERIES 1000        // 절반은 등록 화자, 절반은 미등록 화자
+#define BENCH_QUERY_NOISE 0.8f        // 등록 화자 쿼리 잡음 (화자 성분 대비)
+#define BENCH_DECAY_DIMS 30.0f        // 분산이 몰린 임베딩: 차원 d의 표준편차 exp(-d / 이 값)
+
+
+//=========================== variables ===========================
+static uint32_t rng_state = 7u;
+
+
+//=========================== prototypes ==========================
+static float _gauss(void);
+static sv_handle_t* _load(const float* emb, int n, float threshold, sv_scan_t scan);
+static void _run(const char* label, float decay, int n, float threshold);
+static double _now_us(void);
+
+
+//=========================== public ==============================
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 2000;
+    float threshold = (argc > 2) ? (float)atof(argv[2]) : 0.5f;
+
+    printf("\n=== early-abandon scan (%d speakers, threshold %.2f, %d queries) ===\n",
+           n, threshold, BENCH_NUM_QUERIES);
+    printf("%-12s %10s %10s %8s %10s %10s %10s\n", "embedding", "full us", "abandon us", "speedup",
+           "abandon %", "accepted", "mismatch");
+    _run("isotropic", 0.0f, n, threshold);
+    _run("decaying", BENCH_DECAY_DIMS, n, threshold);
+    return 0;
+}
+
+
+//=========================== private ==============================
+// decay > 0: 차원 d 성분에 exp(-d / decay)를 곱함
+static void _run(const char* label, float decay, int n, float threshold) {
+    float* emb = (float*)malloc(sizeof(float) * SV_EMBEDDING_DIM * n);
+    float* queries = (float*)malloc(sizeof(float) * SV_EMBEDDING_DIM * BENCH_NUM_QUERIES);
+    sv_result_t* results = (sv_result_t*)malloc(sizeof(sv_result_t) * BENCH_NUM_QUERIES * 2);
+    if (!emb || !queries || !results) {
+        printf("out of memory\n");
+        exit(-1);
+    }
+
+    float weight[SV_EMBEDDING_DIM];
+    for (int d = 0; d < SV_EMBEDDING_DIM; ++d) {
+        weight[d] = (decay > 0.0f) ? expf(-d / decay) : 1.0f;
+    }
+    for (int i = 0; i < n * SV_EMBEDDING_DIM; ++i) {
+        emb[i] = _gauss();
+    }
+    for (int q = 0; q < BENCH_NUM_QUERIES; ++q) {
+        const float* src = &emb[(size_t)((q * 13) % n) * SV_EMBEDDING_DIM];
+        for (int d = 0; d < SV_EMBEDDING_DIM; ++d) {
+            float v = (q & 1) ? _gauss() : src[d] + BENCH_QUERY_NOISE * _gauss();
+            queries[q * SV_EMBEDDING_DIM + d] = v * weight[d];
+        }
+    }
+    for (int i = 0; i < n * SV_EMBEDDING_DIM; ++i) {
+        emb[i] *= weight[i % SV_EMBEDDING_DIM];
+    }
+
+    sv_handle_t* full = _load(emb, n, threshold, SV_SCAN_FULL);
+    sv_handle_t* abandon = _load(emb, n, threshold, SV_SCAN_EARLY_ABANDON);
+    if (!full || !abandon) {
+        printf("init failed\n");
+        exit(-1);
+    }
+
+    double t[2];
+    sv_handle_t* handles[2] = {full, abandon};
+    for (int h = 0; h < 2; ++h) {
+        double t0 = _now_us();
+        for (int q = 0; q < BENCH_NUM_QUERIES; ++q) {
+            results[h * BENCH_NUM_QUERIES + q] = sv_system_verify(handles[h], &queries[q * SV_EMBEDDING_DIM]);
+        }
+        t[h] = (_now_us() - t0) / BENCH_NUM_QUERIES;
+    }
+
+    // early-abandon 판정 비율 (시간 측정과 분리: 판정마다 세션의 구간 카운터 변화를 확인)
+    // 구간 평가 후 전체 계산으로 전환하면 카운터가 0이 되고, 계속 쓰면 새 구간의 1이 됨
+    int used = 0;
+    for (int q = 0; q < BENCH_NUM_QUERIES; ++q) {
+        int frames = abandon->session->abandon_frames;
+        sv_system_verify(abandon, &queries[q * SV_EMBEDDING_DIM]);
+        used += (abandon->session->abandon_frames != 0 && abandon->session->abandon_frames != frames);
+    }
+
+    int accepted = 0, mismatches = 0;
+    for (int q = 0; q < BENCH_NUM_QUERIES; ++q) {
+        const sv_result_t* a = &results[q];
+        const sv_result_t* b = &results[BENCH_NUM_QUERIES + q];
+        accepted += (a->raw_speaker_id != -1);
+        mismatches += (a->raw_speaker_id != b->raw_speaker_id);
+    }
+    printf("%-12s %10.2f %10.2f %7.2fx %9.1f%% %10d %10d\n", label, t[0], t[1], t[0] / t[1],
+           100.0 * used / BENCH_NUM_QUERIES, accepted, mismatches);
+
+    sv_system_deinit(full);
+    sv_system_deinit(abandon);
+    free(emb);
+    free(queries);
+    free(results);
+}
+
+// xorshift32 + Box-Muller 표준 정규 분포
+static float _gauss(void) {
+    float u[2];
+    for (int i = 0; i < 2; ++i) {
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 17;
+        rng_state ^= rng_state << 5;
+        u[i] = ((float)(rng_state >> 8) + 1.0f) / 16777217.0f;
+    }
+    return sqrtf(-2.0f * logf(u[0])) * cosf(6.2831853f * u[1]);
+}
+
+// 화자 n명을 등록한 handle (로그는 숨김)
+static sv_handle_t* _load(const float* emb, int n, float threshold, sv_scan_t scan) {
+    sv_config_t config = {0};
+    config.algorithm = POST_NONE;
+    config.threshold = threshold;
+    config.scan = scan;
+
+    fflush(stdout);
+    int saved = dup(1);
+    FILE* devnull = freopen("/dev/null", "w", stdout);
+    sv_handle_t* handle = sv_system_init(&config);
+    for (int s = 0; handle && s < n; ++s) {
+        sv_system_register(handle, (float*)&emb[(size_t)s * SV_EMBEDDING_DIM], "bench");
+    }
+    fflush(stdout);
+    if (devnull) {
+        dup2(saved, 1);
+    }
+    close(saved);
+    return handle;
+}
+
+static double _now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
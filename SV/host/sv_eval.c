@@ -0,0 +1,682 @@
+/*
+ * 화자 검증 배치 평가 / threshold 보정 도구 (host 전용)
+ *
+ * 보드에 올리지 않고 speaker_verifier.c를 그대로 링크하여 threshold와 후처리 알고리즘을 정합니다.
+ * 등록/평가 CSV는 csv_to_header.py가 읽는 형식 (speaker_name,"[e0 e1 ...]")이며,
+ * 화자 라벨은 speaker_name의 첫 '_' 앞부분입니다. (sv_fit_projection과 같은 규칙, 예: S_CLEAN_Far_V -> S)
+ * 임베딩 차원은 등록 CSV의 첫 행에서 정하며 (config.embedding_dim), 다시 빌드하지 않고 다른 모델의 CSV를 평가할 수 있습니다.
+ *
+ *  1) 등록: 등록 CSV의 라벨별 임베딩을 정규화 후 평균하여 한 명씩 등록 (sv_database.h 화자는 제외)
+ *     (--templates n > 1: 첫 임베딩으로 등록한 뒤 나머지를 sv_system_add_template()으로 추가, 화자당 최대 n개 template)
+ *  2) 점수: 평가 CSV의 각 임베딩(trial)을 모든 등록 화자와 비교 (sv_verify_sessions 배치, 코어 수만큼 thread)
+ *     같은 라벨 = target, 다른 라벨 = non-target 점수로 EER, minDCF, DET 곡선, 목표 FAR의 threshold를 계산
+ *  3) replay: 평가 CSV에서 speaker_name이 같은 연속된 행을 한 시퀀스(발화의 프레임들)로 보고,
+ *     모든 sv_post_algo_t로 한 프레임씩 판정하여 첫 최종 판정까지의 hop 수와 정/오판정 비율을 출력
+ *     (threshold는 --threshold, 없으면 목표 FAR의 threshold)
+ *
+ * 빌드 (SV/host 에서):
+ *   make sv_eval
+ *   (또는 gcc -O2 -I../main/include sv_eval.c ../main/speaker_verifier.c ../main/sv_kernels.c ../main/sv_store.c ../main/sv_pool.c ../main/sv_backend.c ../main/sv_ivf.c -lm -pthread -o sv_eval)
+ * 실행:
+ *   ./sv_eval <등록 csv> <평가 csv> [--far 0.01] [--p-target 0.01] [--threshold t] [--threads n]
+ *             [--det det.csv] [--projection sv_projection.bin] [--backend cosine|plda] [--db float|int8]
+ *             [--templates n] [--template-score max|mean]
+ */
+
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h> // sysconf, dup
+
+#include "speaker_verifier.h"
+
+
+//=========================== define ===========================
+#define EVAL_MAX_LINE 65536          // CSV 한 줄 최대 길이
+#define EVAL_LABEL_LEN 64            // 화자 라벨 최대 길이
+#define EVAL_MAX_LABELS 4096         // 화자 라벨 최대 개수
+#define EVAL_DEFAULT_FAR 0.01
+#define EVAL_DEFAULT_P_TARGET 0.01   // minDCF 사전 확률 (C_miss = C_fa = 1)
+#define EVAL_DET_MAX_POINTS 1000     // DET CSV 최대 점 수 (점수 구간을 고르게 솎음)
+#define EVAL_MAX_HOPS 64             // replay hop 히스토그램 크기 (마지막 구간: 63 이상)
+
+
+//=========================== typedef ===========================
+// CSV 임베딩 집합
+typedef struct {
+    int n;
+    float* x;                        // [n][dim]
+    int* label;                      // [n] 라벨 번호 (eval_labels_t)
+    int* seq;                        // [n] 시퀀스 번호 (speaker_name이 같은 연속 행)
+    int num_seq;
+} eval_set_t;
+
+// 라벨 표 (등록/평가 CSV 공용)
+typedef struct {
+    char (*name)[EVAL_LABEL_LEN];
+    int num;
+} eval_labels_t;
+
+// 점수 계산 thread 작업 (trial 구간 [begin, end))
+typedef struct {
+    sv_handle_t* handle;
+    const eval_set_t* trials;
+    const int* row_to_spk;           // DB 행 -> 등록 화자 번호 (-1: 없음)
+    int num_spk;
+    int begin, end;
+    float* scores;                   // [trial][num_spk]
+} eval_score_job_t;
+
+// replay thread 작업 (시퀀스 번호 % num_threads == index)
+typedef struct {
+    sv_handle_t* handle;
+    const eval_set_t* trials;
+    const int* spk_id;               // 라벨 -> 등록 화자 ID (-1: 미등록)
+    int index, num_threads;
+    int correct, wrong, undecided;   // 등록 화자 시퀀스
+    int impostor, false_accept;      // 미등록 화자 시퀀스
+    int hop_hist[EVAL_MAX_HOPS];     // 정판정까지의 hop 수
+} eval_replay_job_t;
+
+
+//=========================== variables ===========================
+static int dim = 0;                  // 임베딩 차원 (등록 CSV 첫 행에서 결정, config.embedding_dim으로 전달)
+static const char* algo_names[SV_NUM_POST_ALGOS] = {"none", "consecutive", "majority", "smoothing"};
+
+
+//=========================== prototypes ==========================
+static int _load_csv(const char* path, eval_set_t* set, eval_labels_t* labels);
+static int _label_of(const char* name, eval_labels_t* labels);
+static sv_handle_t* _create(const sv_config_t* config, const eval_set_t* enroll, int num_labels, int* spk_id);
+static void _destroy(sv_handle_t* handle);
+static int _quiet_begin(void);
+static void _quiet_end(int saved);
+static void* _score_task(void* arg);
+static void* _replay_task(void* arg);
+static int _compare_float(const void* a, const void* b);
+static void _report_scores(const float* tar, int nt, const float* non, int nn, double far, double p_target,
+                           const char* det_path, float* far_threshold);
+static int _num_cpus(void);
+
+
+//=========================== public ==============================
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        printf("usage: %s <enroll.csv> <trials.csv> [--far f] [--p-target p] [--threshold t] [--threads n]\n"
+               "       [--det det.csv] [--projection file] [--backend cosine|plda] [--db float|int8]\n"
+               "       [--templates n] [--template-score max|mean]\n", argv[0]);
+        return -1;
+    }
+
+    double far = EVAL_DEFAULT_FAR;
+    double p_target = EVAL_DEFAULT_P_TARGET;
+    int have_threshold = 0;
+    float threshold = 0.0f;
+    int num_threads = _num_cpus();
+    const char* det_path = NULL;
+    const char* projection_path = NULL;
+    sv_config_t config = {0};
+    config.algorithm = POST_NONE;
+
+    for (int i = 3; i + 1 < argc; i += 2) {
+        const char* opt = argv[i];
+        const char* val = argv[i + 1];
+        if (strcmp(opt, "--far") == 0) {
+            far = atof(val);
+        } else if (strcmp(opt, "--p-target") == 0) {
+            p_target = atof(val);
+        } else if (strcmp(opt, "--threshold") == 0) {
+            threshold = (float)atof(val);
+            have_threshold = 1;
+        } else if (strcmp(opt, "--threads") == 0) {
+            num_threads = atoi(val);
+        } else if (strcmp(opt, "--det") == 0) {
+            det_path = val;
+        } else if (strcmp(opt, "--projection") == 0) {
+            projection_path = val;
+        } else if (strcmp(opt, "--backend") == 0) {
+            config.backend = (strcmp(val, "plda") == 0) ? SV_BACKEND_PLDA : SV_BACKEND_COSINE;
+        } else if (strcmp(opt, "--db") == 0) {
+            config.db_format = (strcmp(val, "int8") == 0) ? SV_DB_INT8 : SV_DB_FLOAT;
+        } else if (strcmp(opt, "--templates") == 0) {
+            config.max_templates = atoi(val);
+        } else if (strcmp(opt, "--template-score") == 0) {
+            config.template_score = (strcmp(val, "mean") == 0) ? SV_TEMPLATE_MEAN : SV_TEMPLATE_MAX;
+        } else {
+            printf("unknown option %s\n", opt);
+            return -1;
+        }
+    }
+    if (num_threads < 1) num_threads = 1;
+    if (num_threads > SV_MAX_READERS - 1) num_threads = SV_MAX_READERS - 1; // reader slot 하나는 여유
+
+    // projection 파일은 handle이 직접 가리키므로 평가가 끝날 때까지 유지
+    void* projection = NULL;
+    if (projection_path) {
+        FILE* f = fopen(projection_path, "rb");
+        if (!f) {
+            printf("cannot open %s\n", projection_path);
+            return -1;
+        }
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        projection = malloc(size);
+        if (!projection || fread(projection, 1, size, f) != (size_t)size) {
+            printf("cannot read %s\n", projection_path);
+            return -1;
+        }
+        fclose(f);
+        config.projection = projection;
+    }
+
+    eval_labels_t labels = {0};
+    labels.name = calloc(EVAL_MAX_LABELS, EVAL_LABEL_LEN);
+    eval_set_t enroll = {0}, trials = {0};
+    if (_load_csv(argv[1], &enroll, &labels) != 0 || _load_csv(argv[2], &trials, &labels) != 0) {
+        return -1;
+    }
+
+    // 1. 등록
+    int* spk_id = (int*)malloc(sizeof(int) * labels.num);
+    sv_handle_t* handle = _create(&config, &enroll, labels.num, spk_id);
+    if (!handle) {
+        printf("init failed\n");
+        return -1;
+    }
+    int num_spk = 0;
+    for (int l = 0; l < labels.num; ++l) {
+        num_spk += (spk_id[l] != -1);
+    }
+    const sv_db_t* db = atomic_load(&handle->db); // 등록 이후에는 DB를 바꾸지 않음
+    int* row_to_spk = (int*)malloc(sizeof(int) * (db->num_speakers + 1));
+    int* spk_label = (int*)malloc(sizeof(int) * num_spk);
+    for (int r = 0, k = 0; r < db->num_speakers; ++r) {
+        row_to_spk[r] = -1;
+        if (db->templates && db->templates[r].lead != r) {
+            continue; // 다중 template: 화자 점수는 lead 행에 합쳐짐
+        }
+        for (int l = 0; l < labels.num; ++l) {
+            if (spk_id[l] != -1 && spk_id[l] == db->speakers_db[r].speaker_id) {
+                row_to_spk[r] = k;
+                spk_label[k++] = l;
+                break;
+            }
+        }
+    }
+    printf("enrolled %d speakers (%d embeddings), %d trials in %d sequences, %d threads\n",
+           num_spk, enroll.n, trials.n, trials.num_seq, num_threads);
+
+    // 2. 모든 trial x 등록 화자 점수 (thread마다 trial 구간 하나)
+    float* scores = (float*)malloc(sizeof(float) * trials.n * num_spk);
+    pthread_t threads[SV_MAX_READERS];
+    eval_score_job_t score_jobs[SV_MAX_READERS];
+    for (int t = 0; t < num_threads; ++t) {
+        eval_score_job_t* job = &score_jobs[t];
+        job->handle = handle;
+        job->trials = &trials;
+        job->row_to_spk = row_to_spk;
+        job->num_spk = num_spk;
+        job->begin = (int)((long)trials.n * t / num_threads);
+        job->end = (int)((long)trials.n * (t + 1) / num_threads);
+        job->scores = scores;
+        pthread_create(&threads[t], NULL, _score_task, job);
+    }
+    for (int t = 0; t < num_threads; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+
+    float* tar = (float*)malloc(sizeof(float) * trials.n);
+    float* non = (float*)malloc(sizeof(float) * trials.n * num_spk);
+    int nt = 0, nn = 0;
+    for (int i = 0; i < trials.n; ++i) {
+        for (int k = 0; k < num_spk; ++k) {
+            float s = scores[(size_t)i * num_spk + k];
+            if (spk_label[k] == trials.label[i]) {
+                tar[nt++] = s;
+            } else {
+                non[nn++] = s;
+            }
+        }
+    }
+    if (nt == 0 || nn == 0) {
+        printf("need both target and non-target trials (targets %d, non-targets %d)\n", nt, nn);
+        return -1;
+    }
+    float far_threshold;
+    _report_scores(tar, nt, non, nn, far, p_target, det_path, &far_threshold);
+    _destroy(handle);
+
+    // 3. 후처리 알고리즘별 replay
+    if (!have_threshold) {
+        threshold = far_threshold;
+    }
+    printf("\n=== replay (threshold %.4f, %d sequences) ===\n", threshold, trials.num_seq);
+    printf("%-12s %9s %9s %10s %10s %9s %9s %9s\n", "algorithm", "correct", "wrong", "undecided",
+           "false acc", "mean hop", "p50 hop", "p90 hop");
+    for (int a = 0; a < SV_NUM_POST_ALGOS; ++a) {
+        sv_config_t algo_config = config;
+        algo_config.algorithm = (sv_post_algo_t)a;
+        algo_config.threshold = threshold;
+        sv_handle_t* algo_handle = _create(&algo_config, &enroll, labels.num, spk_id);
+        if (!algo_handle) {
+            printf("init failed\n");
+            return -1;
+        }
+
+        eval_replay_job_t replay_jobs[SV_MAX_READERS];
+        memset(replay_jobs, 0, sizeof(replay_jobs));
+        for (int t = 0; t < num_threads; ++t) {
+            replay_jobs[t].handle = algo_handle;
+            replay_jobs[t].trials = &trials;
+            replay_jobs[t].spk_id = spk_id;
+            replay_jobs[t].index = t;
+            replay_jobs[t].num_threads = num_threads;
+            pthread_create(&threads[t], NULL, _replay_task, &replay_jobs[t]);
+        }
+        eval_replay_job_t sum = {0};
+        for (int t = 0; t < num_threads; ++t) {
+            pthread_join(threads[t], NULL);
+            sum.correct += replay_jobs[t].correct;
+            sum.wrong += replay_jobs[t].wrong;
+            sum.undecided += replay_jobs[t].undecided;
+            sum.impostor += replay_jobs[t].impostor;
+            sum.false_accept += replay_jobs[t].false_accept;
+            for (int h = 0; h < EVAL_MAX_HOPS; ++h) {
+                sum.hop_hist[h] += replay_jobs[t].hop_hist[h];
+            }
+        }
+        _destroy(algo_handle);
+
+        // 정판정 hop 분포 (평균, 중앙값, 90%)
+        long hop_sum = 0;
+        int p50 = -1, p90 = -1, seen = 0;
+        for (int h = 0; h < EVAL_MAX_HOPS; ++h) {
+            hop_sum += (long)h * sum.hop_hist[h];
+            seen += sum.hop_hist[h];
+            if (p50 < 0 && seen * 2 >= sum.correct && sum.correct > 0) p50 = h;
+            if (p90 < 0 && seen * 10 >= sum.correct * 9 && sum.correct > 0) p90 = h;
+        }
+        int genuine = sum.correct + sum.wrong + sum.undecided;
+        printf("%-12s %8.1f%% %8.1f%% %9.1f%% %9.1f%% %9.2f %9d %9d\n", algo_names[a],
+               genuine ? 100.0 * sum.correct / genuine : 0.0,
+               genuine ? 100.0 * sum.wrong / genuine : 0.0,
+               genuine ? 100.0 * sum.undecided / genuine : 0.0,
+               sum.impostor ? 100.0 * sum.false_accept / sum.impostor : 0.0,
+               sum.correct ? (double)hop_sum / sum.correct : 0.0, p50, p90);
+    }
+    printf("(correct/wrong/undecided: 등록 화자 시퀀스 기준, false acc: 미등록 화자 시퀀스 중 최종 판정된 비율,\n"
+           " hop: 시퀀스 첫 프레임부터 정판정 프레임까지)\n");
+
+    free(scores);
+    free(tar);
+    free(non);
+    free(row_to_spk);
+    free(spk_label);
+    free(spk_id);
+    free(enroll.x);
+    free(enroll.label);
+    free(enroll.seq);
+    free(trials.x);
+    free(trials.label);
+    free(trials.seq);
+    free(labels.name);
+    free(projection);
+    return 0;
+}
+
+
+//=========================== private ==============================
+// CSV 로드 (csv_to_header.py와 같은 형식, 첫 행과 차원이 다른 행은 건너뜀)
+static int _load_csv(const char* path, eval_set_t* set, eval_labels_t* labels) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        printf("cannot open %s\n", path);
+        return -1;
+    }
+
+    char* line = (char*)malloc(EVAL_MAX_LINE);
+    char prev_name[EVAL_MAX_LINE / 64] = "";
+    int cap = 0;
+    float row[SV_MAX_EMBEDDING_DIM];
+
+    if (!fgets(line, EVAL_MAX_LINE, f)) { // header
+        fclose(f);
+        free(line);
+        return -1;
+    }
+    while (fgets(line, EVAL_MAX_LINE, f)) {
+        char* comma = strchr(line, ',');
+        char* open = comma ? strchr(comma, '[') : NULL;
+        if (!open) {
+            continue;
+        }
+        *comma = '\0';
+
+        int n = 0;
+        char* p = open + 1;
+        char* end;
+        while (n <= SV_MAX_EMBEDDING_DIM) {
+            float v = strtof(p, &end);
+            if (end == p) break;
+            if (n < SV_MAX_EMBEDDING_DIM) row[n] = v;
+            n++;
+            p = end;
+        }
+        if (dim == 0 && n > 0 && n <= SV_MAX_EMBEDDING_DIM) {
+            dim = n;
+        }
+        if (n != dim) {
+            printf("skip '%s' (dim %d, expected %d)\n", line, n, dim);
+            continue;
+        }
+
+        if (set->n == cap) {
+            cap = cap ? cap * 2 : 256;
+            set->x = (float*)realloc(set->x, sizeof(float) * cap * dim);
+            set->label = (int*)realloc(set->label, sizeof(int) * cap);
+            set->seq = (int*)realloc(set->seq, sizeof(int) * cap);
+        }
+        memcpy(&set->x[(size_t)set->n * dim], row, sizeof(float) * dim);
+        set->label[set->n] = _label_of(line, labels);
+        if (set->n == 0 || strcmp(prev_name, line) != 0) {
+            set->num_seq++;
+            strncpy(prev_name, line, sizeof(prev_name) - 1);
+        }
+        set->seq[set->n] = set->num_seq - 1;
+        set->n++;
+    }
+
+    fclose(f);
+    free(line);
+    if (set->n == 0) {
+        printf("no embeddings in %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+// 화자 라벨 번호 (speaker_name의 첫 '_' 앞부분, 처음 보면 추가)
+static int _label_of(const char* name, eval_labels_t* labels) {
+    char key[EVAL_LABEL_LEN] = {0};
+    size_t len = strcspn(name, "_");
+    if (len >= sizeof(key)) len = sizeof(key) - 1;
+    memcpy(key, name, len);
+
+    for (int i = 0; i < labels->num; ++i) {
+        if (strcmp(labels->name[i], key) == 0) {
+            return i;
+        }
+    }
+    if (labels->num == EVAL_MAX_LABELS) {
+        return EVAL_MAX_LABELS - 1;
+    }
+    strcpy(labels->name[labels->num], key);
+    return labels->num++;
+}
+
+// sv_database.h 화자를 지우고 등록 CSV의 라벨별 평균 임베딩(또는 template)을 등록한 handle (spk_id[라벨] = 화자 ID, 미등록 -1)
+static sv_handle_t* _create(const sv_config_t* config, const eval_set_t* enroll, int num_labels, int* spk_id) {
+    sv_config_t copy = *config;
+    copy.embedding_dim = dim;
+
+    int saved = _quiet_begin(); // 등록 로그 숨김
+    sv_handle_t* handle = sv_system_init(&copy);
+    if (handle) {
+        const sv_db_t* db = atomic_load(&handle->db);
+        int preregistered = db->num_speakers;
+        int* ids = (int*)malloc(sizeof(int) * (preregistered + 1));
+        for (int r = 0; r < preregistered; ++r) {
+            ids[r] = db->speakers_db[r].speaker_id;
+        }
+        for (int r = 0; r < preregistered; ++r) {
+            sv_system_unregister(handle, ids[r]);
+        }
+        free(ids);
+
+        float* mean = (float*)malloc(sizeof(float) * dim);
+        for (int l = 0; l < num_labels; ++l) {
+            spk_id[l] = -1;
+            if (copy.max_templates > 1) {
+                // 임베딩마다 가장 가까운 template에 합치거나 새 template 추가
+                char name[SV_MAX_NAME_LEN];
+                snprintf(name, sizeof(name), "spk%d", l);
+                for (int i = 0; i < enroll->n; ++i) {
+                    if (enroll->label[i] != l) continue;
+                    float* x = &enroll->x[(size_t)i * dim];
+                    if (spk_id[l] != -1) {
+                        sv_system_add_template(handle, spk_id[l], x);
+                        continue;
+                    }
+                    int id = handle->next_speaker_id;
+                    if (sv_system_register(handle, x, name) == SV_SUCCESS) {
+                        spk_id[l] = id;
+                    }
+                }
+                continue;
+            }
+            int count = 0;
+            memset(mean, 0, sizeof(float) * dim);
+            for (int i = 0; i < enroll->n; ++i) {
+                if (enroll->label[i] != l) continue;
+                const float* x = &enroll->x[(size_t)i * dim];
+                double norm = 0.0;
+                for (int d = 0; d < dim; ++d) norm += (double)x[d] * x[d];
+                float inv = (norm > 1e-24) ? (float)(1.0 / sqrt(norm)) : 0.0f;
+                for (int d = 0; d < dim; ++d) mean[d] += x[d] * inv;
+                count++;
+            }
+            if (count == 0) continue;
+            int id = handle->next_speaker_id;
+            char name[SV_MAX_NAME_LEN];
+            snprintf(name, sizeof(name), "spk%d", l);
+            if (sv_system_register(handle, mean, name) == SV_SUCCESS) {
+                spk_id[l] = id;
+            }
+        }
+        free(mean);
+    }
+    _quiet_end(saved);
+    return handle;
+}
+
+static void _destroy(sv_handle_t* handle) {
+    int saved = _quiet_begin();
+    sv_system_deinit(handle);
+    _quiet_end(saved);
+}
+
+// stdout을 /dev/null로 돌려 라이브러리 LOG_I 출력을 숨김 (반환값: 원래 stdout, 실패 시 -1)
+static int _quiet_begin(void) {
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    FILE* devnull = fopen("/dev/null", "w");
+    if (saved < 0 || !devnull) {
+        if (devnull) fclose(devnull);
+        if (saved >= 0) close(saved);
+        return -1;
+    }
+    dup2(fileno(devnull), STDOUT_FILENO);
+    fclose(devnull);
+    return saved;
+}
+
+static void _quiet_end(int saved) {
+    if (saved < 0) return;
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+}
+
+// trial 구간을 SV_MAX_BATCH개씩 배치 판정하고 세션의 행별 점수를 등록 화자 순서로 복사
+static void* _score_task(void* arg) {
+    eval_score_job_t* job = (eval_score_job_t*)arg;
+    sv_session_t* sessions[SV_MAX_BATCH];
+    float* queries[SV_MAX_BATCH];
+    sv_result_t results[SV_MAX_BATCH];
+    for (int i = 0; i < SV_MAX_BATCH; ++i) {
+        sessions[i] = sv_session_create(job->handle);
+        if (!sessions[i]) {
+            printf("session create failed\n");
+            exit(-1);
+        }
+    }
+
+    const sv_db_t* db = atomic_load(&job->handle->db);
+    for (int base = job->begin; base < job->end; base += SV_MAX_BATCH) {
+        int m = (job->end - base < SV_MAX_BATCH) ? job->end - base : SV_MAX_BATCH;
+        for (int i = 0; i < m; ++i) {
+            queries[i] = &job->trials->x[(size_t)(base + i) * dim];
+        }
+        sv_verify_sessions(sessions, queries, m, results);
+        for (int i = 0; i < m; ++i) {
+            float* out = &job->scores[(size_t)(base + i) * job->num_spk];
+            for (int r = 0; r < db->num_speakers; ++r) {
+                if (job->row_to_spk[r] != -1) {
+                    out[job->row_to_spk[r]] = sessions[i]->scores[r];
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < SV_MAX_BATCH; ++i) {
+        sv_session_destroy(sessions[i]);
+    }
+    return NULL;
+}
+
+// 시퀀스마다 세션 상태를 초기화하고 첫 최종 판정이 나올 때까지 프레임 순서대로 판정
+static void* _replay_task(void* arg) {
+    eval_replay_job_t* job = (eval_replay_job_t*)arg;
+    const eval_set_t* trials = job->trials;
+    sv_session_t* session = sv_session_create(job->handle);
+    if (!session) {
+        printf("session create failed\n");
+        exit(-1);
+    }
+
+    int i = 0;
+    while (i < trials->n) {
+        int seq = trials->seq[i];
+        int end = i;
+        while (end < trials->n && trials->seq[end] == seq) {
+            end++;
+        }
+        if (seq % job->num_threads != job->index) {
+            i = end;
+            continue;
+        }
+
+        int truth = job->spk_id[trials->label[i]];
+        int decided = -1, hops = 0;
+        sv_session_reset(session);
+        for (int f = i; f < end; ++f) {
+            sv_result_t result = sv_session_verify(session, &trials->x[(size_t)f * dim], NULL, 0);
+            if (result.final_speaker_id != -1) {
+                decided = result.final_speaker_id;
+                hops = f - i;
+                break;
+            }
+        }
+
+        if (truth == -1) {
+            job->impostor++;
+            job->false_accept += (decided != -1);
+        } else if (decided == truth) {
+            job->correct++;
+            job->hop_hist[(hops < EVAL_MAX_HOPS) ? hops : EVAL_MAX_HOPS - 1]++;
+        } else if (decided != -1) {
+            job->wrong++;
+        } else {
+            job->undecided++;
+        }
+        i = end;
+    }
+
+    sv_session_destroy(session);
+    return NULL;
+}
+
+static int _compare_float(const void* a, const void* b) {
+    float x = *(const float*)a, y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * EER, minDCF, 목표 FAR의 threshold를 출력하고 DET 곡선을 CSV로 저장합니다.
+ * threshold t에서 P_miss = (target < t) 비율, P_fa = (non-target >= t) 비율.
+ */
+static void _report_scores(const float* tar, int nt, const float* non, int nn, double far, double p_target,
+                           const char* det_path, float* far_threshold) {
+    float* st = (float*)malloc(sizeof(float) * nt);
+    float* sn = (float*)malloc(sizeof(float) * nn);
+    memcpy(st, tar, sizeof(float) * nt);
+    memcpy(sn, non, sizeof(float) * nn);
+    qsort(st, nt, sizeof(float), _compare_float);
+    qsort(sn, nn, sizeof(float), _compare_float);
+
+    FILE* det = det_path ? fopen(det_path, "w") : NULL;
+    if (det) {
+        fprintf(det, "threshold,p_fa,p_miss\n");
+    }
+    int det_step = (nt + nn) / EVAL_DET_MAX_POINTS + 1;
+
+    // 모든 점수를 threshold 후보로 오름차순 sweep (i: t 미만 target 수, j: t 미만 non-target 수)
+    double c_norm = (p_target < 1.0 - p_target) ? p_target : 1.0 - p_target;
+    double eer = 1.0, eer_gap = 2.0, min_dcf = 1e30;
+    float eer_threshold = 0.0f, dcf_threshold = 0.0f;
+    int i = 0, j = 0, step = 0;
+    while (i < nt || j < nn) {
+        float t = (j >= nn || (i < nt && st[i] < sn[j])) ? st[i] : sn[j];
+        double p_miss = (double)i / nt;
+        double p_fa = (double)(nn - j) / nn;
+        double gap = fabs(p_miss - p_fa);
+        if (gap < eer_gap) {
+            eer_gap = gap;
+            eer = 0.5 * (p_miss + p_fa);
+            eer_threshold = t;
+        }
+        double dcf = (p_target * p_miss + (1.0 - p_target) * p_fa) / c_norm;
+        if (dcf < min_dcf) {
+            min_dcf = dcf;
+            dcf_threshold = t;
+        }
+        if (det && step++ % det_step == 0) {
+            fprintf(det, "%.6f,%.6f,%.6f\n", t, p_fa, p_miss);
+        }
+        while (i < nt && st[i] == t) i++;
+        while (j < nn && sn[j] == t) j++;
+    }
+    if (det) {
+        fclose(det);
+    }
+
+    // 목표 FAR: non-target 중 threshold 이상이 floor(far * nn)개 이하가 되는 가장 작은 threshold
+    int allowed = (int)floor(far * nn);
+    float t_far = (allowed >= nn) ? sn[0] : nextafterf(sn[nn - 1 - allowed], INFINITY);
+    int fa = 0, miss = 0;
+    for (int k = 0; k < nn; ++k) fa += (sn[k] >= t_far);
+    for (int k = 0; k < nt; ++k) miss += (st[k] < t_far);
+    *far_threshold = t_far;
+
+    printf("\n=== scores (%d target, %d non-target) ===\n", nt, nn);
+    printf("target     median %8.4f  non-target median %8.4f\n", st[nt / 2], sn[nn / 2]);
+    printf("EER        %.3f%%  (threshold %.4f)\n", 100.0 * eer, eer_threshold);
+    printf("minDCF     %.4f  (p_target %.3f, threshold %.4f)\n", min_dcf, p_target, dcf_threshold);
+    printf("FAR %.3f%%  threshold %.4f  (FAR %.3f%%, FRR %.3f%%)\n", 100.0 * far, t_far,
+           100.0 * fa / nn, 100.0 * miss / nt);
+    if (det_path) {
+        printf("DET        %s\n", det_path);
+    }
+
+    free(st);
+    free(sn);
+}
+
+static int _num_cpus(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (int)n : 1;
+}
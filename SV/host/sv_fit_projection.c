@@ -0,0 +1,462 @@
+/*
+ * 차원 축소 projection 학습 도구 (host 전용)
+ *
+ * csv_to_header.py가 읽는 CSV (speaker_name,"[e0 e1 ...]")의 임베딩으로 PCA 또는 LDA projection을 학습하여
+ * sv_projection.h 형식의 sv_projection.bin을 만듭니다. (sv_config_t.projection에 지정)
+ *   pca: 전체 임베딩 공분산의 상위 out_dim개 고유벡터 (분산 보존)
+ *   lda: 화자 내 분산 대비 화자 간 분산이 큰 방향 (out_dim <= 화자 수 - 1)
+ *        화자 라벨은 speaker_name의 첫 '_' 앞부분 (예: S_CLEAN_Far_V -> S, 같은 화자의 여러 녹음 조건)
+ *   plda: L2 정규화한 임베딩으로 LDA와 같은 변환을 학습하고 화자 간 분산 psi를 함께 기록
+ *         (변환 후 화자 내 공분산 = I, 화자 간 공분산 = diag(psi), sv_config_t.backend = SV_BACKEND_PLDA)
+ *
+ * 빌드 (SV/host 에서):
+ *   gcc -O2 -I../main/include sv_fit_projection.c -lm -o sv_fit_projection
+ * 실행:
+ *   ./sv_fit_projection <csv> [출력 파일 (기본 sv_projection.bin)] [out_dim (기본 64)] [pca|lda|plda (기본 pca)]
+ */
+
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "sv_projection.h"
+
+
+//=========================== define ===========================
+#define FIT_MAX_LINE 65536         // CSV 한 줄 최대 길이
+#define FIT_MAX_DIM 1024           // 임베딩 최대 차원
+#define FIT_MAX_LABELS 1024        // 화자 라벨 최대 개수
+#define FIT_DEFAULT_OUT_DIM 64
+#define FIT_JACOBI_SWEEPS 64       // Jacobi 고유값 분해 최대 sweep 수
+#define FIT_LDA_REG 1e-3           // LDA: 화자 내 공분산 대각 보정 (평균 분산 대비)
+
+
+//=========================== typedef ===========================
+typedef struct {
+    int n;                   // 임베딩 수
+    int dim;                 // 임베딩 차원
+    double* x;               // [n][dim]
+    int* label;              // [n] 화자 라벨 번호 (LDA)
+    int num_labels;
+} fit_data_t;
+
+
+//=========================== prototypes ==========================
+static int _load_csv(const char* path, fit_data_t* data);
+static int _label_of(const char* name, char labels[][64], int* num_labels);
+static void _covariance(const fit_data_t* data, const double* mean, double* cov);
+static void _jacobi_eigen(double* a, int n, double* eval, double* evec);
+static int _fit_pca(const fit_data_t* data, const double* mean, int out_dim, double* w);
+static int _fit_lda(const fit_data_t* data, const double* mean, int out_dim, double* w, double* psi);
+static void _normalize_rows(fit_data_t* data);
+static int _write_projection(const char* path, int in_dim, int out_dim, int flags,
+                             const double* mean, const double* w, const double* psi);
+
+
+//=========================== public ==============================
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printf("usage: %s <csv> [out.bin] [out_dim] [pca|lda|plda]\n", argv[0]);
+        return -1;
+    }
+    const char* out_path = (argc > 2) ? argv[2] : "sv_projection.bin";
+    int out_dim = (argc > 3) ? atoi(argv[3]) : FIT_DEFAULT_OUT_DIM;
+    const char* method = (argc > 4) ? argv[4] : "pca";
+    int use_plda = strcmp(method, "plda") == 0;
+    int use_lda = use_plda || strcmp(method, "lda") == 0;
+
+    fit_data_t data = {0};
+    if (_load_csv(argv[1], &data) != 0) {
+        return -1;
+    }
+    if (out_dim <= 0 || out_dim > data.dim) {
+        printf("out_dim must be 1..%d\n", data.dim);
+        return -1;
+    }
+    printf("%d embeddings, dim %d, %d speaker labels\n", data.n, data.dim, data.num_labels);
+    if (use_plda) {
+        _normalize_rows(&data); // 런타임 PLDA backend도 입력을 먼저 L2 정규화
+    }
+
+    double* mean = (double*)calloc(data.dim, sizeof(double));
+    double* w = (double*)calloc((size_t)out_dim * data.dim, sizeof(double));
+    double* psi = use_plda ? (double*)calloc(out_dim, sizeof(double)) : NULL;
+    for (int i = 0; i < data.n; ++i) {
+        for (int d = 0; d < data.dim; ++d) {
+            mean[d] += data.x[(size_t)i * data.dim + d] / data.n;
+        }
+    }
+
+    int fitted = use_lda ? _fit_lda(&data, mean, out_dim, w, psi) : _fit_pca(&data, mean, out_dim, w);
+    if (fitted <= 0) {
+        printf("fit failed\n");
+        return -1;
+    }
+    int flags = use_plda ? (SV_PROJ_FLAG_LDA | SV_PROJ_FLAG_PLDA) : use_lda ? SV_PROJ_FLAG_LDA : 0;
+    if (_write_projection(out_path, data.dim, fitted, flags, mean, w, psi) != 0) {
+        return -1;
+    }
+    printf("wrote %s: %s %d -> %d\n", out_path, use_plda ? "PLDA" : use_lda ? "LDA" : "PCA", data.dim, fitted);
+
+    free(mean);
+    free(w);
+    free(psi);
+    free(data.x);
+    free(data.label);
+    return 0;
+}
+
+
+//=========================== private ==============================
+// CSV 로드 (csv_to_header.py와 같은 형식, 임베딩 길이가 다른 행은 건너뜀)
+static int _load_csv(const char* path, fit_data_t* data) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        printf("cannot open %s\n", path);
+        return -1;
+    }
+
+    char* line = (char*)malloc(FIT_MAX_LINE);
+    char (*labels)[64] = calloc(FIT_MAX_LABELS, 64);
+    int cap = 0;
+    double row[FIT_MAX_DIM];
+
+    if (!fgets(line, FIT_MAX_LINE, f)) { // header
+        fclose(f);
+        return -1;
+    }
+    while (fgets(line, FIT_MAX_LINE, f)) {
+        char* comma = strchr(line, ',');
+        char* open = comma ? strchr(comma, '[') : NULL;
+        if (!open) {
+            continue;
+        }
+        *comma = '\0';
+
+        int dim = 0;
+        char* p = open + 1;
+        char* end;
+        while (dim < FIT_MAX_DIM) {
+            double v = strtod(p, &end);
+            if (end == p) break;
+            row[dim++] = v;
+            p = end;
+        }
+        if (dim == 0 || (data->dim != 0 && dim != data->dim)) {
+            printf("skip '%s' (dim %d)\n", line, dim);
+            continue;
+        }
+        data->dim = dim;
+
+        if (data->n == cap) {
+            cap = cap ? cap * 2 : 64;
+            data->x = (double*)realloc(data->x, sizeof(double) * cap * dim);
+            data->label = (int*)realloc(data->label, sizeof(int) * cap);
+        }
+        memcpy(&data->x[(size_t)data->n * dim], row, sizeof(double) * dim);
+        data->label[data->n] = _label_of(line, labels, &data->num_labels);
+        data->n++;
+    }
+
+    fclose(f);
+    free(line);
+    free(labels);
+    if (data->n < 2) {
+        printf("need at least 2 embeddings\n");
+        return -1;
+    }
+    return 0;
+}
+
+// 화자 라벨: 이름의 첫 '_' 앞부분
+static int _label_of(const char* name, char labels[][64], int* num_labels) {
+    char key[64] = {0};
+    size_t len = strcspn(name, "_");
+    if (len >= sizeof(key)) len = sizeof(key) - 1;
+    memcpy(key, name, len);
+
+    for (int i = 0; i < *num_labels; ++i) {
+        if (strcmp(labels[i], key) == 0) {
+            return i;
+        }
+    }
+    if (*num_labels == FIT_MAX_LABELS) {
+        return FIT_MAX_LABELS - 1;
+    }
+    strcpy(labels[*num_labels], key);
+    return (*num_labels)++;
+}
+
+// 임베딩 행별 L2 정규화 (PLDA)
+static void _normalize_rows(fit_data_t* data) {
+    for (int i = 0; i < data->n; ++i) {
+        double* x = &data->x[(size_t)i * data->dim];
+        double norm = 0.0;
+        for (int d = 0; d < data->dim; ++d) norm += x[d] * x[d];
+        norm = sqrt(norm);
+        if (norm < 1e-12) continue;
+        for (int d = 0; d < data->dim; ++d) x[d] /= norm;
+    }
+}
+
+// 평균 기준 공분산 [dim][dim]
+static void _covariance(const fit_data_t* data, const double* mean, double* cov) {
+    int D = data->dim;
+    memset(cov, 0, sizeof(double) * D * D);
+    for (int i = 0; i < data->n; ++i) {
+        const double* x = &data->x[(size_t)i * D];
+        for (int a = 0; a < D; ++a) {
+            double xa = x[a] - mean[a];
+            for (int b = a; b < D; ++b) {
+                cov[a * D + b] += xa * (x[b] - mean[b]);
+            }
+        }
+    }
+    for (int a = 0; a < D; ++a) {
+        for (int b = a; b < D; ++b) {
+            cov[a * D + b] /= data->n;
+            cov[b * D + a] = cov[a * D + b];
+        }
+    }
+}
+
+// 대칭 행렬 고유값 분해 (cyclic Jacobi, a는 파괴됨)
+// eval: 내림차순 고유값 [n], evec: 행 i가 eval[i]의 단위 고유벡터 [n][n]
+static void _jacobi_eigen(double* a, int n, double* eval, double* evec) {
+    double* v = (double*)calloc((size_t)n * n, sizeof(double));
+    for (int i = 0; i < n; ++i) v[i * n + i] = 1.0;
+
+    for (int sweep = 0; sweep < FIT_JACOBI_SWEEPS; ++sweep) {
+        double off = 0.0, total = 0.0;
+        for (int p = 0; p < n; ++p) {
+            for (int q = 0; q < n; ++q) {
+                total += a[p * n + q] * a[p * n + q];
+                if (p != q) off += a[p * n + q] * a[p * n + q];
+            }
+        }
+        if (off <= 1e-22 * total) {
+            break;
+        }
+
+        for (int p = 0; p < n - 1; ++p) {
+            for (int q = p + 1; q < n; ++q) {
+                double apq = a[p * n + q];
+                if (fabs(apq) < 1e-300) continue;
+                double theta = (a[q * n + q] - a[p * n + p]) / (2.0 * apq);
+                double t = (theta >= 0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1.0));
+                double c = 1.0 / sqrt(t * t + 1.0);
+                double s = t * c;
+
+                for (int k = 0; k < n; ++k) {  // 열 p, q 회전
+                    double akp = a[k * n + p], akq = a[k * n + q];
+                    a[k * n + p] = c * akp - s * akq;
+                    a[k * n + q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < n; ++k) {  // 행 p, q 회전
+                    double apk = a[p * n + k], aqk = a[q * n + k];
+                    a[p * n + k] = c * apk - s * aqk;
+                    a[q * n + k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < n; ++k) {
+                    double vkp = v[k * n + p], vkq = v[k * n + q];
+                    v[k * n + p] = c * vkp - s * vkq;
+                    v[k * n + q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    // 내림차순 정렬 (선택 정렬, n은 임베딩 차원 정도)
+    int* order = (int*)malloc(sizeof(int) * n);
+    for (int i = 0; i < n; ++i) order[i] = i;
+    for (int i = 0; i < n; ++i) {
+        int best = i;
+        for (int j = i + 1; j < n; ++j) {
+            if (a[order[j] * n + order[j]] > a[order[best] * n + order[best]]) best = j;
+        }
+        int t = order[i]; order[i] = order[best]; order[best] = t;
+    }
+    for (int i = 0; i < n; ++i) {
+        eval[i] = a[order[i] * n + order[i]];
+        for (int k = 0; k < n; ++k) {
+            evec[i * n + k] = v[k * n + order[i]];
+        }
+    }
+    free(order);
+    free(v);
+}
+
+// PCA: 공분산 상위 out_dim개 고유벡터 (반환값: 학습된 차원)
+static int _fit_pca(const fit_data_t* data, const double* mean, int out_dim, double* w) {
+    int D = data->dim;
+    double* cov = (double*)malloc(sizeof(double) * D * D);
+    double* eval = (double*)malloc(sizeof(double) * D);
+    double* evec = (double*)malloc(sizeof(double) * D * D);
+
+    _covariance(data, mean, cov);
+    _jacobi_eigen(cov, D, eval, evec);
+
+    // 표본 수가 차원보다 적으면 분산이 0인 방향은 의미가 없으므로 제외
+    if (out_dim > data->n - 1) {
+        printf("out_dim %d > rank %d, using %d\n", out_dim, data->n - 1, data->n - 1);
+        out_dim = data->n - 1;
+    }
+
+    double total = 0.0, kept = 0.0;
+    for (int i = 0; i < D; ++i) {
+        total += (eval[i] > 0) ? eval[i] : 0.0;
+        if (i < out_dim) kept += (eval[i] > 0) ? eval[i] : 0.0;
+    }
+    printf("PCA: retained variance %.2f%%\n", total > 0 ? 100.0 * kept / total : 0.0);
+
+    memcpy(w, evec, sizeof(double) * out_dim * D);
+    free(cov);
+    free(eval);
+    free(evec);
+    return out_dim;
+}
+
+// LDA: 화자 내 공분산으로 whitening 한 뒤 화자 간 공분산의 상위 고유벡터 (반환값: 학습된 차원)
+// psi (NULL 허용): 변환된 공간의 화자 간 분산 [out_dim] (PLDA)
+static int _fit_lda(const fit_data_t* data, const double* mean, int out_dim, double* w, double* psi) {
+    int D = data->dim;
+    int L = data->num_labels;
+    if (L < 2) {
+        printf("LDA needs at least 2 speaker labels\n");
+        return 0;
+    }
+    if (out_dim > L - 1) {
+        printf("out_dim %d > labels - 1, using %d\n", out_dim, L - 1);
+        out_dim = L - 1;
+    }
+
+    // 화자별 평균
+    double* cmean = (double*)calloc((size_t)L * D, sizeof(double));
+    int* count = (int*)calloc(L, sizeof(int));
+    for (int i = 0; i < data->n; ++i) {
+        count[data->label[i]]++;
+        for (int d = 0; d < D; ++d) cmean[data->label[i] * D + d] += data->x[(size_t)i * D + d];
+    }
+    for (int c = 0; c < L; ++c) {
+        for (int d = 0; d < D; ++d) cmean[c * D + d] /= count[c];
+    }
+
+    // 화자 내 공분산 Sw, 화자 간 공분산 Sb
+    double* sw = (double*)calloc((size_t)D * D, sizeof(double));
+    double* sb = (double*)calloc((size_t)D * D, sizeof(double));
+    for (int i = 0; i < data->n; ++i) {
+        const double* x = &data->x[(size_t)i * D];
+        const double* m = &cmean[data->label[i] * D];
+        for (int a = 0; a < D; ++a)
+            for (int b = 0; b < D; ++b) sw[a * D + b] += (x[a] - m[a]) * (x[b] - m[b]) / data->n;
+    }
+    for (int c = 0; c < L; ++c) {
+        const double* m = &cmean[c * D];
+        for (int a = 0; a < D; ++a)
+            for (int b = 0; b < D; ++b)
+                sb[a * D + b] += (double)count[c] * (m[a] - mean[a]) * (m[b] - mean[b]) / data->n;
+    }
+
+    // 표본이 적으면 Sw가 특이 행렬이므로 대각 보정
+    double trace = 0.0;
+    for (int a = 0; a < D; ++a) trace += sw[a * D + a];
+    double reg = FIT_LDA_REG * (trace > 0 ? trace / D : 1.0);
+    for (int a = 0; a < D; ++a) sw[a * D + a] += reg;
+
+    // whitening P = diag(1/sqrt(l)) U^T (Sw = U diag(l) U^T)
+    double* eval = (double*)malloc(sizeof(double) * D);
+    double* evec = (double*)malloc(sizeof(double) * D * D);
+    _jacobi_eigen(sw, D, eval, evec);
+    double* p = evec; // 행 i를 1/sqrt(eval[i])로 scale
+    for (int i = 0; i < D; ++i) {
+        double s = 1.0 / sqrt(eval[i] > reg ? eval[i] : reg);
+        for (int k = 0; k < D; ++k) p[i * D + k] *= s;
+    }
+
+    // Sb' = P Sb P^T
+    double* tmp = (double*)calloc((size_t)D * D, sizeof(double));
+    double* sbw = (double*)calloc((size_t)D * D, sizeof(double));
+    for (int i = 0; i < D; ++i)
+        for (int k = 0; k < D; ++k) {
+            double acc = 0.0;
+            for (int j = 0; j < D; ++j) acc += p[i * D + j] * sb[j * D + k];
+            tmp[i * D + k] = acc;
+        }
+    for (int i = 0; i < D; ++i)
+        for (int k = 0; k < D; ++k) {
+            double acc = 0.0;
+            for (int j = 0; j < D; ++j) acc += tmp[i * D + j] * p[k * D + j];
+            sbw[i * D + k] = acc;
+        }
+
+    double* beval = (double*)malloc(sizeof(double) * D);
+    double* bevec = (double*)malloc(sizeof(double) * D * D);
+    _jacobi_eigen(sbw, D, beval, bevec);
+    printf("LDA: top discriminant eigenvalues");
+    for (int i = 0; i < out_dim && i < 4; ++i) printf(" %.3g", beval[i]);
+    printf("\n");
+
+    // PLDA: 화자 평균의 분산 = 화자 간 분산 + 화자 내 분산 / 화자당 표본 수 (whitening 후 1 / n)
+    if (psi) {
+        double noise = (double)L / data->n;
+        for (int i = 0; i < out_dim; ++i) {
+            psi[i] = (beval[i] > noise) ? beval[i] - noise : 0.0;
+        }
+    }
+
+    // W = V^T P (행 i: 판별 방향 i)
+    for (int i = 0; i < out_dim; ++i)
+        for (int k = 0; k < D; ++k) {
+            double acc = 0.0;
+            for (int j = 0; j < D; ++j) acc += bevec[i * D + j] * p[j * D + k];
+            w[i * D + k] = acc;
+        }
+
+    free(cmean); free(count); free(sw); free(sb); free(eval); free(evec);
+    free(tmp); free(sbw); free(beval); free(bevec);
+    return out_dim;
+}
+
+// sv_projection.h 형식으로 저장 (psi: PLDA만, 그 외 NULL)
+static int _write_projection(const char* path, int in_dim, int out_dim, int flags,
+                             const double* mean, const double* w, const double* psi) {
+    sv_projection_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = SV_PROJ_MAGIC;
+    header.version = SV_PROJ_VERSION;
+    header.flags = (uint16_t)flags;
+    header.in_dim = (uint16_t)in_dim;
+    header.out_dim = (uint16_t)out_dim;
+    header.mean_offset = SV_PROJ_HEADER_SIZE;
+    header.matrix_offset = (header.mean_offset + sizeof(float) * in_dim + SV_PROJ_ALIGN - 1) &
+                           ~(uint32_t)(SV_PROJ_ALIGN - 1);
+    header.total_size = header.matrix_offset + sizeof(float) * out_dim * in_dim;
+    if (psi) {
+        header.psi_offset = header.total_size;
+        header.total_size += sizeof(float) * out_dim;
+    }
+
+    unsigned char* image = (unsigned char*)calloc(1, header.total_size);
+    memcpy(image, &header, sizeof(header));
+    float* fmean = (float*)(image + header.mean_offset);
+    float* fmat = (float*)(image + header.matrix_offset);
+    for (int d = 0; d < in_dim; ++d) fmean[d] = (float)mean[d];
+    for (int i = 0; i < out_dim * in_dim; ++i) fmat[i] = (float)w[i];
+    if (psi) {
+        float* fpsi = (float*)(image + header.psi_offset);
+        for (int i = 0; i < out_dim; ++i) fpsi[i] = (float)psi[i];
+    }
+
+    FILE* f = fopen(path, "wb");
+    if (!f || fwrite(image, 1, header.total_size, f) != header.total_size) {
+        printf("cannot write %s\n", path);
+        if (f) fclose(f);
+        free(image);
+        return -1;
+    }
+    fclose(f);
+    free(image);
+    return 0;
+}
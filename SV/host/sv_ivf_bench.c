@@ -0,0 +1,176 @@
+/*
+ * IVF 색인 recall / 지연 시간 벤치마크 (host 전용)
+ *
+ * 여러 사이트의 화자 목록을 합친 형태(사이트별 공통 성분 + 화자 성분)의 합성 임베딩으로
+ * 화자 수를 늘려 가며, 전체 선형 탐색(ivf_lists = 0)과 IVF 색인(ivf_lists = sqrt(N))의
+ * 판정 시간과 recall(선형 탐색 1위/상위 5위 후보를 IVF가 같이 찾은 비율)을 비교합니다.
+ * 쿼리는 등록된 화자의 임베딩에 잡음을 더한 것입니다.
+ *
+ * 빌드 (SV/host 에서):
+ *   gcc -O2 -I../main/include sv_ivf_bench.c ../main/speaker_verifier.c ../main/sv_kernels.c ../main/sv_store.c ../main/sv_pool.c ../main/sv_backend.c ../main/sv_ivf.c -lm -pthread -o sv_ivf_bench
+ * 실행:
+ *   ./sv_ivf_bench [최대 화자 수 (기본 8192)] [ivf_probe (기본 SV_DEFAULT_IVF_PROBE)]
+ */
+
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h> // dup, dup2
+
+#include "speaker_verifier.h"
+
+
+//=========================== define ===========================
+#define BENCH_MIN_SPEAKERS 512
+#define BENCH_NUM_SITES 64           // 사이트 수 (사이트마다 공통 성분)
+#define BENCH_NUM_QUERIES 500
+#define BENCH_TOPK 5
+#define BENCH_QUERY_NOISE 0.6f       // 쿼리 잡음 (화자 성분 대비)
+
+
+//=========================== variables ===========================
+static uint32_t rng_state = 2024u;
+
+
+//=========================== prototypes ==========================
+static float _gauss(void);
+static void _make_roster(float* emb, int n);
+static sv_handle_t* _load(const float* emb, int n, int ivf_lists, int ivf_probe);
+static double _now_us(void);
+
+
+//=========================== public ==============================
+int main(int argc, char** argv) {
+    int max_speakers = (argc > 1) ? atoi(argv[1]) : 8192;
+    int probe = (argc > 2) ? atoi(argv[2]) : SV_DEFAULT_IVF_PROBE;
+
+    float* emb = (float*)malloc(sizeof(float) * SV_EMBEDDING_DIM * max_speakers);
+    float* queries = (float*)malloc(sizeof(float) * SV_EMBEDDING_DIM * BENCH_NUM_QUERIES);
+    if (!emb || !queries) {
+        return -1;
+    }
+    _make_roster(emb, max_speakers);
+
+    printf("\n=== IVF vs linear scan (probe %d, %d queries) ===\n", probe, BENCH_NUM_QUERIES);
+    printf("%8s %6s %12s %12s %8s %10s %10s\n",
+           "speakers", "lists", "linear us", "ivf us", "speedup", "recall@1", "recall@5");
+
+    for (int n = BENCH_MIN_SPEAKERS; n <= max_speakers; n *= 2) {
+        int lists = (int)sqrtf((float)n);
+        for (int q = 0; q < BENCH_NUM_QUERIES; ++q) {
+            const float* src = &emb[(size_t)(rng_state % n) * SV_EMBEDDING_DIM];
+            for (int d = 0; d < SV_EMBEDDING_DIM; ++d) {
+                queries[q * SV_EMBEDDING_DIM + d] = src[d] + BENCH_QUERY_NOISE * _gauss();
+            }
+        }
+
+        sv_handle_t* linear = _load(emb, n, 0, probe);
+        sv_handle_t* ivf = _load(emb, n, lists, probe);
+        if (!linear || !ivf) {
+            printf("init failed\n");
+            return -1;
+        }
+
+        // recall: 선형 탐색 상위 후보를 IVF 후보가 포함하는 비율
+        int hit1 = 0, hit5 = 0;
+        for (int q = 0; q < BENCH_NUM_QUERIES; ++q) {
+            sv_candidate_t ref[BENCH_TOPK], got[BENCH_TOPK];
+            sv_system_verify_topk(linear, &queries[q * SV_EMBEDDING_DIM], ref, BENCH_TOPK);
+            sv_system_verify_topk(ivf, &queries[q * SV_EMBEDDING_DIM], got, BENCH_TOPK);
+            hit1 += (ref[0].speaker_id == got[0].speaker_id);
+            for (int a = 0; a < BENCH_TOPK; ++a) {
+                for (int b = 0; b < BENCH_TOPK; ++b) {
+                    if (ref[a].speaker_id == got[b].speaker_id) {
+                        hit5++;
+                        break;
+                    }
+                }
+            }
+        }
+
+        double t0 = _now_us();
+        for (int q = 0; q < BENCH_NUM_QUERIES; ++q) {
+            sv_system_verify(linear, &queries[q * SV_EMBEDDING_DIM]);
+        }
+        double t_linear = (_now_us() - t0) / BENCH_NUM_QUERIES;
+        t0 = _now_us();
+        for (int q = 0; q < BENCH_NUM_QUERIES; ++q) {
+            sv_system_verify(ivf, &queries[q * SV_EMBEDDING_DIM]);
+        }
+        double t_ivf = (_now_us() - t0) / BENCH_NUM_QUERIES;
+
+        printf("%8d %6d %12.2f %12.2f %7.2fx %9.1f%% %9.1f%%\n", n, lists, t_linear, t_ivf,
+               t_linear / t_ivf, 100.0 * hit1 / BENCH_NUM_QUERIES,
+               100.0 * hit5 / (BENCH_NUM_QUERIES * BENCH_TOPK));
+
+        sv_system_deinit(linear);
+        sv_system_deinit(ivf);
+    }
+
+    free(emb);
+    free(queries);
+    return 0;
+}
+
+
+//=========================== private ==============================
+// xorshift32 + Box-Muller 표준 정규 분포
+static float _gauss(void) {
+    float u[2];
+    for (int i = 0; i < 2; ++i) {
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 17;
+        rng_state ^= rng_state << 5;
+        u[i] = ((float)(rng_state >> 8) + 1.0f) / 16777217.0f;
+    }
+    return sqrtf(-2.0f * logf(u[0])) * cosf(6.2831853f * u[1]);
+}
+
+// 사이트 공통 성분 + 화자 성분 (같은 사이트 화자끼리 더 가까움)
+static void _make_roster(float* emb, int n) {
+    float* sites = (float*)malloc(sizeof(float) * SV_EMBEDDING_DIM * BENCH_NUM_SITES);
+    for (int i = 0; i < SV_EMBEDDING_DIM * BENCH_NUM_SITES; ++i) {
+        sites[i] = _gauss();
+    }
+    for (int s = 0; s < n; ++s) {
+        const float* site = &sites[(s % BENCH_NUM_SITES) * SV_EMBEDDING_DIM];
+        for (int d = 0; d < SV_EMBEDDING_DIM; ++d) {
+            emb[(size_t)s * SV_EMBEDDING_DIM + d] = site[d] + _gauss();
+        }
+    }
+    free(sites);
+}
+
+// 화자 n명을 등록한 handle (등록 로그는 숨김)
+static sv_handle_t* _load(const float* emb, int n, int ivf_lists, int ivf_probe) {
+    sv_config_t config = {0};
+    config.algorithm = POST_NONE;
+    config.ivf_lists = ivf_lists;
+    config.ivf_probe = ivf_probe;
+
+    fflush(stdout);
+    int saved = dup(1);
+    FILE* devnull = freopen("/dev/null", "w", stdout);
+    sv_handle_t* handle = sv_system_init(&config);
+    for (int s = 0; handle && s < n; ++s) {
+        sv_system_register(handle, (float*)&emb[(size_t)s * SV_EMBEDDING_DIM], "bench");
+    }
+    if (handle && ivf_lists > 0) {
+        sv_system_build_index(handle); // 등록 중 자동 생성된 색인을 전체 화자로 다시 생성
+    }
+    fflush(stdout);
+    if (devnull) {
+        dup2(saved, 1);
+    }
+    close(saved);
+    return handle;
+}
+
+static double _now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
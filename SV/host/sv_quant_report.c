@@ -0,0 +1,130 @@
+/*
+ * int8 DB 모드 정확도 리포트 (host 전용)
+ *
+ * sv_database.h의 사전 등록 임베딩을 float DB와 int8 DB에 각각 로드한 뒤,
+ * 같은 쿼리(등록 임베딩 + 가우시안 노이즈)를 두 경로로 판정하여 점수 차이를 출력합니다.
+ *
+ * 빌드 (SV/host 에서):
+ *   gcc -O2 -I../main/include sv_quant_report.c ../main/speaker_verifier.c ../main/sv_kernels.c ../main/sv_store.c ../main/sv_pool.c ../main/sv_backend.c ../main/sv_ivf.c -lm -pthread -o sv_quant_report
+ */
+
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "speaker_verifier.h"
+
+
+//=========================== define ===========================
+#define REPORT_THRESHOLD 0.5f   // 판정 일치율 계산용 임계값
+#define NUM_NOISE_LEVELS 4
+
+
+//=========================== variables ===========================
+// 쿼리에 더할 노이즈의 상대 크기 (정규화된 임베딩 기준 L2 norm)
+static const float noise_levels[NUM_NOISE_LEVELS] = {0.0f, 0.3f, 0.6f, 1.0f};
+
+static uint32_t rng_state = 12345u;
+
+
+//=========================== prototypes ==========================
+static float _randn(void);
+static void _make_query(const float* base, float noise, float* out);
+
+
+//=========================== public ==============================
+int main(void) {
+    sv_config_t cfg_f32 = {0};
+    cfg_f32.threshold = REPORT_THRESHOLD;
+    cfg_f32.algorithm = POST_NONE;
+    cfg_f32.db_format = SV_DB_FLOAT;
+
+    sv_config_t cfg_q8 = cfg_f32;
+    cfg_q8.db_format = SV_DB_INT8;
+
+    sv_handle_t* h_f32 = sv_system_init(&cfg_f32);
+    sv_handle_t* h_q8 = sv_system_init(&cfg_q8);
+    if (!h_f32 || !h_q8) {
+        printf("init failed\n");
+        return -1;
+    }
+
+    const sv_db_t* db_f32 = atomic_load(&h_f32->db);
+    int n = db_f32->num_speakers;
+    float query[SV_EMBEDDING_DIM];
+    float* ref_scores = (float*)malloc(sizeof(float) * n);
+
+    printf("\n=== int8 DB accuracy report (%d speakers, dim %d) ===\n", n, SV_EMBEDDING_DIM);
+    printf("bytes/speaker: float %u, int8 %u (pool row + scale)\n\n",
+           (unsigned)db_f32->row_bytes,
+           (unsigned)(atomic_load(&h_q8->db)->row_bytes + sizeof(float)));
+    printf("%-6s %-12s %-12s %-12s %-10s %-10s\n",
+           "noise", "mean|d|all", "max|d|all", "max|d|best", "top1 agree", "dec agree");
+
+    for (int l = 0; l < NUM_NOISE_LEVELS; ++l) {
+        double sum_abs = 0.0;
+        float max_abs = 0.0f;
+        float max_best = 0.0f;
+        int top1_agree = 0;
+        int dec_agree = 0;
+
+        for (int q = 0; q < n; ++q) {
+            _make_query((const float*)sv_db_row(db_f32, q), noise_levels[l], query);
+
+            sv_result_t r_f32 = sv_system_verify(h_f32, query);
+            memcpy(ref_scores, h_f32->session->scores, sizeof(float) * n);
+            sv_result_t r_q8 = sv_system_verify(h_q8, query);
+
+            for (int i = 0; i < n; ++i) {
+                float d = fabsf(h_q8->session->scores[i] - ref_scores[i]);
+                sum_abs += d;
+                if (d > max_abs) max_abs = d;
+            }
+
+            float d_best = fabsf(r_q8.best_score - r_f32.best_score);
+            if (d_best > max_best) max_best = d_best;
+            if (r_q8.raw_speaker_id == r_f32.raw_speaker_id) dec_agree++;
+
+            // 임계값과 무관한 top-1 비교
+            int best_f32 = 0, best_q8 = 0;
+            for (int i = 1; i < n; ++i) {
+                if (ref_scores[i] > ref_scores[best_f32]) best_f32 = i;
+                if (h_q8->session->scores[i] > h_q8->session->scores[best_q8]) best_q8 = i;
+            }
+            if (best_f32 == best_q8) top1_agree++;
+        }
+
+        printf("%-6.2f %-12.6f %-12.6f %-12.6f %3d/%-6d %3d/%-6d\n",
+               noise_levels[l], sum_abs / ((double)n * n), max_abs, max_best,
+               top1_agree, n, dec_agree, n);
+    }
+
+    free(ref_scores);
+    sv_system_deinit(h_f32);
+    sv_system_deinit(h_q8);
+    return 0;
+}
+
+
+//=========================== private ==============================
+// xorshift32 + Box-Muller (재현 가능한 노이즈)
+static float _randn(void) {
+    float u[2];
+    for (int k = 0; k < 2; ++k) {
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 17;
+        rng_state ^= rng_state << 5;
+        u[k] = ((rng_state >> 8) + 0.5f) / 16777216.0f;
+    }
+    return sqrtf(-2.0f * logf(u[0])) * cosf(6.28318531f * u[1]);
+}
+
+// base(단위 벡터)에 L2 norm이 noise인 가우시안 노이즈를 더함
+static void _make_query(const float* base, float noise, float* out) {
+    float sigma = noise / sqrtf((float)SV_EMBEDDING_DIM);
+    for (int i = 0; i < SV_EMBEDDING_DIM; ++i) {
+        out[i] = base[i] + sigma * _randn();
+    }
+}
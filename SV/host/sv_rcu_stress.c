@@ -0,0 +1,181 @@
+/*
+ * DB snapshot 교체 stress test (host 전용)
+ *
+ * 판정 thread 하나가 sv_system_verify를 반복하는 동안 writer thread가 등록/삭제를 계속하고
+ * (저장소 journal이 차면 compaction까지 발생) 다른 thread가 이름 조회로 snapshot을 계속 pin하여,
+ * 판정 지연 시간 분포를 writer가 없을 때와 비교합니다.
+ * 등록/삭제가 판정을 막지 않으면 두 경우의 p99가 비슷해야 합니다.
+ *
+ * 빌드 (SV/host 에서):
+ *   gcc -O2 -I../main/include sv_rcu_stress.c ../main/speaker_verifier.c ../main/sv_kernels.c ../main/sv_store.c ../main/sv_pool.c ../main/sv_backend.c ../main/sv_ivf.c -lm -pthread -o sv_rcu_stress
+ * 실행:
+ *   ./sv_rcu_stress [저장소 파일 (기본 sv_rcu_stress.bin)]
+ */
+
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "speaker_verifier.h"
+#include "sv_store.h"
+
+
+//=========================== define ===========================
+#define STRESS_VERIFY_COUNT 20000   // 측정할 판정 횟수 (각 단계)
+#define STRESS_LOOKUP_ID 0          // 조회 thread가 반복 조회할 화자 ID
+
+
+//=========================== variables ===========================
+static sv_handle_t* sv_handle = NULL;
+static atomic_bool writers_stop;
+static atomic_int writer_ops;
+static atomic_int lookup_ops;
+
+static float queries[SV_MAX_TOPK][SV_EMBEDDING_DIM];
+static int num_queries = 0;
+
+
+//=========================== prototypes ==========================
+static void* _writer_task(void* arg);
+static void* _lookup_task(void* arg);
+static void _run_verify(const char* label);
+static double _now_us(void);
+static int _cmp_double(const void* a, const void* b);
+
+
+//=========================== public ==============================
+int main(int argc, char** argv) {
+    const char* store_name = (argc > 1) ? argv[1] : "sv_rcu_stress.bin";
+    remove(store_name);
+
+    sv_config_t config = {0};
+    config.algorithm = POST_MAJORITY_VOTING;
+    config.store_name = store_name;
+
+    sv_handle = sv_system_init(&config);
+    if (!sv_handle) {
+        printf("init failed\n");
+        return -1;
+    }
+
+    // 쿼리: 사전 등록 화자의 임베딩 (저장소 record를 복사, 이후 compaction과 무관)
+    const sv_db_t* db = atomic_load(&sv_handle->db);
+    num_queries = (db->num_speakers < SV_MAX_TOPK) ? db->num_speakers : SV_MAX_TOPK;
+    for (int i = 0; i < num_queries; ++i) {
+        memcpy(queries[i], sv_db_row(db, i), sizeof(float) * SV_EMBEDDING_DIM);
+    }
+    if (num_queries == 0) {
+        printf("no preregistered speakers\n");
+        sv_system_deinit(sv_handle);
+        return -1;
+    }
+
+    printf("\n=== DB snapshot stress (%d speakers, store capacity %d) ===\n",
+           db->num_speakers, sv_handle->store->capacity);
+    printf("%-10s %-10s %-10s %-10s %-10s %-10s\n", "phase", "verify", "p50 us", "p99 us", "max us", "writes");
+
+    // 1. writer 없이 기준 지연 시간
+    _run_verify("idle");
+
+    // 2. writer가 등록/삭제를 반복하고 다른 reader가 snapshot을 pin하는 동안
+    pthread_t writer, lookup;
+    atomic_store(&writers_stop, false);
+    atomic_store(&writer_ops, 0);
+    atomic_store(&lookup_ops, 0);
+    pthread_create(&writer, NULL, _writer_task, NULL);
+    pthread_create(&lookup, NULL, _lookup_task, NULL);
+    _run_verify("churn");
+    atomic_store(&writers_stop, true);
+    pthread_join(writer, NULL);
+    pthread_join(lookup, NULL);
+
+    printf("lookups during churn: %d, store generation after churn: %u\n",
+           atomic_load(&lookup_ops), (unsigned)sv_handle->store->generation);
+
+    sv_system_deinit(sv_handle);
+    remove(store_name);
+    return 0;
+}
+
+
+//=========================== private ==============================
+// 판정 thread: STRESS_VERIFY_COUNT회 판정하며 1회당 지연 시간을 기록
+static void _run_verify(const char* label) {
+    double* lat = (double*)malloc(sizeof(double) * STRESS_VERIFY_COUNT);
+    int ops_start = atomic_load(&writer_ops);
+    int mismatches = 0;
+
+    for (int i = 0; i < STRESS_VERIFY_COUNT; ++i) {
+        int q = i % num_queries;
+        double t0 = _now_us();
+        sv_result_t r = sv_system_verify(sv_handle, queries[q]);
+        lat[i] = _now_us() - t0;
+
+        // 사전 등록 화자는 삭제되지 않으므로 항상 자기 자신으로 판정되어야 함
+        if (r.raw_speaker_id != q) {
+            mismatches++;
+        }
+    }
+
+    qsort(lat, STRESS_VERIFY_COUNT, sizeof(double), _cmp_double);
+    printf("%-10s %-10d %-10.1f %-10.1f %-10.1f %-10d\n", label, STRESS_VERIFY_COUNT,
+           lat[STRESS_VERIFY_COUNT / 2], lat[STRESS_VERIFY_COUNT * 99 / 100],
+           lat[STRESS_VERIFY_COUNT - 1], atomic_load(&writer_ops) - ops_start);
+    if (mismatches) {
+        printf("  [!] %d mismatched decisions\n", mismatches);
+    }
+    free(lat);
+}
+
+// writer thread: 임의의 임베딩을 등록한 뒤 바로 삭제하기를 반복
+static void* _writer_task(void* arg) {
+    (void)arg;
+    uint32_t rng = 1234u;
+    float emb[SV_EMBEDDING_DIM];
+
+    while (!atomic_load(&writers_stop)) {
+        for (int d = 0; d < SV_EMBEDDING_DIM; ++d) {
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+            emb[d] = (float)(rng >> 8) / 16777216.0f - 0.5f;
+        }
+        if (sv_system_register(sv_handle, emb, "stress") != SV_SUCCESS) {
+            continue;
+        }
+        // 방금 등록한 ID (next_speaker_id는 이 thread만 변경)
+        sv_system_unregister(sv_handle, sv_handle->next_speaker_id - 1);
+        atomic_fetch_add(&writer_ops, 1);
+    }
+    return NULL;
+}
+
+// 조회 thread: 판정 thread와 별도로 snapshot을 계속 pin/unpin (compaction 대기를 유발)
+static void* _lookup_task(void* arg) {
+    (void)arg;
+    char name[SV_MAX_NAME_LEN];
+
+    while (!atomic_load(&writers_stop)) {
+        if (sv_system_get_speaker_name(sv_handle, STRESS_LOOKUP_ID, name) != SV_SUCCESS) {
+            printf("  [!] lookup of speaker %d failed\n", STRESS_LOOKUP_ID);
+        }
+        atomic_fetch_add(&lookup_ops, 1);
+    }
+    return NULL;
+}
+
+static double _now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static int _cmp_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
@@ -0,0 +1,181 @@
+/*
+ * 다중 세션 판정 벤치마크 (host 전용)
+ *
+ * 하나의 DB를 공유하는 세션 여러 개를 만들어, 세션별 sv_session_verify() 호출과
+ * sv_verify_sessions() 배치 판정의 소요 시간을 비교하고 두 경로의 결과가 같은지 확인합니다.
+ * 화자 수를 두 배씩 늘려 DB 행렬이 L2 캐시 안인 경우와 밖인 경우를 함께 측정합니다.
+ * (192차원 float 행 768B: 1024명 0.75MB, 8192명 6MB)
+ *
+ * 빌드 (SV/host 에서):
+ *   make sv_session_bench
+ * 실행:
+ *   ./sv_session_bench [최대 화자 수 (기본 16384)]
+ */
+
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h> // dup, dup2
+
+#include "speaker_verifier.h"
+
+
+//=========================== define ===========================
+#define BENCH_NUM_SESSIONS SV_MAX_BATCH  // 동시에 판정할 스트림 수
+#define BENCH_MIN_SPEAKERS 256           // 첫 측정 화자 수 (두 배씩 증가)
+#define BENCH_ROW_READS 20000000         // 측정 1회의 양 (세션 x 화자 행 읽기, 반복 횟수 결정)
+#define BENCH_TRIALS 5                   // 경로별 측정 횟수 (최소값 사용, 다른 프로세스의 간섭 제외)
+
+
+//=========================== variables ===========================
+static uint32_t rng_state = 4321u;
+
+
+//=========================== prototypes ==========================
+static void _random_embedding(float* out);
+static sv_handle_t* _load(int n);
+static void _unload(sv_handle_t* handle);
+static double _now_us(void);
+
+
+//=========================== public ==============================
+int main(int argc, char** argv) {
+    int max_speakers = (argc > 1) ? atoi(argv[1]) : 16384;
+
+    float queries[BENCH_NUM_SESSIONS][SV_EMBEDDING_DIM];
+    float* query_ptrs[BENCH_NUM_SESSIONS];
+    for (int i = 0; i < BENCH_NUM_SESSIONS; ++i) {
+        _random_embedding(queries[i]);
+        query_ptrs[i] = queries[i];
+    }
+
+    printf("\n=== multi-session verify (%d sessions) ===\n", BENCH_NUM_SESSIONS);
+    printf("%8s %8s %14s %14s %8s %10s\n",
+           "speakers", "DB KB", "per-session us", "batched us", "speedup", "mismatch");
+
+    for (int n = BENCH_MIN_SPEAKERS; n <= max_speakers; n *= 2) {
+        sv_handle_t* handle = _load(n);
+        if (!handle) {
+            printf("init failed\n");
+            return -1;
+        }
+
+        // 같은 handle을 공유하는 세션 생성 (DB는 다시 로드하지 않음)
+        sv_session_t* sessions[BENCH_NUM_SESSIONS];
+        for (int i = 0; i < BENCH_NUM_SESSIONS; ++i) {
+            sessions[i] = sv_session_create(handle);
+            if (!sessions[i]) {
+                printf("session create failed\n");
+                return -1;
+            }
+        }
+        const sv_db_t* db = atomic_load(&handle->db);
+
+        // 1. 결과 일치 확인 (두 경로는 같은 커널 누산 순서를 쓰므로 점수까지 같아야 함)
+        sv_result_t single[BENCH_NUM_SESSIONS];
+        sv_result_t batch[BENCH_NUM_SESSIONS];
+        for (int i = 0; i < BENCH_NUM_SESSIONS; ++i) {
+            single[i] = sv_session_verify(sessions[i], queries[i], NULL, 0);
+        }
+        sv_verify_sessions(sessions, query_ptrs, BENCH_NUM_SESSIONS, batch);
+
+        int mismatches = 0;
+        for (int i = 0; i < BENCH_NUM_SESSIONS; ++i) {
+            if (single[i].raw_speaker_id != batch[i].raw_speaker_id ||
+                single[i].second_speaker_id != batch[i].second_speaker_id ||
+                single[i].best_score != batch[i].best_score) {
+                mismatches++;
+            }
+        }
+
+        // 2. 소요 시간 비교 (두 경로를 번갈아 측정)
+        int rounds = BENCH_ROW_READS / (BENCH_NUM_SESSIONS * db->num_speakers) + 1;
+        double t_single = 1e30, t_batch = 1e30;
+        for (int t = 0; t < BENCH_TRIALS; ++t) {
+            double t0 = _now_us();
+            for (int r = 0; r < rounds; ++r) {
+                for (int i = 0; i < BENCH_NUM_SESSIONS; ++i) {
+                    sv_session_verify(sessions[i], queries[i], NULL, 0);
+                }
+            }
+            double dt = (_now_us() - t0) / rounds;
+            if (dt < t_single) t_single = dt;
+
+            t0 = _now_us();
+            for (int r = 0; r < rounds; ++r) {
+                sv_verify_sessions(sessions, query_ptrs, BENCH_NUM_SESSIONS, batch);
+            }
+            dt = (_now_us() - t0) / rounds;
+            if (dt < t_batch) t_batch = dt;
+        }
+
+        printf("%8d %8u %14.1f %14.1f %7.2fx %10d\n", db->num_speakers,
+               (unsigned)((size_t)db->num_speakers * db->row_bytes / 1024), t_single, t_batch,
+               t_single / t_batch, mismatches);
+
+        for (int i = 0; i < BENCH_NUM_SESSIONS; ++i) {
+            sv_session_destroy(sessions[i]);
+        }
+        _unload(handle);
+    }
+    return 0;
+}
+
+
+//=========================== private ==============================
+// xorshift32 균등 분포 [-0.5, 0.5)
+static void _random_embedding(float* out) {
+    for (int d = 0; d < SV_EMBEDDING_DIM; ++d) {
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 17;
+        rng_state ^= rng_state << 5;
+        out[d] = (float)(rng_state >> 8) / 16777216.0f - 0.5f;
+    }
+}
+
+// 사전 등록 화자를 포함해 화자 n명이 있는 RAM DB handle (등록 로그는 숨김)
+static sv_handle_t* _load(int n) {
+    sv_config_t config = {0};
+    config.algorithm = POST_NONE;
+
+    fflush(stdout);
+    int saved = dup(1);
+    FILE* devnull = freopen("/dev/null", "w", stdout);
+    sv_handle_t* handle = sv_system_init(&config);
+    float emb[SV_EMBEDDING_DIM];
+    while (handle && atomic_load(&handle->db)->num_speakers < n) {
+        _random_embedding(emb);
+        if (sv_system_register(handle, emb, "bench") != SV_SUCCESS) {
+            sv_system_deinit(handle);
+            handle = NULL;
+        }
+    }
+    fflush(stdout);
+    if (devnull) {
+        dup2(saved, 1);
+    }
+    close(saved);
+    return handle;
+}
+
+// deinit 로그도 표 사이에 섞이지 않도록 숨김
+static void _unload(sv_handle_t* handle) {
+    fflush(stdout);
+    int saved = dup(1);
+    FILE* devnull = freopen("/dev/null", "w", stdout);
+    sv_system_deinit(handle);
+    fflush(stdout);
+    if (devnull) {
+        dup2(saved, 1);
+    }
+    close(saved);
+}
+
+static double _now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
@@ -7,6 +7,8 @@
 #include "send_data.h"
 #include "lcd_manager.h"
 #include "vision_provider.h"
+#include "model_manager.h"
+#include "speaker_verifier.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -22,6 +24,8 @@
 
 //=========================== prototypes ==========================
 void _init_nvs(void);
+// 화자 재임베딩 callback (sv_embed_fn_t): 현재 모델로 등록 특징의 임베딩 계산
+sv_status_t _embed_with_model(void* ctx, const float* features, int num_frames, int num_bins, float* embedding);
 sv_config_t my_config;
 sv_handle_t* sv_system = sv_system_init(&my_config);
 //=========================== public ==============================
@@ -53,7 +57,48 @@ void app_main() {
     xTaskCreatePinnedToCore(state_controller_task, "state_controller_task", 1024 * 5, NULL, 5, NULL, 0);
 }
 
+void start_sv_reembed(void) {
+    size_t length;
+    const uint8_t* model = get_model_data(&length);
+    if (!model) {
+        ESP_LOGE(APP_MAIN_TAG, "No model loaded, speaker DB unchanged");
+        return;
+    }
+
+    // 재임베딩 결과가 DB 행 크기와 맞아야 함 (다른 차원의 모델은 handle을 다시 초기화)
+    if (sv_system_check_model(sv_system, get_model_output_size()) != SV_SUCCESS) {
+        ESP_LOGE(APP_MAIN_TAG, "Speaker DB cannot follow the model swap");
+        return;
+    }
+
+    // 이전 모델로 등록된 화자는 판정에서 빠지고, 재임베딩이 끝나는 대로 다시 판정됨
+    if (sv_system_set_model(sv_system, sv_model_hash(model, length)) != SV_SUCCESS) {
+        ESP_LOGE(APP_MAIN_TAG, "Speaker DB cannot follow the model swap");
+        return;
+    }
+    xTaskCreatePinnedToCore(sv_reembed_task, "sv_reembed_task", 1024 * 8, NULL, tskIDLE_PRIORITY + 1, NULL, 1);
+}
+
+//=========================== tasks ===============================
+void sv_reembed_task(void* arg) {
+    // 화자 하나씩: 판정 task보다 낮은 우선순위로 남는 CPU에서만 실행
+    int remaining;
+    do {
+        remaining = sv_system_migrate_step(sv_system, _embed_with_model, NULL);
+        vTaskDelay(pdMS_TO_TICKS(10));
+    } while (remaining > 0);
+
+    ESP_LOGI(APP_MAIN_TAG, "Speaker DB re-embedding complete");
+    vTaskDelete(NULL);
+}
+
 //=========================== private ==============================
+sv_status_t _embed_with_model(void* ctx, const float* features, int num_frames, int num_bins, float* embedding) {
+    (void)ctx;
+    return model_embed_features(features, num_frames, num_bins, embedding, sv_system->embedding_dim) ?
+           SV_SUCCESS : SV_ERROR;
+}
+
 void _init_nvs(void)
 {
     /* Initialize NVS. */
@@ -17,5 +17,12 @@
 
 
 //=========================== prototypes ===========================
+// 모델 교체(write_model_nvs 후 model_setup) 직후 호출: 화자 DB를 새 모델로 옮기는 재임베딩 task 시작
+void start_sv_reembed(void);
+
+
+//=========================== tasks ===========================
+// 화자 재임베딩 task (낮은 우선순위, 대기 화자가 없으면 종료)
+void sv_reembed_task(void* arg);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,60 @@
+#ifndef MEL_FBANK_H
+#define MEL_FBANK_H
+
+//=========================== header ==========================
+#include <stdint.h>
+
+/*
+ * mel filterbank (CSR)
+ *
+ * 삼각 filter를 파라미터로부터 init 때 생성합니다. (Kaldi 방식)
+ *   mel(f) = 1127 * ln(1 + f / 700), filter 중심은 [low_freq, high_freq]의 mel 축 등간격,
+ *   가중치는 mel 축에서 선형이며 양 끝 bin(가중치 0)은 저장하지 않음
+ * filter마다 0이 아닌 가중치만 하나의 배열에 이어 저장합니다.
+ *   filter b의 j번째 가중치 = weight[offset[b] + j]  (FFT bin first[b] + j, j < offset[b + 1] - offset[b])
+ * 삼각 filter에서는 FFT bin 하나가 최대 2개 filter에 속하므로 가중치 수는 2 * (fft_len / 2 + 1) 이하입니다.
+ */
+
+//=========================== define ===========================
+#define MEL_FBANK_TAG "mel_fbank"    // log tag
+
+
+//=========================== typedef ===========================
+typedef struct {
+    int num_filters;
+    int num_weights;
+    int32_t* first;     // [num_filters] filter의 첫 FFT bin
+    int32_t* offset;    // [num_filters + 1] weight 시작 위치
+    float* weight;      // [num_weights]
+} mel_fbank_t;
+
+
+//=========================== prototypes ===========================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 파라미터로 filterbank를 생성합니다. (블록 하나 할당, target: 내부 RAM)
+ *
+ * @param fbank 출력 (mel_fbank_free로 해제)
+ * @param num_filters mel filter 수 (예: 40, 80)
+ * @param fft_len FFT 길이 (FFT bin 0 ~ fft_len / 2)
+ * @param sample_rate 샘플링 주파수 (Hz)
+ * @param low_freq 가장 낮은 filter의 왼쪽 끝 (Hz)
+ * @param high_freq 가장 높은 filter의 오른쪽 끝 (Hz, sample_rate / 2 이하)
+ * @return 0: 성공, -1: 잘못된 파라미터 또는 할당 실패
+ */
+int mel_fbank_build(mel_fbank_t* fbank, int num_filters, int fft_len, int sample_rate,
+                    float low_freq, float high_freq);
+
+/**
+ * @brief mel_fbank_build로 할당한 메모리를 해제합니다.
+ */
+void mel_fbank_free(mel_fbank_t* fbank);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -5,10 +5,12 @@
 #include <float.h>
 #include <string.h>
 #include <stdint.h>
+#ifdef ESP_PLATFORM
 #include "esp_log.h"
 #include "esp_dsp.h"
 
 #include "mfcc_filters.h"
+#endif
 
 //FFT가 기존 mfcc.c/h는 1024를 기준으로 생성된 것인데, 여기서는 512 사용하기 때문에 수정 필요
 #define SAMPLE_RATE 16000
@@ -16,20 +18,68 @@
 #define FRAME_STEP 160
 #define FFT_LEN 512
 #define FRAME_LEN_PADDED FFT_LEN
-#define NUM_FBANK_BINS 80
+#define NUM_FBANK_BINS 80   // mel filter 수 (filterbank는 init 때 생성하므로 40 등으로 바꿔도 됨)
+#define MELSPEC_LOW_FREQ 300.0f    // mel filterbank 범위 (Hz)
+#define MELSPEC_HIGH_FREQ 8000.0f
 #define NUM_SPECTROGRAM_BINS (FFT_LEN / 2 + 1)  // 257
 
 #define AUDIO_BUFFER_LEN (SAMPLE_RATE * 3)  // 48000
 #define NUM_FRAMES ((AUDIO_BUFFER_LEN - FRAME_LEN) / FRAME_STEP + 1)  // 299
 #define NUM_MEL_BINS NUM_FBANK_BINS
 #define MELSPEC_OUTPUT_SIZE (NUM_FRAMES * NUM_MEL_BINS)
+
+// 고정소수점 front-end: 빌드 시 -DMELSPEC_FIXED_POINT=1이면 melspec_compute(스트리밍 포함)가 Q15 경로를 사용
+// (FPU가 느린 target용, float 경로 대비 오차는 host/melspec_q15_report로 측정)
+#ifndef MELSPEC_FIXED_POINT
+#define MELSPEC_FIXED_POINT 0
+#endif
+// float 경로에서 단일 pass kernel(melspec_compute_fused) 사용 여부 (0이면 단계별 melspec_compute_f32)
+#ifndef MELSPEC_FUSED
+#define MELSPEC_FUSED 1
+#endif
+// 1이면 fused kernel이 모든 mel을 power 영역에서 누산 (sqrt 생략, 근사: (Σ w|X|)² 대신 Σ w²|X|²)
+// bin별로 일정하지 않은 bias가 생기므로 이 특징으로 학습한 모델에만 사용
+// 0(exact)이면 가중치가 하나뿐인 filter에만 log(w|X|) = log(w) + 0.5·log(|X|²)를 적용
+#ifndef MELSPEC_FUSED_POWER_MEL
+#define MELSPEC_FUSED_POWER_MEL 0
+#endif
+
+// 스트리밍 log-mel: 3초 창(NUM_FRAMES)의 frame ring
+// 200ms hop(3200 샘플)마다 새로 완성된 20 frame만 계산 (창 전체 재계산 대비 약 15배 적음)
+// 프레임 경계는 스트림 시작 기준이므로, push한 샘플 수가 FRAME_STEP의 배수일 때
+// 창은 마지막 48000 샘플을 melspec_compute로 처음부터 계산한 결과와 같음 (batch 계산의 float 반올림 차이 제외)
+typedef struct {
+    const float *first;   // 오래된 frame부터 [first_frames][NUM_MEL_BINS] (ring 끝까지)
+    int first_frames;
+    const float *second;  // 이어지는 frame [second_frames][NUM_MEL_BINS] (ring 앞쪽, 없으면 NULL)
+    int second_frames;
+} melspec_window_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 int melspec_init(void);
 void melspec_deinit(void);
 void melspec_compute(const int16_t *audio_data, float *melspec_out);
+// 연속 num_frames개 frame (audio_data + f * FRAME_STEP) 일괄 계산, 출력 [num_frames][NUM_MEL_BINS]
+// float 경로는 두 frame을 FFT 한 번에 담아 계산 (등록, 3초 창 첫 채움 등)
+void melspec_compute_batch(const int16_t *audio_data, int num_frames, float *melspec_out);
+// 단계별 float 경로 (MELSPEC_FIXED_POINT=0, MELSPEC_FUSED=0일 때 melspec_compute가 사용)
+void melspec_compute_f32(const int16_t *audio_data, float *melspec_out);
+// 단일 pass float kernel: 변환+window 한 루프, 실수 분리 + power + magnitude + mel을 bin 루프 하나로 (작업 버퍼는 내부 RAM)
+void melspec_compute_fused(const int16_t *audio_data, float *melspec_out);
+// DC 제거 + Q15 window + int16 FFT(stage별 block floating point) + 정수 power/mel + table log2, 출력은 melspec_compute와 같은 log-mel (float)
+void melspec_compute_q15(const int16_t *audio_data, float *melspec_out);
 void normalize(float *melSpectrogram, int num_frames);
+
+// 스트림 상태 초기화 (새 스트림 시작, 창이 비워짐)
+void melspec_stream_reset(void);
+// 새 오디오 샘플을 추가하고 완성된 frame만 계산, 반환: 새로 계산한 frame 수
+int melspec_stream_push(const int16_t *samples, int num_samples);
+// 현재 창 (복사 없이 ring을 두 구간으로, 다음 push 전까지 유효), 창이 덜 찼으면 frame 수 합 < NUM_FRAMES
+melspec_window_t melspec_stream_window(void);
+// 현재 창을 연속 버퍼(예: 모델 입력 tensor)로 복사, 반환: frame 수
+int melspec_stream_copy(float *out);
 #ifdef __cplusplus
 }
 #endif
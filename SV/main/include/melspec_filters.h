@@ -1,21 +1,12 @@
 #ifndef MELSPEC_FILTERS_H
 #define MELSPEC_FILTERS_H
 
-/* Parameters: FRAME_LEN=512, FFT_LEN=512, NUM_FBANK_BINS=80, MAX_FILTER_LEN=14 */
+/* Parameters: FRAME_LEN=512, FFT_LEN=512 (mel filterbank는 mel_fbank_build로 init 때 생성) */
 
 /* Hann Window */
 #define WINDOW_FUNC {0.000000f, 0.000038f, 0.000151f, 0.000339f, 0.000602f, 0.000941f, 0.001355f, 0.001844f, 0.002408f, 0.003047f, 0.003760f, 0.004549f, 0.005412f, 0.006349f, 0.007361f, 0.008447f, 0.009607f, 0.010841f, 0.012149f, 0.013530f, 0.014984f, 0.016512f, 0.018112f, 0.019785f, 0.021530f, 0.023347f, 0.025236f, 0.027196f, 0.029228f, 0.031330f, 0.033504f, 0.035747f, 0.038060f, 0.040443f, 0.042895f, 0.045416f, 0.048005f, 0.050663f, 0.053388f, 0.056180f, 0.059039f, 0.061965f, 0.064957f, 0.068014f, 0.071136f, 0.074322f, 0.077573f, 0.080888f, 0.084265f, 0.087705f, 0.091208f, 0.094771f, 0.098396f, 0.102082f, 0.105827f, 0.109631f, 0.113495f, 0.117416f, 0.121396f, 0.125432f, 0.129524f, 0.133673f, 0.137876f, 0.142135f, 0.146447f, 0.150812f, 0.155230f, 0.159699f, 0.164221f, 0.168792f, 0.173414f, 0.178084f, 0.182803f, 0.187570f, 0.192384f, 0.197244f, 0.202150f, 0.207101f, 0.212096f, 0.217134f, 0.222215f, 0.227338f, 0.232501f, 0.237705f, 0.242949f, 0.248231f, 0.253551f, 0.258908f, 0.264302f, 0.269731f, 0.275194f, 0.280692f, 0.286222f, 0.291785f, 0.297379f, 0.303004f, 0.308658f, 0.314341f, 0.320053f, 0.325791f, 0.331555f, 0.337345f, 0.343159f, 0.348997f, 0.354858f, 0.360740f, 0.366644f, 0.372567f, 0.378510f, 0.384471f, 0.390449f, 0.396444f, 0.402455f, 0.408480f, 0.414519f, 0.420571f, 0.426635f, 0.432710f, 0.438795f, 0.444889f, 0.450991f, 0.457101f, 0.463218f, 0.469340f, 0.475466f, 0.481596f, 0.487729f, 0.493864f, 0.500000f, 0.506136f, 0.512271f, 0.518404f, 0.524534f, 0.530660f, 0.536782f, 0.542899f, 0.549009f, 0.555111f, 0.561205f, 0.567290f, 0.573365f, 0.579429f, 0.585481f, 0.591520f, 0.597545f, 0.603556f, 0.609551f, 0.615529f, 0.621490f, 0.627433f, 0.633356f, 0.639260f, 0.645142f, 0.651003f, 0.656841f, 0.662655f, 0.668445f, 0.674209f, 0.679947f, 0.685659f, 0.691342f, 0.696996f, 0.702621f, 0.708215f, 0.713778f, 0.719308f, 0.724806f, 0.730269f, 0.735698f, 0.741092f, 0.746449f, 0.751769f, 0.757051f, 0.762295f, 0.767499f, 0.772663f, 0.777785f, 0.782866f, 0.787904f, 0.792899f, 0.797850f, 0.802756f, 0.807616f, 0.812430f, 0.817197f, 0.821916f, 0.826586f, 0.831208f, 0.835780f, 0.840301f, 0.844770f, 0.849188f, 0.853553f, 0.857865f, 0.862124f, 0.866327f, 0.870476f, 0.874568f, 0.878604f, 0.882584f, 0.886505f, 0.890369f, 0.894173f, 0.897918f, 0.901604f, 0.905229f, 0.908792f, 0.912295f, 0.915735f, 0.919112f, 0.922427f, 0.925678f, 0.928864f, 0.931986f, 0.935044f, 0.938035f, 0.940961f, 0.943820f, 0.946612f, 0.949337f, 0.951995f, 0.954584f, 0.957105f, 0.959557f, 0.961940f, 0.964253f, 0.966496f, 0.968670f, 0.970772f, 0.972804f, 0.974764f, 0.976653f, 0.978470f, 0.980215f, 0.981888f, 0.983488f, 0.985016f, 0.986470f, 0.987851f, 0.989159f, 0.990393f, 0.991553f, 0.992639f, 0.993651f, 0.994588f, 0.995451f, 0.996240f, 0.996953f, 0.997592f, 0.998156f, 0.998645f, 0.999059f, 0.999398f, 0.999661f, 0.999849f, 0.999962f, 1.000000f, 0.999962f, 0.999849f, 0.999661f, 0.999398f, 0.999059f, 0.998645f, 0.998156f, 0.997592f, 0.996953f, 0.996240f, 0.995451f, 0.994588f, 0.993651f, 0.992639f, 0.991553f, 0.990393f, 0.989159f, 0.987851f, 0.986470f, 0.985016f, 0.983488f, 0.981888f, 0.980215f, 0.978470f, 0.976653f, 0.974764f, 0.972804f, 0.970772f, 0.968669f, 0.966496f, 0.964253f, 0.961940f, 0.959557f, 0.957105f, 0.954584f, 0.951995f, 0.949337f, 0.946612f, 0.943820f, 0.940961f, 0.938035f, 0.935043f, 0.931986f, 0.928864f, 0.925678f, 0.922427f, 0.919112f, 0.915735f, 0.912295f, 0.908792f, 0.905229f, 0.901604f, 0.897918f, 0.894173f, 0.890369f, 0.886505f, 0.882584f, 0.878604f, 0.874568f, 0.870476f, 0.866327f, 0.862123f, 0.857865f, 0.853553f, 0.849188f, 0.844770f, 0.840301f, 0.835779f, 0.831208f, 0.826586f, 0.821916f, 0.817197f, 0.812430f, 0.807616f, 0.802755f, 0.797850f, 0.792899f, 0.787904f, 0.782866f, 0.777785f, 0.772662f, 0.767499f, 0.762295f, 0.757051f, 0.751769f, 0.746449f, 0.741092f, 0.735698f, 0.730269f, 0.724806f, 0.719308f, 0.713777f, 0.708215f, 0.702621f, 0.696996f, 0.691342f, 0.685659f, 0.679948f, 0.674209f, 0.668445f, 0.662655f, 0.656841f, 0.651003f, 0.645142f, 0.639260f, 0.633356f, 0.627433f, 0.621490f, 0.615529f, 0.609550f, 0.603556f, 0.597545f, 0.591520f, 0.585481f, 0.579429f, 0.573365f, 0.567290f, 0.561205f, 0.555111f, 0.549008f, 0.542899f, 0.536782f, 0.530660f, 0.524534f, 0.518404f, 0.512271f, 0.506136f, 0.500000f, 0.493864f, 0.487729f, 0.481596f, 0.475466f, 0.469340f, 0.463218f, 0.457101f, 0.450991f, 0.444889f, 0.438794f, 0.432710f, 0.426635f, 0.420571f, 0.414519f, 0.408480f, 0.402455f, 0.396444f, 0.390449f, 0.384471f, 0.378510f, 0.372567f, 0.366643f, 0.360740f, 0.354858f, 0.348997f, 0.343159f, 0.337345f, 0.331555f, 0.325791f, 0.320052f, 0.314341f, 0.308658f, 0.303004f, 0.297379f, 0.291785f, 0.286222f, 0.280692f, 0.275194f, 0.269731f, 0.264302f, 0.258908f, 0.253551f, 0.248231f, 0.242949f, 0.237705f, 0.232501f, 0.227337f, 0.222215f, 0.217134f, 0.212096f, 0.207101f, 0.202150f, 0.197244f, 0.192384f, 0.187570f, 0.182803f, 0.178084f, 0.173414f, 0.168792f, 0.164220f, 0.159699f, 0.155230f, 0.150812f, 0.146446f, 0.142134f, 0.137876f, 0.133673f, 0.129524f, 0.125432f, 0.121396f, 0.117416f, 0.113495f, 0.109631f, 0.105827f, 0.102081f, 0.098396f, 0.094771f, 0.091208f, 0.087705f, 0.084265f, 0.080888f, 0.077573f, 0.074322f, 0.071136f, 0.068014f, 0.064956f, 0.061965f, 0.059039f, 0.056180f, 0.053388f, 0.050663f, 0.048005f, 0.045416f, 0.042895f, 0.040443f, 0.038060f, 0.035747f, 0.033504f, 0.031330f, 0.029228f, 0.027196f, 0.025236f, 0.023347f, 0.021530f, 0.019785f, 0.018112f, 0.016512f, 0.014984f, 0.013530f, 0.012149f, 0.010841f, 0.009607f, 0.008447f, 0.007361f, 0.006349f, 0.005412f, 0.004549f, 0.003760f, 0.003046f, 0.002408f, 0.001844f, 0.001355f, 0.000941f, 0.000602f, 0.000339f, 0.000151f, 0.000038f}
 
-/* Mel Filter Start Indices */
-#define FBANK_FILTER_FIRST {10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 25, 26, 27, 28, 30, 31, 33, 34, 36, 37, 39, 40, 42, 44, 46, 48, 49, 51, 53, 55, 57, 60, 62, 64, 66, 69, 71, 74, 76, 79, 82, 85, 87, 90, 93, 97, 100, 103, 106, 110, 113, 117, 121, 125, 129, 133, 137, 141, 146, 150, 155, 160, 165, 170, 175, 180, 186, 191, 197, 203, 209, 215, 222, 228, 235, 242}
-
-/* Mel Filter End Indices */
-#define FBANK_FILTER_LAST {11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 24, 25, 26, 27, 29, 30, 32, 33, 35, 36, 38, 39, 41, 43, 45, 47, 48, 50, 52, 54, 56, 59, 61, 63, 65, 68, 70, 73, 75, 78, 81, 84, 86, 89, 92, 96, 99, 102, 105, 109, 112, 116, 120, 124, 128, 132, 136, 140, 145, 149, 154, 159, 164, 169, 174, 179, 185, 190, 196, 202, 208, 214, 221, 227, 234, 241, 248, 255}
-
-/* Sparse Mel Filterbank (80 x 14) */
-#define MEL_FBANK {{0.465127,0.396716,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.603284,0.292141,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.707859,0.219221,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.780779,0.176189,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.823811,0.161425,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.838575,0.173443,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.826557,0.210862,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.789138,0.272405,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.727595,0.356900,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.643100,0.463245,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.536755,0.590423,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.409577,0.737481,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.262519,0.903539,0.087774,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.096461,0.912226,0.289393,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.710607,0.507689,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.492311,0.741970,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.258030,0.991597,0.255963,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.008403,0.744037,0.534507,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.465493,0.826694,0.132008,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.173306,0.867992,0.449979,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.550021,0.780149,0.122096,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.219851,0.877904,0.475403,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.524597,0.839696,0.214600,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.160304,0.785400,0.599762,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.400238,0.994874,0.399589,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.005126,0.600411,0.813623,0.236687,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.186377,0.763313,0.668500,0.108822,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.331500,0.891178,0.557374,0.013931,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.442626,0.986069,0.478268,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.521732,0.950157,0.429389,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.049843,0.570611,0.915774,0.409103,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.084226,0.590897,0.909196,0.415873,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.090804,0.584127,0.928967,0.448316,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.071033,0.551684,0.973752,0.505138,0.042307,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.026247,0.494862,0.957693,0.585128,0.133464,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.414872,0.866536,0.687188,0.246163,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.312812,0.753837,0.810274,0.379400,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.189726,0.620600,0.953434,0.532252,0.115758,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.046566,0.467748,0.884242,0.703844,0.296420,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.296156,0.703580,0.893372,0.494622,0.100079,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.106628,0.505378,0.899921,0.709634,0.323232,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.290366,0.676768,0.940773,0.562184,0.187382,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.059227,0.437816,0.812618,0.816292,0.448851,0.084968,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.183708,0.551149,0.915032,0.724599,0.367665,0.014097,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.275401,0.632335,0.985903,0.663836,0.316823,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.336164,0.683177,0.973002,0.632300,0.294676,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.026998,0.367700,0.705324,0.960069,0.628425,0.299690,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.039931,0.371575,0.700310,0.973817,0.650757,0.330466,0.012884,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.026183,0.349243,0.669534,0.987116,0.697975,0.385690,0.075993,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.302025,0.614310,0.924007,0.768833,0.464179,0.161979,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.231167,0.535821,0.838021,0.862197,0.564795,0.269742,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.137803,0.435205,0.730258,0.976993,0.686514,0.398275,0.112233,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.023007,0.313486,0.601725,0.887767,0.828365,0.546629,0.266994,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.171635,0.453371,0.733006,0.989439,0.713922,0.440416,0.168897,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.010561,0.286078,0.559584,0.831103,0.899333,0.631700,0.365956,0.102094,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.100667,0.368300,0.634044,0.897906,0.840074,0.579878,0.321475,0.064840,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.159926,0.420122,0.678525,0.935160,0.809957,0.556802,0.305342,0.055553,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.190043,0.443198,0.694658,0.944447,0.807427,0.560930,0.316049,0.072756,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.192573,0.439070,0.683951,0.927244,0.831037,0.590865,0.352227,0.115097,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.168963,0.409135,0.647773,0.884903,0.879461,0.645302,0.412595,0.181323,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000},{0.120539,0.354698,0.587405,0.818677,0.951471,0.723023,0.495961,0.270270,0.045933,0.000000,0.000000,0.000000,0.000000,0.000000},{0.048529,0.276977,0.504039,0.729730,0.954067,0.822927,0.601234,0.380856,0.161776,0.000000,0.000000,0.000000,0.000000,0.000000},{0.177073,0.398766,0.619144,0.838224,0.943952,0.727403,0.512094,0.298010,0.085150,0.000000,0.000000,0.000000,0.000000,0.000000},{0.056048,0.272597,0.487906,0.701990,0.914850,0.873491,0.663017,0.453734,0.245604,0.038625,0.000000,0.000000,0.000000,0.000000},{0.126509,0.336983,0.546266,0.754396,0.961375,0.832780,0.628063,0.424449,0.221954,0.020537,0.000000,0.000000,0.000000,0.000000},{0.167220,0.371937,0.575551,0.778046,0.979463,0.820210,0.620944,0.422726,0.225561,0.029419,0.000000,0.000000,0.000000,0.000000},{0.179790,0.379056,0.577274,0.774439,0.970581,0.834307,0.640208,0.447099,0.254996,0.063867,0.000000,0.000000,0.000000,0.000000},{0.165693,0.359792,0.552901,0.745004,0.936133,0.873710,0.684503,0.496261,0.308951,0.122575,0.000000,0.000000,0.000000,0.000000},{0.126290,0.315497,0.503739,0.691049,0.877425,0.937123,0.752587,0.568960,0.386226,0.204375,0.023409,0.000000,0.000000,0.000000},{0.062877,0.247413,0.431040,0.613774,0.795625,0.976591,0.843309,0.664068,0.485688,0.308151,0.131449,0.000000,0.000000,0.000000},{0.156691,0.335932,0.514312,0.691849,0.868551,0.955576,0.780538,0.606304,0.432873,0.260244,0.088419,0.000000,0.000000,0.000000},{0.044424,0.219462,0.393696,0.567127,0.739756,0.911581,0.917372,0.747096,0.577607,0.408864,0.240891,0.073657,0.000000,0.000000},{0.082628,0.252904,0.422393,0.591136,0.759109,0.926343,0.907169,0.741427,0.576406,0.412116,0.248540,0.085677,0.000000,0.000000},{0.092831,0.258573,0.423594,0.587884,0.751460,0.914323,0.923521,0.762061,0.601291,0.441211,0.281812,0.123094,0.000000,0.000000},{0.076479,0.237939,0.398709,0.558789,0.718188,0.876906,0.965041,0.807654,0.650931,0.494849,0.339425,0.184641,0.030498,0.000000},{0.034959,0.192346,0.349069,0.505151,0.660575,0.815359,0.969502,0.876978,0.724083,0.571820,0.420174,0.269128,0.118699,0.000000},{0.123022,0.275917,0.428180,0.579826,0.730872,0.881301,0.968870,0.819634,0.670998,0.522938,0.375479,0.228587,0.082263,0.000000},{0.031130,0.180366,0.329002,0.477062,0.624521,0.771413,0.917737,0.936523,0.791334,0.646713,0.502652,0.359143,0.216169,0.073746},{0.063477,0.208666,0.353287,0.497348,0.640857,0.783831,0.926254,0.931875,0.790523,0.649706,0.509425,0.369663,0.230420,0.091696},{0.068125,0.209477,0.350294,0.490575,0.630337,0.769580,0.908304,0.953483,0.815773,0.678574,0.541869,0.405668,0.269953,0.134733}}
-
-/* RFFT Twiddle Coefficients (512-point) */
-#define TWIDDLECOEF_RFFT_512 {1.000000000f, -0.000000000f, 0.999924719f, -0.012271538f, 0.999698818f, -0.024541229f, 0.999322355f, -0.036807224f, 0.998795450f, -0.049067676f, 0.998118103f, -0.061320737f, 0.997290432f, -0.073564567f, 0.996312618f, -0.085797310f, 0.995184720f, -0.098017141f, 0.993906975f, -0.110222206f, 0.992479563f, -0.122410677f, 0.990902662f, -0.134580702f, 0.989176512f, -0.146730468f, 0.987301409f, -0.158858150f, 0.985277653f, -0.170961887f, 0.983105481f, -0.183039889f, 0.980785251f, -0.195090324f, 0.978317380f, -0.207111374f, 0.975702107f, -0.219101235f, 0.972939968f, -0.231058106f, 0.970031261f, -0.242980182f, 0.966976464f, -0.254865646f, 0.963776052f, -0.266712755f, 0.960430503f, -0.278519690f, 0.956940353f, -0.290284663f, 0.953306019f, -0.302005947f, 0.949528158f, -0.313681751f, 0.945607305f, -0.325310290f, 0.941544056f, -0.336889863f, 0.937339008f, -0.348418683f, 0.932992816f, -0.359895051f, 0.928506076f, -0.371317208f, 0.923879504f, -0.382683426f, 0.919113874f, -0.393992037f, 0.914209783f, -0.405241311f, 0.909168005f, -0.416429549f, 0.903989315f, -0.427555084f, 0.898674488f, -0.438616246f, 0.893224299f, -0.449611336f, 0.887639642f, -0.460538715f, 0.881921291f, -0.471396744f, 0.876070082f, -0.482183784f, 0.870086968f, -0.492898196f, 0.863972843f, -0.503538370f, 0.857728601f, -0.514102757f, 0.851355195f, -0.524589658f, 0.844853580f, -0.534997642f, 0.838224709f, -0.545324981f, 0.831469595f, -0.555570245f, 0.824589312f, -0.565731823f, 0.817584813f, -0.575808167f, 0.810457170f, -0.585797846f, 0.803207517f, -0.595699310f, 0.795836926f, -0.605511069f, 0.788346410f, -0.615231574f, 0.780737221f, -0.624859512f, 0.773010433f, -0.634393275f, 0.765167236f, -0.643831551f, 0.757208824f, -0.653172851f, 0.749136388f, -0.662415802f, 0.740951121f, -0.671558976f, 0.732654274f, -0.680601001f, 0.724247098f, -0.689540565f, 0.715730846f, -0.698376238f, 0.707106769f, -0.707106769f, 0.698376238f, -0.715730846f, 0.689540565f, -0.724247098f, 0.680601001f, -0.732654274f, 0.671558976f, -0.740951121f, 0.662415802f, -0.749136388f, 0.653172851f, -0.757208824f, 0.643831551f, -0.765167236f, 0.634393275f, -0.773010433f, 0.624859512f, -0.780737221f, 0.615231574f, -0.788346410f, 0.605511069f, -0.795836926f, 0.595699310f, -0.803207517f, 0.585797846f, -0.810457170f, 0.575808167f, -0.817584813f, 0.565731823f, -0.824589312f, 0.555570245f, -0.831469595f, 0.545324981f, -0.838224709f, 0.534997642f, -0.844853580f, 0.524589658f, -0.851355195f, 0.514102757f, -0.857728601f, 0.503538370f, -0.863972843f, 0.492898196f, -0.870086968f, 0.482183784f, -0.876070082f, 0.471396744f, -0.881921291f, 0.460538715f, -0.887639642f, 0.449611336f, -0.893224299f, 0.438616246f, -0.898674488f, 0.427555084f, -0.903989315f, 0.416429549f, -0.909168005f, 0.405241311f, -0.914209783f, 0.393992037f, -0.919113874f, 0.382683426f, -0.923879504f, 0.371317208f, -0.928506076f, 0.359895051f, -0.932992816f, 0.348418683f, -0.937339008f, 0.336889863f, -0.941544056f, 0.325310290f, -0.945607305f, 0.313681751f, -0.949528158f, 0.302005947f, -0.953306019f, 0.290284663f, -0.956940353f, 0.278519690f, -0.960430503f, 0.266712755f, -0.963776052f, 0.254865646f, -0.966976464f, 0.242980182f, -0.970031261f, 0.231058106f, -0.972939968f, 0.219101235f, -0.975702107f, 0.207111374f, -0.978317380f, 0.195090324f, -0.980785251f, 0.183039889f, -0.983105481f, 0.170961887f, -0.985277653f, 0.158858150f, -0.987301409f, 0.146730468f, -0.989176512f, 0.134580702f, -0.990902662f, 0.122410677f, -0.992479563f, 0.110222206f, -0.993906975f, 0.098017141f, -0.995184720f, 0.085797310f, -0.996312618f, 0.073564567f, -0.997290432f, 0.061320737f, -0.998118103f, 0.049067676f, -0.998795450f, 0.036807224f, -0.999322355f, 0.024541229f, -0.999698818f, 0.012271538f, -0.999924719f, 0.000000000f, -1.000000000f, -0.012271538f, -0.999924719f, -0.024541229f, -0.999698818f, -0.036807224f, -0.999322355f, -0.049067676f, -0.998795450f, -0.061320737f, -0.998118103f, -0.073564567f, -0.997290432f, -0.085797310f, -0.996312618f, -0.098017141f, -0.995184720f, -0.110222206f, -0.993906975f, -0.122410677f, -0.992479563f, -0.134580702f, -0.990902662f, -0.146730468f, -0.989176512f, -0.158858150f, -0.987301409f, -0.170961887f, -0.985277653f, -0.183039889f, -0.983105481f, -0.195090324f, -0.980785251f, -0.207111374f, -0.978317380f, -0.219101235f, -0.975702107f, -0.231058106f, -0.972939968f, -0.242980182f, -0.970031261f, -0.254865646f, -0.966976464f, -0.266712755f, -0.963776052f, -0.278519690f, -0.960430503f, -0.290284663f, -0.956940353f, -0.302005947f, -0.953306019f, -0.313681751f, -0.949528158f, -0.325310290f, -0.945607305f, -0.336889863f, -0.941544056f, -0.348418683f, -0.937339008f, -0.359895051f, -0.932992816f, -0.371317208f, -0.928506076f, -0.382683426f, -0.923879504f, -0.393992037f, -0.919113874f, -0.405241311f, -0.914209783f, -0.416429549f, -0.909168005f, -0.427555084f, -0.903989315f, -0.438616246f, -0.898674488f, -0.449611336f, -0.893224299f, -0.460538715f, -0.887639642f, -0.471396744f, -0.881921291f, -0.482183784f, -0.876070082f, -0.492898196f, -0.870086968f, -0.503538370f, -0.863972843f, -0.514102757f, -0.857728601f, -0.524589658f, -0.851355195f, -0.534997642f, -0.844853580f, -0.545324981f, -0.838224709f, -0.555570245f, -0.831469595f, -0.565731823f, -0.824589312f, -0.575808167f, -0.817584813f, -0.585797846f, -0.810457170f, -0.595699310f, -0.803207517f, -0.605511069f, -0.795836926f, -0.615231574f, -0.788346410f, -0.624859512f, -0.780737221f, -0.634393275f, -0.773010433f, -0.643831551f, -0.765167236f, -0.653172851f, -0.757208824f, -0.662415802f, -0.749136388f, -0.671558976f, -0.740951121f, -0.680601001f, -0.732654274f, -0.689540565f, -0.724247098f, -0.698376238f, -0.715730846f, -0.707106769f, -0.707106769f, -0.715730846f, -0.698376238f, -0.724247098f, -0.689540565f, -0.732654274f, -0.680601001f, -0.740951121f, -0.671558976f, -0.749136388f, -0.662415802f, -0.757208824f, -0.653172851f, -0.765167236f, -0.643831551f, -0.773010433f, -0.634393275f, -0.780737221f, -0.624859512f, -0.788346410f, -0.615231574f, -0.795836926f, -0.605511069f, -0.803207517f, -0.595699310f, -0.810457170f, -0.585797846f, -0.817584813f, -0.575808167f, -0.824589312f, -0.565731823f, -0.831469595f, -0.555570245f, -0.838224709f, -0.545324981f, -0.844853580f, -0.534997642f, -0.851355195f, -0.524589658f, -0.857728601f, -0.514102757f, -0.863972843f, -0.503538370f, -0.870086968f, -0.492898196f, -0.876070082f, -0.482183784f, -0.881921291f, -0.471396744f, -0.887639642f, -0.460538715f, -0.893224299f, -0.449611336f, -0.898674488f, -0.438616246f, -0.903989315f, -0.427555084f, -0.909168005f, -0.416429549f, -0.914209783f, -0.405241311f, -0.919113874f, -0.393992037f, -0.923879504f, -0.382683426f, -0.928506076f, -0.371317208f, -0.932992816f, -0.359895051f, -0.937339008f, -0.348418683f, -0.941544056f, -0.336889863f, -0.945607305f, -0.325310290f, -0.949528158f, -0.313681751f, -0.953306019f, -0.302005947f, -0.956940353f, -0.290284663f, -0.960430503f, -0.278519690f, -0.963776052f, -0.266712755f, -0.966976464f, -0.254865646f, -0.970031261f, -0.242980182f, -0.972939968f, -0.231058106f, -0.975702107f, -0.219101235f, -0.978317380f, -0.207111374f, -0.980785251f, -0.195090324f, -0.983105481f, -0.183039889f, -0.985277653f, -0.170961887f, -0.987301409f, -0.158858150f, -0.989176512f, -0.146730468f, -0.990902662f, -0.134580702f, -0.992479563f, -0.122410677f, -0.993906975f, -0.110222206f, -0.995184720f, -0.098017141f, -0.996312618f, -0.085797310f, -0.997290432f, -0.073564567f, -0.998118103f, -0.061320737f, -0.998795450f, -0.049067676f, -0.999322355f, -0.036807224f, -0.999698818f, -0.024541229f, -0.999924719f, -0.012271538f, -1.000000000f, -0.000000000f, -0.999924719f, 0.012271538f, -0.999698818f, 0.024541229f, -0.999322355f, 0.036807224f, -0.998795450f, 0.049067676f, -0.998118103f, 0.061320737f, -0.997290432f, 0.073564567f, -0.996312618f, 0.085797310f, -0.995184720f, 0.098017141f, -0.993906975f, 0.110222206f, -0.992479563f, 0.122410677f, -0.990902662f, 0.134580702f, -0.989176512f, 0.146730468f, -0.987301409f, 0.158858150f, -0.985277653f, 0.170961887f, -0.983105481f, 0.183039889f, -0.980785251f, 0.195090324f, -0.978317380f, 0.207111374f, -0.975702107f, 0.219101235f, -0.972939968f, 0.231058106f, -0.970031261f, 0.242980182f, -0.966976464f, 0.254865646f, -0.963776052f, 0.266712755f, -0.960430503f, 0.278519690f, -0.956940353f, 0.290284663f, -0.953306019f, 0.302005947f, -0.949528158f, 0.313681751f, -0.945607305f, 0.325310290f, -0.941544056f, 0.336889863f, -0.937339008f, 0.348418683f, -0.932992816f, 0.359895051f, -0.928506076f, 0.371317208f, -0.923879504f, 0.382683426f, -0.919113874f, 0.393992037f, -0.914209783f, 0.405241311f, -0.909168005f, 0.416429549f, -0.903989315f, 0.427555084f, -0.898674488f, 0.438616246f, -0.893224299f, 0.449611336f, -0.887639642f, 0.460538715f, -0.881921291f, 0.471396744f, -0.876070082f, 0.482183784f, -0.870086968f, 0.492898196f, -0.863972843f, 0.503538370f, -0.857728601f, 0.514102757f, -0.851355195f, 0.524589658f, -0.844853580f, 0.534997642f, -0.838224709f, 0.545324981f, -0.831469595f, 0.555570245f, -0.824589312f, 0.565731823f, -0.817584813f, 0.575808167f, -0.810457170f, 0.585797846f, -0.803207517f, 0.595699310f, -0.795836926f, 0.605511069f, -0.788346410f, 0.615231574f, -0.780737221f, 0.624859512f, -0.773010433f, 0.634393275f, -0.765167236f, 0.643831551f, -0.757208824f, 0.653172851f, -0.749136388f, 0.662415802f, -0.740951121f, 0.671558976f, -0.732654274f, 0.680601001f, -0.724247098f, 0.689540565f, -0.715730846f, 0.698376238f, -0.707106769f, 0.707106769f, -0.698376238f, 0.715730846f, -0.689540565f, 0.724247098f, -0.680601001f, 0.732654274f, -0.671558976f, 0.740951121f, -0.662415802f, 0.749136388f, -0.653172851f, 0.757208824f, -0.643831551f, 0.765167236f, -0.634393275f, 0.773010433f, -0.624859512f, 0.780737221f, -0.615231574f, 0.788346410f, -0.605511069f, 0.795836926f, -0.595699310f, 0.803207517f, -0.585797846f, 0.810457170f, -0.575808167f, 0.817584813f, -0.565731823f, 0.824589312f, -0.555570245f, 0.831469595f, -0.545324981f, 0.838224709f, -0.534997642f, 0.844853580f, -0.524589658f, 0.851355195f, -0.514102757f, 0.857728601f, -0.503538370f, 0.863972843f, -0.492898196f, 0.870086968f, -0.482183784f, 0.876070082f, -0.471396744f, 0.881921291f, -0.460538715f, 0.887639642f, -0.449611336f, 0.893224299f, -0.438616246f, 0.898674488f, -0.427555084f, 0.903989315f, -0.416429549f, 0.909168005f, -0.405241311f, 0.914209783f, -0.393992037f, 0.919113874f, -0.382683426f, 0.923879504f, -0.371317208f, 0.928506076f, -0.359895051f, 0.932992816f, -0.348418683f, 0.937339008f, -0.336889863f, 0.941544056f, -0.325310290f, 0.945607305f, -0.313681751f, 0.949528158f, -0.302005947f, 0.953306019f, -0.290284663f, 0.956940353f, -0.278519690f, 0.960430503f, -0.266712755f, 0.963776052f, -0.254865646f, 0.966976464f, -0.242980182f, 0.970031261f, -0.231058106f, 0.972939968f, -0.219101235f, 0.975702107f, -0.207111374f, 0.978317380f, -0.195090324f, 0.980785251f, -0.183039889f, 0.983105481f, -0.170961887f, 0.985277653f, -0.158858150f, 0.987301409f, -0.146730468f, 0.989176512f, -0.134580702f, 0.990902662f, -0.122410677f, 0.992479563f, -0.110222206f, 0.993906975f, -0.098017141f, 0.995184720f, -0.085797310f, 0.996312618f, -0.073564567f, 0.997290432f, -0.061320737f, 0.998118103f, -0.049067676f, 0.998795450f, -0.036807224f, 0.999322355f, -0.024541229f, 0.999698818f, -0.012271538f, 0.999924719f, -0.000000000f, 1.000000000f, 0.012271538f, 0.999924719f, 0.024541229f, 0.999698818f, 0.036807224f, 0.999322355f, 0.049067676f, 0.998795450f, 0.061320737f, 0.998118103f, 0.073564567f, 0.997290432f, 0.085797310f, 0.996312618f, 0.098017141f, 0.995184720f, 0.110222206f, 0.993906975f, 0.122410677f, 0.992479563f, 0.134580702f, 0.990902662f, 0.146730468f, 0.989176512f, 0.158858150f, 0.987301409f, 0.170961887f, 0.985277653f, 0.183039889f, 0.983105481f, 0.195090324f, 0.980785251f, 0.207111374f, 0.978317380f, 0.219101235f, 0.975702107f, 0.231058106f, 0.972939968f, 0.242980182f, 0.970031261f, 0.254865646f, 0.966976464f, 0.266712755f, 0.963776052f, 0.278519690f, 0.960430503f, 0.290284663f, 0.956940353f, 0.302005947f, 0.953306019f, 0.313681751f, 0.949528158f, 0.325310290f, 0.945607305f, 0.336889863f, 0.941544056f, 0.348418683f, 0.937339008f, 0.359895051f, 0.932992816f, 0.371317208f, 0.928506076f, 0.382683426f, 0.923879504f, 0.393992037f, 0.919113874f, 0.405241311f, 0.914209783f, 0.416429549f, 0.909168005f, 0.427555084f, 0.903989315f, 0.438616246f, 0.898674488f, 0.449611336f, 0.893224299f, 0.460538715f, 0.887639642f, 0.471396744f, 0.881921291f, 0.482183784f, 0.876070082f, 0.492898196f, 0.870086968f, 0.503538370f, 0.863972843f, 0.514102757f, 0.857728601f, 0.524589658f, 0.851355195f, 0.534997642f, 0.844853580f, 0.545324981f, 0.838224709f, 0.555570245f, 0.831469595f, 0.565731823f, 0.824589312f, 0.575808167f, 0.817584813f, 0.585797846f, 0.810457170f, 0.595699310f, 0.803207517f, 0.605511069f, 0.795836926f, 0.615231574f, 0.788346410f, 0.624859512f, 0.780737221f, 0.634393275f, 0.773010433f, 0.643831551f, 0.765167236f, 0.653172851f, 0.757208824f, 0.662415802f, 0.749136388f, 0.671558976f, 0.740951121f, 0.680601001f, 0.732654274f, 0.689540565f, 0.724247098f, 0.698376238f, 0.715730846f, 0.707106769f, 0.707106769f, 0.715730846f, 0.698376238f, 0.724247098f, 0.689540565f, 0.732654274f, 0.680601001f, 0.740951121f, 0.671558976f, 0.749136388f, 0.662415802f, 0.757208824f, 0.653172851f, 0.765167236f, 0.643831551f, 0.773010433f, 0.634393275f, 0.780737221f, 0.624859512f, 0.788346410f, 0.615231574f, 0.795836926f, 0.605511069f, 0.803207517f, 0.595699310f, 0.810457170f, 0.585797846f, 0.817584813f, 0.575808167f, 0.824589312f, 0.565731823f, 0.831469595f, 0.555570245f, 0.838224709f, 0.545324981f, 0.844853580f, 0.534997642f, 0.851355195f, 0.524589658f, 0.857728601f, 0.514102757f, 0.863972843f, 0.503538370f, 0.870086968f, 0.492898196f, 0.876070082f, 0.482183784f, 0.881921291f, 0.471396744f, 0.887639642f, 0.460538715f, 0.893224299f, 0.449611336f, 0.898674488f, 0.438616246f, 0.903989315f, 0.427555084f, 0.909168005f, 0.416429549f, 0.914209783f, 0.405241311f, 0.919113874f, 0.393992037f, 0.923879504f, 0.382683426f, 0.928506076f, 0.371317208f, 0.932992816f, 0.359895051f, 0.937339008f, 0.348418683f, 0.941544056f, 0.336889863f, 0.945607305f, 0.325310290f, 0.949528158f, 0.313681751f, 0.953306019f, 0.302005947f, 0.956940353f, 0.290284663f, 0.960430503f, 0.278519690f, 0.963776052f, 0.266712755f, 0.966976464f, 0.254865646f, 0.970031261f, 0.242980182f, 0.972939968f, 0.231058106f, 0.975702107f, 0.219101235f, 0.978317380f, 0.207111374f, 0.980785251f, 0.195090324f, 0.983105481f, 0.183039889f, 0.985277653f, 0.170961887f, 0.987301409f, 0.158858150f, 0.989176512f, 0.146730468f, 0.990902662f, 0.134580702f, 0.992479563f, 0.122410677f, 0.993906975f, 0.110222206f, 0.995184720f, 0.098017141f, 0.996312618f, 0.085797310f, 0.997290432f, 0.073564567f, 0.998118103f, 0.061320737f, 0.998795450f, 0.049067676f, 0.999322355f, 0.036807224f, 0.999698818f, 0.024541229f, 0.999924719f, 0.012271538f}
+/* RFFT Twiddle Coefficients (512-point, stage_rfft_f32 순서: sin, cos) */
+#define TWIDDLECOEF_RFFT_512 {0.000000000f, 1.000000000f, 0.012271538f, 0.999924702f, 0.024541229f, 0.999698819f, 0.036807223f, 0.999322385f, 0.049067674f, 0.998795456f, 0.061320736f, 0.998118113f, 0.073564564f, 0.997290457f, 0.085797312f, 0.996312612f, 0.098017140f, 0.995184727f, 0.110222207f, 0.993906970f, 0.122410675f, 0.992479535f, 0.134580709f, 0.990902635f, 0.146730474f, 0.989176510f, 0.158858143f, 0.987301418f, 0.170961889f, 0.985277642f, 0.183039888f, 0.983105487f, 0.195090322f, 0.980785280f, 0.207111376f, 0.978317371f, 0.219101240f, 0.975702130f, 0.231058108f, 0.972939952f, 0.242980180f, 0.970031253f, 0.254865660f, 0.966976471f, 0.266712757f, 0.963776066f, 0.278519689f, 0.960430519f, 0.290284677f, 0.956940336f, 0.302005949f, 0.953306040f, 0.313681740f, 0.949528181f, 0.325310292f, 0.945607325f, 0.336889853f, 0.941544065f, 0.348418680f, 0.937339012f, 0.359895037f, 0.932992799f, 0.371317194f, 0.928506080f, 0.382683432f, 0.923879533f, 0.393992040f, 0.919113852f, 0.405241314f, 0.914209756f, 0.416429560f, 0.909167983f, 0.427555093f, 0.903989293f, 0.438616239f, 0.898674466f, 0.449611330f, 0.893224301f, 0.460538711f, 0.887639620f, 0.471396737f, 0.881921264f, 0.482183772f, 0.876070094f, 0.492898192f, 0.870086991f, 0.503538384f, 0.863972856f, 0.514102744f, 0.857728610f, 0.524589683f, 0.851355193f, 0.534997620f, 0.844853565f, 0.545324988f, 0.838224706f, 0.555570233f, 0.831469612f, 0.565731811f, 0.824589303f, 0.575808191f, 0.817584813f, 0.585797857f, 0.810457198f, 0.595699304f, 0.803207531f, 0.605511041f, 0.795836905f, 0.615231591f, 0.788346428f, 0.624859488f, 0.780737229f, 0.634393284f, 0.773010453f, 0.643831543f, 0.765167266f, 0.653172843f, 0.757208847f, 0.662415778f, 0.749136395f, 0.671558955f, 0.740951125f, 0.680600998f, 0.732654272f, 0.689540545f, 0.724247083f, 0.698376249f, 0.715730825f, 0.707106781f, 0.707106781f, 0.715730825f, 0.698376249f, 0.724247083f, 0.689540545f, 0.732654272f, 0.680600998f, 0.740951125f, 0.671558955f, 0.749136395f, 0.662415778f, 0.757208847f, 0.653172843f, 0.765167266f, 0.643831543f, 0.773010453f, 0.634393284f, 0.780737229f, 0.624859488f, 0.788346428f, 0.615231591f, 0.795836905f, 0.605511041f, 0.803207531f, 0.595699304f, 0.810457198f, 0.585797857f, 0.817584813f, 0.575808191f, 0.824589303f, 0.565731811f, 0.831469612f, 0.555570233f, 0.838224706f, 0.545324988f, 0.844853565f, 0.534997620f, 0.851355193f, 0.524589683f, 0.857728610f, 0.514102744f, 0.863972856f, 0.503538384f, 0.870086991f, 0.492898192f, 0.876070094f, 0.482183772f, 0.881921264f, 0.471396737f, 0.887639620f, 0.460538711f, 0.893224301f, 0.449611330f, 0.898674466f, 0.438616239f, 0.903989293f, 0.427555093f, 0.909167983f, 0.416429560f, 0.914209756f, 0.405241314f, 0.919113852f, 0.393992040f, 0.923879533f, 0.382683432f, 0.928506080f, 0.371317194f, 0.932992799f, 0.359895037f, 0.937339012f, 0.348418680f, 0.941544065f, 0.336889853f, 0.945607325f, 0.325310292f, 0.949528181f, 0.313681740f, 0.953306040f, 0.302005949f, 0.956940336f, 0.290284677f, 0.960430519f, 0.278519689f, 0.963776066f, 0.266712757f, 0.966976471f, 0.254865660f, 0.970031253f, 0.242980180f, 0.972939952f, 0.231058108f, 0.975702130f, 0.219101240f, 0.978317371f, 0.207111376f, 0.980785280f, 0.195090322f, 0.983105487f, 0.183039888f, 0.985277642f, 0.170961889f, 0.987301418f, 0.158858143f, 0.989176510f, 0.146730474f, 0.990902635f, 0.134580709f, 0.992479535f, 0.122410675f, 0.993906970f, 0.110222207f, 0.995184727f, 0.098017140f, 0.996312612f, 0.085797312f, 0.997290457f, 0.073564564f, 0.998118113f, 0.061320736f, 0.998795456f, 0.049067674f, 0.999322385f, 0.036807223f, 0.999698819f, 0.024541229f, 0.999924702f, 0.012271538f, 1.000000000f, 0.000000000f, 0.999924702f, -0.012271538f, 0.999698819f, -0.024541229f, 0.999322385f, -0.036807223f, 0.998795456f, -0.049067674f, 0.998118113f, -0.061320736f, 0.997290457f, -0.073564564f, 0.996312612f, -0.085797312f, 0.995184727f, -0.098017140f, 0.993906970f, -0.110222207f, 0.992479535f, -0.122410675f, 0.990902635f, -0.134580709f, 0.989176510f, -0.146730474f, 0.987301418f, -0.158858143f, 0.985277642f, -0.170961889f, 0.983105487f, -0.183039888f, 0.980785280f, -0.195090322f, 0.978317371f, -0.207111376f, 0.975702130f, -0.219101240f, 0.972939952f, -0.231058108f, 0.970031253f, -0.242980180f, 0.966976471f, -0.254865660f, 0.963776066f, -0.266712757f, 0.960430519f, -0.278519689f, 0.956940336f, -0.290284677f, 0.953306040f, -0.302005949f, 0.949528181f, -0.313681740f, 0.945607325f, -0.325310292f, 0.941544065f, -0.336889853f, 0.937339012f, -0.348418680f, 0.932992799f, -0.359895037f, 0.928506080f, -0.371317194f, 0.923879533f, -0.382683432f, 0.919113852f, -0.393992040f, 0.914209756f, -0.405241314f, 0.909167983f, -0.416429560f, 0.903989293f, -0.427555093f, 0.898674466f, -0.438616239f, 0.893224301f, -0.449611330f, 0.887639620f, -0.460538711f, 0.881921264f, -0.471396737f, 0.876070094f, -0.482183772f, 0.870086991f, -0.492898192f, 0.863972856f, -0.503538384f, 0.857728610f, -0.514102744f, 0.851355193f, -0.524589683f, 0.844853565f, -0.534997620f, 0.838224706f, -0.545324988f, 0.831469612f, -0.555570233f, 0.824589303f, -0.565731811f, 0.817584813f, -0.575808191f, 0.810457198f, -0.585797857f, 0.803207531f, -0.595699304f, 0.795836905f, -0.605511041f, 0.788346428f, -0.615231591f, 0.780737229f, -0.624859488f, 0.773010453f, -0.634393284f, 0.765167266f, -0.643831543f, 0.757208847f, -0.653172843f, 0.749136395f, -0.662415778f, 0.740951125f, -0.671558955f, 0.732654272f, -0.680600998f, 0.724247083f, -0.689540545f, 0.715730825f, -0.698376249f, 0.707106781f, -0.707106781f, 0.698376249f, -0.715730825f, 0.689540545f, -0.724247083f, 0.680600998f, -0.732654272f, 0.671558955f, -0.740951125f, 0.662415778f, -0.749136395f, 0.653172843f, -0.757208847f, 0.643831543f, -0.765167266f, 0.634393284f, -0.773010453f, 0.624859488f, -0.780737229f, 0.615231591f, -0.788346428f, 0.605511041f, -0.795836905f, 0.595699304f, -0.803207531f, 0.585797857f, -0.810457198f, 0.575808191f, -0.817584813f, 0.565731811f, -0.824589303f, 0.555570233f, -0.831469612f, 0.545324988f, -0.838224706f, 0.534997620f, -0.844853565f, 0.524589683f, -0.851355193f, 0.514102744f, -0.857728610f, 0.503538384f, -0.863972856f, 0.492898192f, -0.870086991f, 0.482183772f, -0.876070094f, 0.471396737f, -0.881921264f, 0.460538711f, -0.887639620f, 0.449611330f, -0.893224301f, 0.438616239f, -0.898674466f, 0.427555093f, -0.903989293f, 0.416429560f, -0.909167983f, 0.405241314f, -0.914209756f, 0.393992040f, -0.919113852f, 0.382683432f, -0.923879533f, 0.371317194f, -0.928506080f, 0.359895037f, -0.932992799f, 0.348418680f, -0.937339012f, 0.336889853f, -0.941544065f, 0.325310292f, -0.945607325f, 0.313681740f, -0.949528181f, 0.302005949f, -0.953306040f, 0.290284677f, -0.956940336f, 0.278519689f, -0.960430519f, 0.266712757f, -0.963776066f, 0.254865660f, -0.966976471f, 0.242980180f, -0.970031253f, 0.231058108f, -0.972939952f, 0.219101240f, -0.975702130f, 0.207111376f, -0.978317371f, 0.195090322f, -0.980785280f, 0.183039888f, -0.983105487f, 0.170961889f, -0.985277642f, 0.158858143f, -0.987301418f, 0.146730474f, -0.989176510f, 0.134580709f, -0.990902635f, 0.122410675f, -0.992479535f, 0.110222207f, -0.993906970f, 0.098017140f, -0.995184727f, 0.085797312f, -0.996312612f, 0.073564564f, -0.997290457f, 0.061320736f, -0.998118113f, 0.049067674f, -0.998795456f, 0.036807223f, -0.999322385f, 0.024541229f, -0.999698819f, 0.012271538f, -0.999924702f}
 
 #endif
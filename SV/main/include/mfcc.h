@@ -8,9 +8,6 @@
 #include "esp_dsp.h"
 
 #define WINDOW_FUNC {0.000000, 0.000024, 0.000096, 0.000217, 0.000385, 0.000602, 0.000867, 0.001180, 0.001541, 0.001950, 0.002408, 0.002913, 0.003466, 0.004067, 0.004715, 0.005412, 0.006156, 0.006948, 0.007787, 0.008673, 0.009607, 0.010589, 0.011617, 0.012693, 0.013815, 0.014984, 0.016200, 0.017463, 0.018772, 0.020128, 0.021530, 0.022978, 0.024472, 0.026012, 0.027597, 0.029228, 0.030904, 0.032626, 0.034393, 0.036204, 0.038060, 0.039961, 0.041906, 0.043895, 0.045928, 0.048005, 0.050126, 0.052290, 0.054497, 0.056747, 0.059039, 0.061375, 0.063752, 0.066171, 0.068633, 0.071136, 0.073680, 0.076265, 0.078891, 0.081558, 0.084265, 0.087012, 0.089799, 0.092626, 0.095492, 0.098396, 0.101340, 0.104322, 0.107342, 0.110399, 0.113495, 0.116627, 0.119797, 0.123003, 0.126246, 0.129524, 0.132839, 0.136188, 0.139573, 0.142993, 0.146447, 0.149935, 0.153456, 0.157011, 0.160600, 0.164221, 0.167874, 0.171559, 0.175276, 0.179024, 0.182803, 0.186613, 0.190453, 0.194323, 0.198222, 0.202150, 0.206107, 0.210093, 0.214106, 0.218147, 0.222215, 0.226310, 0.230431, 0.234578, 0.238751, 0.242949, 0.247171, 0.251418, 0.255689, 0.259984, 0.264302, 0.268642, 0.273005, 0.277389, 0.281795, 0.286222, 0.290670, 0.295138, 0.299626, 0.304132, 0.308658, 0.313203, 0.317765, 0.322345, 0.326941, 0.331555, 0.336185, 0.340831, 0.345491, 0.350167, 0.354858, 0.359562, 0.364280, 0.369011, 0.373754, 0.378510, 0.383277, 0.388056, 0.392845, 0.397645, 0.402455, 0.407274, 0.412102, 0.416938, 0.421783, 0.426635, 0.431494, 0.436359, 0.441231, 0.446109, 0.450991, 0.455879, 0.460770, 0.465666, 0.470565, 0.475466, 0.480370, 0.485276, 0.490183, 0.495091, 0.500000, 0.504909, 0.509817, 0.514724, 0.519630, 0.524534, 0.529435, 0.534334, 0.539230, 0.544121, 0.549009, 0.553891, 0.558769, 0.563640, 0.568506, 0.573365, 0.578217, 0.583062, 0.587898, 0.592726, 0.597545, 0.602355, 0.607155, 0.611944, 0.616723, 0.621490, 0.626246, 0.630989, 0.635720, 0.640438, 0.645142, 0.649833, 0.654508, 0.659169, 0.663815, 0.668445, 0.673059, 0.677655, 0.682235, 0.686797, 0.691342, 0.695867, 0.700374, 0.704862, 0.709330, 0.713778, 0.718205, 0.722611, 0.726995, 0.731358, 0.735698, 0.740016, 0.744311, 0.748582, 0.752829, 0.757051, 0.761249, 0.765422, 0.769569, 0.773690, 0.777785, 0.781853, 0.785894, 0.789907, 0.793893, 0.797850, 0.801778, 0.805677, 0.809547, 0.813387, 0.817197, 0.820976, 0.824724, 0.828441, 0.832126, 0.835779, 0.839400, 0.842989, 0.846544, 0.850065, 0.853553, 0.857007, 0.860427, 0.863812, 0.867161, 0.870476, 0.873754, 0.876997, 0.880203, 0.883373, 0.886505, 0.889601, 0.892658, 0.895678, 0.898660, 0.901604, 0.904508, 0.907374, 0.910201, 0.912988, 0.915735, 0.918442, 0.921109, 0.923735, 0.926320, 0.928864, 0.931367, 0.933829, 0.936248, 0.938625, 0.940961, 0.943253, 0.945503, 0.947710, 0.949874, 0.951995, 0.954072, 0.956105, 0.958094, 0.960039, 0.961940, 0.963796, 0.965607, 0.967374, 0.969096, 0.970772, 0.972403, 0.973988, 0.975528, 0.977022, 0.978470, 0.979872, 0.981228, 0.982537, 0.983800, 0.985016, 0.986185, 0.987307, 0.988383, 0.989411, 0.990393, 0.991327, 0.992213, 0.993052, 0.993844, 0.994588, 0.995285, 0.995933, 0.996534, 0.997087, 0.997592, 0.998049, 0.998459, 0.998820, 0.999133, 0.999398, 0.999615, 0.999783, 0.999904, 0.999976, 1.000000, 0.999976, 0.999904, 0.999783, 0.999615, 0.999398, 0.999133, 0.998820, 0.998459, 0.998049, 0.997592, 0.997087, 0.996534, 0.995933, 0.995285, 0.994588, 0.993844, 0.993052, 0.992213, 0.991327, 0.990393, 0.989411, 0.988383, 0.987307, 0.986185, 0.985016, 0.983800, 0.982537, 0.981228, 0.979872, 0.978470, 0.977022, 0.975528, 0.973988, 0.972403, 0.970772, 0.969096, 0.967374, 0.965607, 0.963796, 0.961940, 0.960039, 0.958094, 0.956105, 0.954072, 0.951995, 0.949874, 0.947710, 0.945503, 0.943253, 0.940961, 0.938625, 0.936248, 0.933829, 0.931367, 0.928864, 0.926320, 0.923735, 0.921109, 0.918442, 0.915735, 0.912988, 0.910201, 0.907374, 0.904508, 0.901604, 0.898660, 0.895678, 0.892658, 0.889601, 0.886505, 0.883373, 0.880203, 0.876997, 0.873754, 0.870476, 0.867161, 0.863812, 0.860427, 0.857007, 0.853553, 0.850065, 0.846544, 0.842989, 0.839400, 0.835779, 0.832126, 0.828441, 0.824724, 0.820976, 0.817197, 0.813387, 0.809547, 0.805677, 0.801778, 0.797850, 0.793893, 0.789907, 0.785894, 0.781853, 0.777785, 0.773690, 0.769569, 0.765422, 0.761249, 0.757051, 0.752829, 0.748582, 0.744311, 0.740016, 0.735698, 0.731358, 0.726995, 0.722611, 0.718205, 0.713778, 0.709330, 0.704862, 0.700374, 0.695867, 0.691342, 0.686797, 0.682235, 0.677655, 0.673059, 0.668445, 0.663815, 0.659169, 0.654508, 0.649833, 0.645142, 0.640438, 0.635720, 0.630989, 0.626246, 0.621490, 0.616723, 0.611944, 0.607155, 0.602355, 0.597545, 0.592726, 0.587898, 0.583062, 0.578217, 0.573365, 0.568506, 0.563640, 0.558769, 0.553891, 0.549009, 0.544121, 0.539230, 0.534334, 0.529435, 0.524534, 0.519630, 0.514724, 0.509817, 0.504909, 0.500000, 0.495091, 0.490183, 0.485276, 0.480370, 0.475466, 0.470565, 0.465666, 0.460770, 0.455879, 0.450991, 0.446109, 0.441231, 0.436359, 0.431494, 0.426635, 0.421783, 0.416938, 0.412102, 0.407274, 0.402455, 0.397645, 0.392845, 0.388056, 0.383277, 0.378510, 0.373754, 0.369011, 0.364280, 0.359562, 0.354858, 0.350167, 0.345491, 0.340831, 0.336185, 0.331555, 0.326941, 0.322345, 0.317765, 0.313203, 0.308658, 0.304132, 0.299626, 0.295138, 0.290670, 0.286222, 0.281795, 0.277389, 0.273005, 0.268642, 0.264302, 0.259984, 0.255689, 0.251418, 0.247171, 0.242949, 0.238751, 0.234578, 0.230431, 0.226310, 0.222215, 0.218147, 0.214106, 0.210093, 0.206107, 0.202150, 0.198222, 0.194323, 0.190453, 0.186613, 0.182803, 0.179024, 0.175276, 0.171559, 0.167874, 0.164221, 0.160600, 0.157011, 0.153456, 0.149935, 0.146447, 0.142993, 0.139573, 0.136188, 0.132839, 0.129524, 0.126246, 0.123003, 0.119797, 0.116627, 0.113495, 0.110399, 0.107342, 0.104322, 0.101340, 0.098396, 0.095492, 0.092626, 0.089799, 0.087012, 0.084265, 0.081558, 0.078891, 0.076265, 0.073680, 0.071136, 0.068633, 0.066171, 0.063752, 0.061375, 0.059039, 0.056747, 0.054497, 0.052290, 0.050126, 0.048005, 0.045928, 0.043895, 0.041906, 0.039961, 0.038060, 0.036204, 0.034393, 0.032626, 0.030904, 0.029228, 0.027597, 0.026012, 0.024472, 0.022978, 0.021530, 0.020128, 0.018772, 0.017463, 0.016200, 0.014984, 0.013815, 0.012693, 0.011617, 0.010589, 0.009607, 0.008673, 0.007787, 0.006948, 0.006156, 0.005412, 0.004715, 0.004067, 0.003466, 0.002913, 0.002408, 0.001950, 0.001541, 0.001180, 0.000867, 0.000602, 0.000385, 0.000217, 0.000096, 0.000024, }
-#define FBANK_FILTER_FIRST {2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 14, 15, 17, 18, 19, 21, 22, 24, 26, 27, 29, 31, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 55, 57, 59, 62, 64, 67, 69, 72, 75, 78, 80, 83, 86, 89, 93, 96, 99, 102, 106, 109, 113, 117, 120, 124, 128, 132, 136, 141, 145, 149, 154, 159, 163, 168, 173, 178, 184, 189, 194, 200, 206, 211, 217, 224, 230, 236, 243}
-#define FBANK_FILTER_LAST {3, 4, 5, 6, 8, 9, 10, 11, 13, 14, 16, 17, 18, 20, 21, 23, 25, 26, 28, 30, 31, 33, 35, 37, 39, 41, 43, 45, 47, 49, 51, 54, 56, 58, 61, 63, 66, 68, 71, 74, 77, 79, 82, 85, 88, 92, 95, 98, 101, 105, 108, 112, 116, 119, 123, 127, 131, 135, 140, 144, 148, 153, 158, 162, 167, 172, 177, 183, 188, 193, 199, 205, 210, 216, 223, 229, 235, 242, 249, 255 }
-#define MEL_FBANK {{0.669396,0.417769,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.582231,0.523835,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.476165,0.648034,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.351966,0.789650,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.210350,0.947995,0.122435,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.052005,0.877565,0.312369,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.687631,0.517217,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.482783,0.736446,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.263554,0.969545,0.216027,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.030455,0.783973,0.475434,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.524566,0.747331,0.031302,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.252669,0.968698,0.326961,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.673039,0.633920,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.366080,0.951831,0.280348,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.048169,0.719652,0.619149,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.380851,0.967921,0.326372,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.032079,0.673628,0.694218,0.071184,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.305782,0.928816,0.457015,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.542985,0.851460,0.254281,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.148540,0.745719,0.665245,0.084140,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.334755,0.915860,0.510757,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.489243,0.944882,0.386332,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.055118,0.613668,0.834914,0.290447,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.165086,0.709553,0.752764,0.221695,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.247236,0.778305,0.697080,0.178760,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.302920,0.821240,0.666589,0.160424,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.333411,0.839576,0.660125,0.165556,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.339875,0.834444,0.676586,0.193098,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.323414,0.806902,0.714952,0.242055,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.285048,0.757945,0.774279,0.311514,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.225721,0.688486,0.853655,0.400603,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.146345,0.599397,0.952260,0.508516,0.069294,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.047740,0.491484,0.930706,0.634493,0.204027,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.365507,0.795973,0.777809,0.355757,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.222191,0.644243,0.937795,0.523834,0.113810,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.062205,0.476166,0.886190,0.707643,0.305257,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.292357,0.694743,0.906589,0.511567,0.120131,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.093411,0.488433,0.879869,0.732205,0.347738,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.267795,0.652262,0.966666,0.588926,0.214460,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.033334,0.411074,0.785540,0.843215,0.475140,0.110170,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.156785,0.524860,0.889830,0.748263,0.389363,0.033423,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.251737,0.610637,0.966577,0.680383,0.330219,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.319617,0.669781,0.982875,0.638291,0.296444,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.017125,0.361709,0.703556,0.957280,0.620757,0.286835,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.042720,0.379243,0.713165,0.955484,0.626650,0.300298,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.044516,0.373350,0.699702,0.976407,0.654924,0.335807,0.019038,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.023593,0.345076,0.664193,0.980962,0.704575,0.392384,0.082442,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.295425,0.607616,0.917558,0.774704,0.469140,0.165731,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.225296,0.530860,0.834269,0.864438,0.565226,0.268081,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.135562,0.434774,0.731919,0.972970,0.679850,0.388717,0.099526,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.027030,0.320150,0.611283,0.900474,0.812266,0.526899,0.243408,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.187734,0.473101,0.756592,0.961769,0.681950,0.403940,0.127702,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.038231,0.318050,0.596061,0.872298,0.853218,0.580474,0.309441,0.040106,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.146782,0.419526,0.690559,0.959894,0.772431,0.506407,0.242015,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.227569,0.493593,0.757985,0.979227,0.718035,0.458410,0.200337,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.020773,0.281965,0.541590,0.799663,0.943802,0.688777,0.435249,0.183198,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.056198,0.311223,0.564751,0.816802,0.932616,0.683474,0.435768,0.189474,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.067384,0.316526,0.564232,0.810526,0.944579,0.701058,0.458907,0.218108,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.055421,0.298942,0.541093,0.781892,0.978642,0.740495,0.503657,0.268115,0.033849,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.021358,0.259505,0.496343,0.731885,0.966151,0.800841,0.569086,0.338576,0.109281,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.199159,0.430914,0.661424,0.890719,0.881203,0.654327,0.428630,0.204101,0.000000,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.118797,0.345673,0.571370,0.795899,0.980747,0.758537,0.537464,0.317517,0.098689,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.019253,0.241463,0.462536,0.682483,0.901311,0.880959,0.664314,0.448769,0.234285,0.020857,0.000000,0.000000,0.000000,0.000000,},{0.119041,0.335686,0.551231,0.765715,0.979143,0.808487,0.597155,0.386847,0.177554,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.191513,0.402845,0.613153,0.822446,0.969285,0.762007,0.555721,0.350421,0.146085,0.000000,0.000000,0.000000,0.000000,0.000000,},{0.030715,0.237993,0.444279,0.649579,0.853915,0.942717,0.740295,0.538827,0.338294,0.138682,0.000000,0.000000,0.000000,0.000000,},{0.057282,0.259705,0.461173,0.661706,0.861318,0.939996,0.742216,0.545334,0.349346,0.154250,0.000000,0.000000,0.000000,0.000000,},{0.060004,0.257784,0.454666,0.650654,0.845749,0.960025,0.766674,0.574184,0.382549,0.191761,0.001810,0.000000,0.000000,0.000000,},{0.039975,0.233326,0.425816,0.617451,0.808239,0.998190,0.812691,0.624400,0.436923,0.250260,0.064396,0.000000,0.000000,0.000000,},{0.187309,0.375600,0.563077,0.749740,0.935604,0.879332,0.695063,0.511565,0.328853,0.146908,0.000000,0.000000,0.000000,0.000000,},{0.120668,0.304937,0.488435,0.671147,0.853092,0.965726,0.785301,0.605624,0.426700,0.248506,0.071050,0.000000,0.000000,0.000000,},{0.034274,0.214699,0.394376,0.573300,0.751494,0.928950,0.894316,0.718311,0.543017,0.368429,0.194547,0.021358,0.000000,0.000000,},{0.105684,0.281689,0.456983,0.631571,0.805453,0.978642,0.848864,0.677053,0.505925,0.335470,0.165694,0.000000,0.000000,0.000000,},{0.151136,0.322947,0.494075,0.664530,0.834306,0.996577,0.828119,0.660316,0.493163,0.326655,0.160788,0.000000,0.000000,0.000000,},{0.003423,0.171881,0.339684,0.506837,0.673345,0.839212,0.995553,0.830948,0.666971,0.503615,0.340867,0.178741,0.017214,0.000000,},{0.004447,0.169052,0.333029,0.496385,0.659133,0.821259,0.982786,0.856290,0.695970,0.536238,0.377092,0.218534,0.060556,0.000000,},{0.143710,0.304030,0.463762,0.622908,0.781466,0.939444,0.903149,0.746317,0.590056,0.434356,0.279217,0.124629,0.000000,0.000000,},{0.096851,0.253683,0.409944,0.565644,0.720783,0.875371,0.970603,0.817110,0.664169,0.511771,0.359905,0.208573,0.057764,0.000000,},{0.029397,0.182890,0.335831,0.488229,0.640095,0.791427,0.942236,0.907489,0.757728,0.608481,0.459758,0.311541,0.163828,0.016620,},{0.092511,0.242272,0.391519,0.540241,0.688459,0.836172,0.983380,0.869918,0.723711,0.578000,0.432775,0.288037,0.143775,0.000000,}}
 #define DCT_MATRIX {0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223607, 0.223434, 0.222057, 0.219310, 0.215212, 0.209786, 0.203067, 0.195096, 0.185922, 0.175602, 0.164200, 0.151784, 0.138434, 0.124229, 0.109259, 0.093615, 0.077394, 0.060696, 0.043624, 0.026282, 0.008779, -0.008779, -0.026282, -0.043624, -0.060696, -0.077394, -0.093615, -0.109259, -0.124229, -0.138434, -0.151784, -0.164200, -0.175602, -0.185922, -0.195096, -0.203067, -0.209786, -0.215212, -0.219310, -0.222057, -0.223434, 0.222917, 0.217429, 0.206586, 0.190656, 0.170032, 0.145221, 0.116834, 0.085571, 0.052200, 0.017544, -0.017544, -0.052200, -0.085571, -0.116834, -0.145221, -0.170032, -0.190656, -0.206586, -0.217429, -0.222917, -0.222917, -0.217429, -0.206586, -0.190656, -0.170032, -0.145221, -0.116834, -0.085571, -0.052200, -0.017544, 0.017544, 0.052200, 0.085571, 0.116834, 0.145221, 0.170032, 0.190656, 0.206586, 0.217429, 0.222917, 0.222057, 0.209786, 0.185922, 0.151784, 0.109259, 0.060696, 0.008779, -0.043624, -0.093615, -0.138434, -0.175602, -0.203067, -0.219310, -0.223434, -0.215212, -0.195096, -0.164200, -0.124229, -0.077394, -0.026282, 0.026282, 0.077394, 0.124229, 0.164200, 0.195096, 0.215212, 0.223434, 0.219310, 0.203067, 0.175602, 0.138434, 0.093615, 0.043624, -0.008779, -0.060696, -0.109259, -0.151784, -0.185922, -0.209786, -0.222057, 0.220854, 0.199235, 0.158114, 0.101515, 0.034980, -0.034980, -0.101515, -0.158114, -0.199235, -0.220854, -0.220854, -0.199235, -0.158114, -0.101515, -0.034980, 0.034980, 0.101515, 0.158114, 0.199235, 0.220854, 0.220854, 0.199235, 0.158114, 0.101515, 0.034980, -0.034980, -0.101515, -0.158114, -0.199235, -0.220854, -0.220854, -0.199235, -0.158114, -0.101515, -0.034980, 0.034980, 0.101515, 0.158114, 0.199235, 0.220854, 0.219310, 0.185922, 0.124229, 0.043624, -0.043624, -0.124229, -0.185922, -0.219310, -0.219310, -0.185922, -0.124229, -0.043624, 0.043624, 0.124229, 0.185922, 0.219310, 0.219310, 0.185922, 0.124229, 0.043624, -0.043624, -0.124229, -0.185922, -0.219310, -0.219310, -0.185922, -0.124229, -0.043624, 0.043624, 0.124229, 0.185922, 0.219310, 0.219310, 0.185922, 0.124229, 0.043624, -0.043624, -0.124229, -0.185922, -0.219310, 0.217429, 0.170032, 0.085571, -0.017544, -0.116834, -0.190656, -0.222917, -0.206586, -0.145221, -0.052200, 0.052200, 0.145221, 0.206586, 0.222917, 0.190656, 0.116834, 0.017544, -0.085571, -0.170032, -0.217429, -0.217429, -0.170032, -0.085571, 0.017544, 0.116834, 0.190656, 0.222917, 0.206586, 0.145221, 0.052200, -0.052200, -0.145221, -0.206586, -0.222917, -0.190656, -0.116834, -0.017544, 0.085571, 0.170032, 0.217429, 0.215212, 0.151784, 0.043624, -0.077394, -0.175602, -0.222057, -0.203067, -0.124229, -0.008779, 0.109259, 0.195096, 0.223434, 0.185922, 0.093615, -0.026282, -0.138434, -0.209786, -0.219310, -0.164200, -0.060696, 0.060696, 0.164200, 0.219310, 0.209786, 0.138434, 0.026282, -0.093615, -0.185922, -0.223434, -0.195096, -0.109259, 0.008779, 0.124229, 0.203067, 0.222057, 0.175602, 0.077394, -0.043624, -0.151784, -0.215212, 0.212663, 0.131433, 0.000000, -0.131433, -0.212663, -0.212663, -0.131433, -0.000000, 0.131433, 0.212663, 0.212663, 0.131433, 0.000000, -0.131433, -0.212663, -0.212663, -0.131433, -0.000000, 0.131433, 0.212663, 0.212663, 0.131433, 0.000000, -0.131433, -0.212663, -0.212663, -0.131433, -0.000000, 0.131433, 0.212663, 0.212663, 0.131433, -0.000000, -0.131433, -0.212663, -0.212663, -0.131433, -0.000000, 0.131433, 0.212663, 0.209786, 0.109259, -0.043624, -0.175602, -0.223434, -0.164200, -0.026282, 0.124229, 0.215212, 0.203067, 0.093615, -0.060696, -0.185922, -0.222057, -0.151784, -0.008779, 0.138434, 0.219310, 0.195096, 0.077394, -0.077394, -0.195096, -0.219310, -0.138434, 0.008779, 0.151784, 0.222057, 0.185922, 0.060696, -0.093615, -0.203067, -0.215212, -0.124229, 0.026282, 0.164200, 0.223434, 0.175602, 0.043624, -0.109259, -0.209786, 0.206586, 0.085571, -0.085571, -0.206586, -0.206586, -0.085571, 0.085571, 0.206586, 0.206586, 0.085571, -0.085571, -0.206586, -0.206586, -0.085571, 0.085571, 0.206586, 0.206586, 0.085571, -0.085571, -0.206586, -0.206586, -0.085571, 0.085571, 0.206586, 0.206586, 0.085571, -0.085571, -0.206586, -0.206586, -0.085571, 0.085571, 0.206586, 0.206586, 0.085571, -0.085571, -0.206586, -0.206586, -0.085571, 0.085571, 0.206586, 0.203067, 0.060696, -0.124229, -0.222057, -0.164200, 0.008779, 0.175602, 0.219310, 0.109259, -0.077394, -0.209786, -0.195096, -0.043624, 0.138434, 0.223434, 0.151784, -0.026282, -0.185922, -0.215212, -0.093615, 0.093615, 0.215212, 0.185922, 0.026282, -0.151784, -0.223434, -0.138434, 0.043624, 0.195096, 0.209786, 0.077394, -0.109259, -0.219310, -0.175602, -0.008779, 0.164200, 0.222057, 0.124229, -0.060696, -0.203067, 0.199235, 0.034980, -0.158114, -0.220854, -0.101515, 0.101515, 0.220854, 0.158114, -0.034980, -0.199235, -0.199235, -0.034980, 0.158114, 0.220854, 0.101515, -0.101515, -0.220854, -0.158114, 0.034980, 0.199235, 0.199235, 0.034980, -0.158114, -0.220854, -0.101515, 0.101515, 0.220854, 0.158114, -0.034980, -0.199235, -0.199235, -0.034980, 0.158114, 0.220854, 0.101515, -0.101515, -0.220854, -0.158114, 0.034980, 0.199235, 0.195096, 0.008779, -0.185922, -0.203067, -0.026282, 0.175602, 0.209786, 0.043624, -0.164200, -0.215212, -0.060696, 0.151784, 0.219310, 0.077394, -0.138434, -0.222057, -0.093615, 0.124229, 0.223434, 0.109259, -0.109259, -0.223434, -0.124229, 0.093615, 0.222057, 0.138434, -0.077394, -0.219310, -0.151784, 0.060696, 0.215212, 0.164200, -0.043624, -0.209786, -0.175602, 0.026282, 0.203067, 0.185922, -0.008779, -0.195096, 0.190656, -0.017544, -0.206586, -0.170032, 0.052200, 0.217429, 0.145221, -0.085571, -0.222917, -0.116834, 0.116834, 0.222917, 0.085571, -0.145221, -0.217429, -0.052200, 0.170032, 0.206586, 0.017544, -0.190656, -0.190656, 0.017544, 0.206586, 0.170032, -0.052200, -0.217429, -0.145221, 0.085571, 0.222917, 0.116834, -0.116834, -0.222917, -0.085571, 0.145221, 0.217429, 0.052200, -0.170032, -0.206586, -0.017544, 0.190656, 0.185922, -0.043624, -0.219310, -0.124229, 0.124229, 0.219310, 0.043624, -0.185922, -0.185922, 0.043624, 0.219310, 0.124229, -0.124229, -0.219310, -0.043624, 0.185922, 0.185922, -0.043624, -0.219310, -0.124229, 0.124229, 0.219310, 0.043624, -0.185922, -0.185922, 0.043624, 0.219310, 0.124229, -0.124229, -0.219310, -0.043624, 0.185922, 0.185922, -0.043624, -0.219310, -0.124229, 0.124229, 0.219310, 0.043624, -0.185922, 0.180902, -0.069098, -0.223607, -0.069098, 0.180902, 0.180902, -0.069098, -0.223607, -0.069098, 0.180902, 0.180902, -0.069098, -0.223607, -0.069098, 0.180902, 0.180902, -0.069098, -0.223607, -0.069098, 0.180902, 0.180902, -0.069098, -0.223607, -0.069098, 0.180902, 0.180902, -0.069098, -0.223607, -0.069098, 0.180902, 0.180902, -0.069098, -0.223607, -0.069098, 0.180902, 0.180902, -0.069098, -0.223607, -0.069098, 0.180902, 0.175602, -0.093615, -0.219310, -0.008779, 0.215212, 0.109259, -0.164200, -0.185922, 0.077394, 0.222057, 0.026282, -0.209786, -0.124229, 0.151784, 0.195096, -0.060696, -0.223434, -0.043624, 0.203067, 0.138434, -0.138434, -0.203067, 0.043624, 0.223434, 0.060696, -0.195096, -0.151784, 0.124229, 0.209786, -0.026282, -0.222057, -0.077394, 0.185922, 0.164200, -0.109259, -0.215212, 0.008779, 0.219310, 0.093615, -0.175602, 0.170032, -0.116834, -0.206586, 0.052200, 0.222917, 0.017544, -0.217429, -0.085571, 0.190656, 0.145221, -0.145221, -0.190656, 0.085571, 0.217429, -0.017544, -0.222917, -0.052200, 0.206586, 0.116834, -0.170032, -0.170032, 0.116834, 0.206586, -0.052200, -0.222917, -0.017544, 0.217429, 0.085571, -0.190656, -0.145221, 0.145221, 0.190656, -0.085571, -0.217429, 0.017544, 0.222917, 0.052200, -0.206586, -0.116834, 0.170032, 0.164200, -0.138434, -0.185922, 0.109259, 0.203067, -0.077394, -0.215212, 0.043624, 0.222057, -0.008779, -0.223434, -0.026282, 0.219310, 0.060696, -0.209786, -0.093615, 0.195096, 0.124229, -0.175602, -0.151784, 0.151784, 0.175602, -0.124229, -0.195096, 0.093615, 0.209786, -0.060696, -0.219310, 0.026282, 0.223434, 0.008779, -0.222057, -0.043624, 0.215212, 0.077394, -0.203067, -0.109259, 0.185922, 0.138434, -0.164200, 0.158114, -0.158114, -0.158114, 0.158114, 0.158114, -0.158114, -0.158114, 0.158114, 0.158114, -0.158114, -0.158114, 0.158114, 0.158114, -0.158114, -0.158114, 0.158114, 0.158114, -0.158114, -0.158114, 0.158114, 0.158114, -0.158114, -0.158114, 0.158114, 0.158114, -0.158114, -0.158114, 0.158114, 0.158114, -0.158114, -0.158114, 0.158114, 0.158114, -0.158114, -0.158114, 0.158114, 0.158114, -0.158114, -0.158114, 0.158114, 0.151784, -0.175602, -0.124229, 0.195096, 0.093615, -0.209786, -0.060696, 0.219310, 0.026282, -0.223434, 0.008779, 0.222057, -0.043624, -0.215212, 0.077394, 0.203067, -0.109259, -0.185922, 0.138434, 0.164200, -0.164200, -0.138434, 0.185922, 0.109259, -0.203067, -0.077394, 0.215212, 0.043624, -0.222057, -0.008779, 0.223434, -0.026282, -0.219310, 0.060696, 0.209786, -0.093615, -0.195096, 0.124229, 0.175602, -0.151784, 0.145221, -0.190656, -0.085571, 0.217429, 0.017544, -0.222917, 0.052200, 0.206586, -0.116834, -0.170032, 0.170032, 0.116834, -0.206586, -0.052200, 0.222917, -0.017544, -0.217429, 0.085571, 0.190656, -0.145221, -0.145221, 0.190656, 0.085571, -0.217429, -0.017544, 0.222917, -0.052200, -0.206586, 0.116834, 0.170032, -0.170032, -0.116834, 0.206586, 0.052200, -0.222917, 0.017544, 0.217429, -0.085571, -0.190656, 0.145221, 0.138434, -0.203067, -0.043624, 0.223434, -0.060696, -0.195096, 0.151784, 0.124229, -0.209786, -0.026282, 0.222057, -0.077394, -0.185922, 0.164200, 0.109259, -0.215212, -0.008779, 0.219310, -0.093615, -0.175602, 0.175602, 0.093615, -0.219310, 0.008779, 0.215212, -0.109259, -0.164200, 0.185922, 0.077394, -0.222057, 0.026282, 0.209786, -0.124229, -0.151784, 0.195096, 0.060696, -0.223434, 0.043624, 0.203067, -0.138434, 0.131433, -0.212663, -0.000000, 0.212663, -0.131433, -0.131433, 0.212663, 0.000000, -0.212663, 0.131433, 0.131433, -0.212663, -0.000000, 0.212663, -0.131433, -0.131433, 0.212663, -0.000000, -0.212663, 0.131433, 0.131433, -0.212663, -0.000000, 0.212663, -0.131433, -0.131433, 0.212663, 0.000000, -0.212663, 0.131433, 0.131433, -0.212663, 0.000000, 0.212663, -0.131433, -0.131433, 0.212663, 0.000000, -0.212663, 0.131433, 0.124229, -0.219310, 0.043624, 0.185922, -0.185922, -0.043624, 0.219310, -0.124229, -0.124229, 0.219310, -0.043624, -0.185922, 0.185922, 0.043624, -0.219310, 0.124229, 0.124229, -0.219310, 0.043624, 0.185922, -0.185922, -0.043624, 0.219310, -0.124229, -0.124229, 0.219310, -0.043624, -0.185922, 0.185922, 0.043624, -0.219310, 0.124229, 0.124229, -0.219310, 0.043624, 0.185922, -0.185922, -0.043624, 0.219310, -0.124229, 0.116834, -0.222917, 0.085571, 0.145221, -0.217429, 0.052200, 0.170032, -0.206586, 0.017544, 0.190656, -0.190656, -0.017544, 0.206586, -0.170032, -0.052200, 0.217429, -0.145221, -0.085571, 0.222917, -0.116834, -0.116834, 0.222917, -0.085571, -0.145221, 0.217429, -0.052200, -0.170032, 0.206586, -0.017544, -0.190656, 0.190656, 0.017544, -0.206586, 0.170032, 0.052200, -0.217429, 0.145221, 0.085571, -0.222917, 0.116834, 0.109259, -0.223434, 0.124229, 0.093615, -0.222057, 0.138434, 0.077394, -0.219310, 0.151784, 0.060696, -0.215212, 0.164200, 0.043624, -0.209786, 0.175602, 0.026282, -0.203067, 0.185922, 0.008779, -0.195096, 0.195096, -0.008779, -0.185922, 0.203067, -0.026282, -0.175602, 0.209786, -0.043624, -0.164200, 0.215212, -0.060696, -0.151784, 0.219310, -0.077394, -0.138434, 0.222057, -0.093615, -0.124229, 0.223434, -0.109259, 0.101515, -0.220854, 0.158114, 0.034980, -0.199235, 0.199235, -0.034980, -0.158114, 0.220854, -0.101515, -0.101515, 0.220854, -0.158114, -0.034980, 0.199235, -0.199235, 0.034980, 0.158114, -0.220854, 0.101515, 0.101515, -0.220854, 0.158114, 0.034980, -0.199235, 0.199235, -0.034980, -0.158114, 0.220854, -0.101515, -0.101515, 0.220854, -0.158114, -0.034980, 0.199235, -0.199235, 0.034980, 0.158114, -0.220854, 0.101515, 0.093615, -0.215212, 0.185922, -0.026282, -0.151784, 0.223434, -0.138434, -0.043624, 0.195096, -0.209786, 0.077394, 0.109259, -0.219310, 0.175602, -0.008779, -0.164200, 0.222057, -0.124229, -0.060696, 0.203067, -0.203067, 0.060696, 0.124229, -0.222057, 0.164200, 0.008779, -0.175602, 0.219310, -0.109259, -0.077394, 0.209786, -0.195096, 0.043624, 0.138434, -0.223434, 0.151784, 0.026282, -0.185922, 0.215212, -0.093615, 0.085571, -0.206586, 0.206586, -0.085571, -0.085571, 0.206586, -0.206586, 0.085571, 0.085571, -0.206586, 0.206586, -0.085571, -0.085571, 0.206586, -0.206586, 0.085571, 0.085571, -0.206586, 0.206586, -0.085571, -0.085571, 0.206586, -0.206586, 0.085571, 0.085571, -0.206586, 0.206586, -0.085571, -0.085571, 0.206586, -0.206586, 0.085571, 0.085571, -0.206586, 0.206586, -0.085571, -0.085571, 0.206586, -0.206586, 0.085571, 0.077394, -0.195096, 0.219310, -0.138434, -0.008779, 0.151784, -0.222057, 0.185922, -0.060696, -0.093615, 0.203067, -0.215212, 0.124229, 0.026282, -0.164200, 0.223434, -0.175602, 0.043624, 0.109259, -0.209786, 0.209786, -0.109259, -0.043624, 0.175602, -0.223434, 0.164200, -0.026282, -0.124229, 0.215212, -0.203067, 0.093615, 0.060696, -0.185922, 0.222057, -0.151784, 0.008779, 0.138434, -0.219310, 0.195096, -0.077394, 0.069098, -0.180902, 0.223607, -0.180902, 0.069098, 0.069098, -0.180902, 0.223607, -0.180902, 0.069098, 0.069098, -0.180902, 0.223607, -0.180902, 0.069098, 0.069098, -0.180902, 0.223607, -0.180902, 0.069098, 0.069098, -0.180902, 0.223607, -0.180902, 0.069098, 0.069098, -0.180902, 0.223607, -0.180902, 0.069098, 0.069098, -0.180902, 0.223607, -0.180902, 0.069098, 0.069098, -0.180902, 0.223607, -0.180902, 0.069098, 0.060696, -0.164200, 0.219310, -0.209786, 0.138434, -0.026282, -0.093615, 0.185922, -0.223434, 0.195096, -0.109259, -0.008779, 0.124229, -0.203067, 0.222057, -0.175602, 0.077394, 0.043624, -0.151784, 0.215212, -0.215212, 0.151784, -0.043624, -0.077394, 0.175602, -0.222057, 0.203067, -0.124229, 0.008779, 0.109259, -0.195096, 0.223434, -0.185922, 0.093615, 0.026282, -0.138434, 0.209786, -0.219310, 0.164200, -0.060696, 0.052200, -0.145221, 0.206586, -0.222917, 0.190656, -0.116834, 0.017544, 0.085571, -0.170032, 0.217429, -0.217429, 0.170032, -0.085571, -0.017544, 0.116834, -0.190656, 0.222917, -0.206586, 0.145221, -0.052200, -0.052200, 0.145221, -0.206586, 0.222917, -0.190656, 0.116834, -0.017544, -0.085571, 0.170032, -0.217429, 0.217429, -0.170032, 0.085571, 0.017544, -0.116834, 0.190656, -0.222917, 0.206586, -0.145221, 0.052200, 0.043624, -0.124229, 0.185922, -0.219310, 0.219310, -0.185922, 0.124229, -0.043624, -0.043624, 0.124229, -0.185922, 0.219310, -0.219310, 0.185922, -0.124229, 0.043624, 0.043624, -0.124229, 0.185922, -0.219310, 0.219310, -0.185922, 0.124229, -0.043624, -0.043624, 0.124229, -0.185922, 0.219310, -0.219310, 0.185922, -0.124229, 0.043624, 0.043624, -0.124229, 0.185922, -0.219310, 0.219310, -0.185922, 0.124229, -0.043624, 0.034980, -0.101515, 0.158114, -0.199235, 0.220854, -0.220854, 0.199235, -0.158114, 0.101515, -0.034980, -0.034980, 0.101515, -0.158114, 0.199235, -0.220854, 0.220854, -0.199235, 0.158114, -0.101515, 0.034980, 0.034980, -0.101515, 0.158114, -0.199235, 0.220854, -0.220854, 0.199235, -0.158114, 0.101515, -0.034980, -0.034980, 0.101515, -0.158114, 0.199235, -0.220854, 0.220854, -0.199235, 0.158114, -0.101515, 0.034980, 0.026282, -0.077394, 0.124229, -0.164200, 0.195096, -0.215212, 0.223434, -0.219310, 0.203067, -0.175602, 0.138434, -0.093615, 0.043624, 0.008779, -0.060696, 0.109259, -0.151784, 0.185922, -0.209786, 0.222057, -0.222057, 0.209786, -0.185922, 0.151784, -0.109259, 0.060696, -0.008779, -0.043624, 0.093615, -0.138434, 0.175602, -0.203067, 0.219310, -0.223434, 0.215212, -0.195096, 0.164200, -0.124229, 0.077394, -0.026282, 0.017544, -0.052200, 0.085571, -0.116834, 0.145221, -0.170032, 0.190656, -0.206586, 0.217429, -0.222917, 0.222917, -0.217429, 0.206586, -0.190656, 0.170032, -0.145221, 0.116834, -0.085571, 0.052200, -0.017544, -0.017544, 0.052200, -0.085571, 0.116834, -0.145221, 0.170032, -0.190656, 0.206586, -0.217429, 0.222917, -0.222917, 0.217429, -0.206586, 0.190656, -0.170032, 0.145221, -0.116834, 0.085571, -0.052200, 0.017544, 0.008779, -0.026282, 0.043624, -0.060696, 0.077394, -0.093615, 0.109259, -0.124229, 0.138434, -0.151784, 0.164200, -0.175602, 0.185922, -0.195096, 0.203067, -0.209786, 0.215212, -0.219310, 0.222057, -0.223434, 0.223434, -0.222057, 0.219310, -0.215212, 0.209786, -0.203067, 0.195096, -0.185922, 0.175602, -0.164200, 0.151784, -0.138434, 0.124229, -0.109259, 0.093615, -0.077394, 0.060696, -0.043624, 0.026282, -0.008779}
 #define TWIDDLECOEF_RFFT_1024 { 0.000000000f,  1.000000000f, 0.006135885f,  0.999981175f, 0.012271538f,  0.999924702f, 0.018406730f,  0.999830582f, 0.024541229f,  0.999698819f, 0.030674803f,  0.999529418f, 0.036807223f,  0.999322385f, 0.042938257f,  0.999077728f, 0.049067674f,  0.998795456f, 0.055195244f,  0.998475581f, 0.061320736f,  0.998118113f, 0.067443920f,  0.997723067f, 0.073564564f,  0.997290457f, 0.079682438f,  0.996820299f, 0.085797312f,  0.996312612f, 0.091908956f,  0.995767414f, 0.098017140f,  0.995184727f, 0.104121634f,  0.994564571f, 0.110222207f,  0.993906970f, 0.116318631f,  0.993211949f, 0.122410675f,  0.992479535f, 0.128498111f,  0.991709754f, 0.134580709f,  0.990902635f, 0.140658239f,  0.990058210f, 0.146730474f,  0.989176510f, 0.152797185f,  0.988257568f, 0.158858143f,  0.987301418f, 0.164913120f,  0.986308097f, 0.170961889f,  0.985277642f, 0.177004220f,  0.984210092f, 0.183039888f,  0.983105487f, 0.189068664f,  0.981963869f, 0.195090322f,  0.980785280f, 0.201104635f,  0.979569766f, 0.207111376f,  0.978317371f, 0.213110320f,  0.977028143f, 0.219101240f,  0.975702130f, 0.225083911f,  0.974339383f, 0.231058108f,  0.972939952f, 0.237023606f,  0.971503891f, 0.242980180f,  0.970031253f, 0.248927606f,  0.968522094f, 0.254865660f,  0.966976471f, 0.260794118f,  0.965394442f, 0.266712757f,  0.963776066f, 0.272621355f,  0.962121404f, 0.278519689f,  0.960430519f, 0.284407537f,  0.958703475f, 0.290284677f,  0.956940336f, 0.296150888f,  0.955141168f, 0.302005949f,  0.953306040f, 0.307849640f,  0.951435021f, 0.313681740f,  0.949528181f, 0.319502031f,  0.947585591f, 0.325310292f,  0.945607325f, 0.331106306f,  0.943593458f, 0.336889853f,  0.941544065f, 0.342660717f,  0.939459224f, 0.348418680f,  0.937339012f, 0.354163525f,  0.935183510f, 0.359895037f,  0.932992799f, 0.365612998f,  0.930766961f, 0.371317194f,  0.928506080f, 0.377007410f,  0.926210242f, 0.382683432f,  0.923879533f, 0.388345047f,  0.921514039f, 0.393992040f,  0.919113852f, 0.399624200f,  0.916679060f, 0.405241314f,  0.914209756f, 0.410843171f,  0.911706032f, 0.416429560f,  0.909167983f, 0.422000271f,  0.906595705f, 0.427555093f,  0.903989293f, 0.433093819f,  0.901348847f, 0.438616239f,  0.898674466f, 0.444122145f,  0.895966250f, 0.449611330f,  0.893224301f, 0.455083587f,  0.890448723f, 0.460538711f,  0.887639620f, 0.465976496f,  0.884797098f, 0.471396737f,  0.881921264f, 0.476799230f,  0.879012226f, 0.482183772f,  0.876070094f, 0.487550160f,  0.873094978f, 0.492898192f,  0.870086991f, 0.498227667f,  0.867046246f, 0.503538384f,  0.863972856f, 0.508830143f,  0.860866939f, 0.514102744f,  0.857728610f, 0.519355990f,  0.854557988f, 0.524589683f,  0.851355193f, 0.529803625f,  0.848120345f, 0.534997620f,  0.844853565f, 0.540171473f,  0.841554977f, 0.545324988f,  0.838224706f, 0.550457973f,  0.834862875f, 0.555570233f,  0.831469612f, 0.560661576f,  0.828045045f, 0.565731811f,  0.824589303f, 0.570780746f,  0.821102515f, 0.575808191f,  0.817584813f, 0.580813958f,  0.814036330f, 0.585797857f,  0.810457198f, 0.590759702f,  0.806847554f, 0.595699304f,  0.803207531f, 0.600616479f,  0.799537269f, 0.605511041f,  0.795836905f, 0.610382806f,  0.792106577f, 0.615231591f,  0.788346428f, 0.620057212f,  0.784556597f, 0.624859488f,  0.780737229f, 0.629638239f,  0.776888466f, 0.634393284f,  0.773010453f, 0.639124445f,  0.769103338f, 0.643831543f,  0.765167266f, 0.648514401f,  0.761202385f, 0.653172843f,  0.757208847f, 0.657806693f,  0.753186799f, 0.662415778f,  0.749136395f, 0.666999922f,  0.745057785f, 0.671558955f,  0.740951125f, 0.676092704f,  0.736816569f, 0.680600998f,  0.732654272f, 0.685083668f,  0.728464390f, 0.689540545f,  0.724247083f, 0.693971461f,  0.720002508f, 0.698376249f,  0.715730825f, 0.702754744f,  0.711432196f, 0.707106781f,  0.707106781f, 0.711432196f,  0.702754744f, 0.715730825f,  0.698376249f, 0.720002508f,  0.693971461f, 0.724247083f,  0.689540545f, 0.728464390f,  0.685083668f, 0.732654272f,  0.680600998f, 0.736816569f,  0.676092704f, 0.740951125f,  0.671558955f, 0.745057785f,  0.666999922f, 0.749136395f,  0.662415778f, 0.753186799f,  0.657806693f, 0.757208847f,  0.653172843f, 0.761202385f,  0.648514401f, 0.765167266f,  0.643831543f, 0.769103338f,  0.639124445f, 0.773010453f,  0.634393284f, 0.776888466f,  0.629638239f, 0.780737229f,  0.624859488f, 0.784556597f,  0.620057212f, 0.788346428f,  0.615231591f, 0.792106577f,  0.610382806f, 0.795836905f,  0.605511041f, 0.799537269f,  0.600616479f, 0.803207531f,  0.595699304f, 0.806847554f,  0.590759702f, 0.810457198f,  0.585797857f, 0.814036330f,  0.580813958f, 0.817584813f,  0.575808191f, 0.821102515f,  0.570780746f, 0.824589303f,  0.565731811f, 0.828045045f,  0.560661576f, 0.831469612f,  0.555570233f, 0.834862875f,  0.550457973f, 0.838224706f,  0.545324988f, 0.841554977f,  0.540171473f, 0.844853565f,  0.534997620f, 0.848120345f,  0.529803625f, 0.851355193f,  0.524589683f, 0.854557988f,  0.519355990f, 0.857728610f,  0.514102744f, 0.860866939f,  0.508830143f, 0.863972856f,  0.503538384f, 0.867046246f,  0.498227667f, 0.870086991f,  0.492898192f, 0.873094978f,  0.487550160f, 0.876070094f,  0.482183772f, 0.879012226f,  0.476799230f, 0.881921264f,  0.471396737f, 0.884797098f,  0.465976496f, 0.887639620f,  0.460538711f, 0.890448723f,  0.455083587f, 0.893224301f,  0.449611330f, 0.895966250f,  0.444122145f, 0.898674466f,  0.438616239f, 0.901348847f,  0.433093819f, 0.903989293f,  0.427555093f, 0.906595705f,  0.422000271f, 0.909167983f,  0.416429560f, 0.911706032f,  0.410843171f, 0.914209756f,  0.405241314f, 0.916679060f,  0.399624200f, 0.919113852f,  0.393992040f, 0.921514039f,  0.388345047f, 0.923879533f,  0.382683432f, 0.926210242f,  0.377007410f, 0.928506080f,  0.371317194f, 0.930766961f,  0.365612998f, 0.932992799f,  0.359895037f, 0.935183510f,  0.354163525f, 0.937339012f,  0.348418680f, 0.939459224f,  0.342660717f, 0.941544065f,  0.336889853f, 0.943593458f,  0.331106306f, 0.945607325f,  0.325310292f, 0.947585591f,  0.319502031f, 0.949528181f,  0.313681740f, 0.951435021f,  0.307849640f, 0.953306040f,  0.302005949f, 0.955141168f,  0.296150888f, 0.956940336f,  0.290284677f, 0.958703475f,  0.284407537f, 0.960430519f,  0.278519689f, 0.962121404f,  0.272621355f, 0.963776066f,  0.266712757f, 0.965394442f,  0.260794118f, 0.966976471f,  0.254865660f, 0.968522094f,  0.248927606f, 0.970031253f,  0.242980180f, 0.971503891f,  0.237023606f, 0.972939952f,  0.231058108f, 0.974339383f,  0.225083911f, 0.975702130f,  0.219101240f, 0.977028143f,  0.213110320f, 0.978317371f,  0.207111376f, 0.979569766f,  0.201104635f, 0.980785280f,  0.195090322f, 0.981963869f,  0.189068664f, 0.983105487f,  0.183039888f, 0.984210092f,  0.177004220f, 0.985277642f,  0.170961889f, 0.986308097f,  0.164913120f, 0.987301418f,  0.158858143f, 0.988257568f,  0.152797185f, 0.989176510f,  0.146730474f, 0.990058210f,  0.140658239f, 0.990902635f,  0.134580709f, 0.991709754f,  0.128498111f, 0.992479535f,  0.122410675f, 0.993211949f,  0.116318631f, 0.993906970f,  0.110222207f, 0.994564571f,  0.104121634f, 0.995184727f,  0.098017140f, 0.995767414f,  0.091908956f, 0.996312612f,  0.085797312f, 0.996820299f,  0.079682438f, 0.997290457f,  0.073564564f, 0.997723067f,  0.067443920f, 0.998118113f,  0.061320736f, 0.998475581f,  0.055195244f, 0.998795456f,  0.049067674f, 0.999077728f,  0.042938257f, 0.999322385f,  0.036807223f, 0.999529418f,  0.030674803f, 0.999698819f,  0.024541229f, 0.999830582f,  0.018406730f, 0.999924702f,  0.012271538f, 0.999981175f,  0.006135885f, 1.000000000f,  0.000000000f, 0.999981175f, -0.006135885f, 0.999924702f, -0.012271538f, 0.999830582f, -0.018406730f, 0.999698819f, -0.024541229f, 0.999529418f, -0.030674803f, 0.999322385f, -0.036807223f, 0.999077728f, -0.042938257f, 0.998795456f, -0.049067674f, 0.998475581f, -0.055195244f, 0.998118113f, -0.061320736f, 0.997723067f, -0.067443920f, 0.997290457f, -0.073564564f, 0.996820299f, -0.079682438f, 0.996312612f, -0.085797312f, 0.995767414f, -0.091908956f, 0.995184727f, -0.098017140f, 0.994564571f, -0.104121634f, 0.993906970f, -0.110222207f, 0.993211949f, -0.116318631f, 0.992479535f, -0.122410675f, 0.991709754f, -0.128498111f, 0.990902635f, -0.134580709f, 0.990058210f, -0.140658239f, 0.989176510f, -0.146730474f, 0.988257568f, -0.152797185f, 0.987301418f, -0.158858143f, 0.986308097f, -0.164913120f, 0.985277642f, -0.170961889f, 0.984210092f, -0.177004220f, 0.983105487f, -0.183039888f, 0.981963869f, -0.189068664f, 0.980785280f, -0.195090322f, 0.979569766f, -0.201104635f, 0.978317371f, -0.207111376f, 0.977028143f, -0.213110320f, 0.975702130f, -0.219101240f, 0.974339383f, -0.225083911f, 0.972939952f, -0.231058108f, 0.971503891f, -0.237023606f, 0.970031253f, -0.242980180f, 0.968522094f, -0.248927606f, 0.966976471f, -0.254865660f, 0.965394442f, -0.260794118f, 0.963776066f, -0.266712757f, 0.962121404f, -0.272621355f, 0.960430519f, -0.278519689f, 0.958703475f, -0.284407537f, 0.956940336f, -0.290284677f, 0.955141168f, -0.296150888f, 0.953306040f, -0.302005949f, 0.951435021f, -0.307849640f, 0.949528181f, -0.313681740f, 0.947585591f, -0.319502031f, 0.945607325f, -0.325310292f, 0.943593458f, -0.331106306f, 0.941544065f, -0.336889853f, 0.939459224f, -0.342660717f, 0.937339012f, -0.348418680f, 0.935183510f, -0.354163525f, 0.932992799f, -0.359895037f, 0.930766961f, -0.365612998f, 0.928506080f, -0.371317194f, 0.926210242f, -0.377007410f, 0.923879533f, -0.382683432f, 0.921514039f, -0.388345047f, 0.919113852f, -0.393992040f, 0.916679060f, -0.399624200f, 0.914209756f, -0.405241314f, 0.911706032f, -0.410843171f, 0.909167983f, -0.416429560f, 0.906595705f, -0.422000271f, 0.903989293f, -0.427555093f, 0.901348847f, -0.433093819f, 0.898674466f, -0.438616239f, 0.895966250f, -0.444122145f, 0.893224301f, -0.449611330f, 0.890448723f, -0.455083587f, 0.887639620f, -0.460538711f, 0.884797098f, -0.465976496f, 0.881921264f, -0.471396737f, 0.879012226f, -0.476799230f, 0.876070094f, -0.482183772f, 0.873094978f, -0.487550160f, 0.870086991f, -0.492898192f, 0.867046246f, -0.498227667f, 0.863972856f, -0.503538384f, 0.860866939f, -0.508830143f, 0.857728610f, -0.514102744f, 0.854557988f, -0.519355990f, 0.851355193f, -0.524589683f, 0.848120345f, -0.529803625f, 0.844853565f, -0.534997620f, 0.841554977f, -0.540171473f, 0.838224706f, -0.545324988f, 0.834862875f, -0.550457973f, 0.831469612f, -0.555570233f, 0.828045045f, -0.560661576f, 0.824589303f, -0.565731811f, 0.821102515f, -0.570780746f, 0.817584813f, -0.575808191f, 0.814036330f, -0.580813958f, 0.810457198f, -0.585797857f, 0.806847554f, -0.590759702f, 0.803207531f, -0.595699304f, 0.799537269f, -0.600616479f, 0.795836905f, -0.605511041f, 0.792106577f, -0.610382806f, 0.788346428f, -0.615231591f, 0.784556597f, -0.620057212f, 0.780737229f, -0.624859488f, 0.776888466f, -0.629638239f, 0.773010453f, -0.634393284f, 0.769103338f, -0.639124445f, 0.765167266f, -0.643831543f, 0.761202385f, -0.648514401f, 0.757208847f, -0.653172843f, 0.753186799f, -0.657806693f, 0.749136395f, -0.662415778f, 0.745057785f, -0.666999922f, 0.740951125f, -0.671558955f, 0.736816569f, -0.676092704f, 0.732654272f, -0.680600998f, 0.728464390f, -0.685083668f, 0.724247083f, -0.689540545f, 0.720002508f, -0.693971461f, 0.715730825f, -0.698376249f, 0.711432196f, -0.702754744f, 0.707106781f, -0.707106781f, 0.702754744f, -0.711432196f, 0.698376249f, -0.715730825f, 0.693971461f, -0.720002508f, 0.689540545f, -0.724247083f, 0.685083668f, -0.728464390f, 0.680600998f, -0.732654272f, 0.676092704f, -0.736816569f, 0.671558955f, -0.740951125f, 0.666999922f, -0.745057785f, 0.662415778f, -0.749136395f, 0.657806693f, -0.753186799f, 0.653172843f, -0.757208847f, 0.648514401f, -0.761202385f, 0.643831543f, -0.765167266f, 0.639124445f, -0.769103338f, 0.634393284f, -0.773010453f, 0.629638239f, -0.776888466f, 0.624859488f, -0.780737229f, 0.620057212f, -0.784556597f, 0.615231591f, -0.788346428f, 0.610382806f, -0.792106577f, 0.605511041f, -0.795836905f, 0.600616479f, -0.799537269f, 0.595699304f, -0.803207531f, 0.590759702f, -0.806847554f, 0.585797857f, -0.810457198f, 0.580813958f, -0.814036330f, 0.575808191f, -0.817584813f, 0.570780746f, -0.821102515f, 0.565731811f, -0.824589303f, 0.560661576f, -0.828045045f, 0.555570233f, -0.831469612f, 0.550457973f, -0.834862875f, 0.545324988f, -0.838224706f, 0.540171473f, -0.841554977f, 0.534997620f, -0.844853565f, 0.529803625f, -0.848120345f, 0.524589683f, -0.851355193f, 0.519355990f, -0.854557988f, 0.514102744f, -0.857728610f, 0.508830143f, -0.860866939f, 0.503538384f, -0.863972856f, 0.498227667f, -0.867046246f, 0.492898192f, -0.870086991f, 0.487550160f, -0.873094978f, 0.482183772f, -0.876070094f, 0.476799230f, -0.879012226f, 0.471396737f, -0.881921264f, 0.465976496f, -0.884797098f, 0.460538711f, -0.887639620f, 0.455083587f, -0.890448723f, 0.449611330f, -0.893224301f, 0.444122145f, -0.895966250f, 0.438616239f, -0.898674466f, 0.433093819f, -0.901348847f, 0.427555093f, -0.903989293f, 0.422000271f, -0.906595705f, 0.416429560f, -0.909167983f, 0.410843171f, -0.911706032f, 0.405241314f, -0.914209756f, 0.399624200f, -0.916679060f, 0.393992040f, -0.919113852f, 0.388345047f, -0.921514039f, 0.382683432f, -0.923879533f, 0.377007410f, -0.926210242f, 0.371317194f, -0.928506080f, 0.365612998f, -0.930766961f, 0.359895037f, -0.932992799f, 0.354163525f, -0.935183510f, 0.348418680f, -0.937339012f, 0.342660717f, -0.939459224f, 0.336889853f, -0.941544065f, 0.331106306f, -0.943593458f, 0.325310292f, -0.945607325f, 0.319502031f, -0.947585591f, 0.313681740f, -0.949528181f, 0.307849640f, -0.951435021f, 0.302005949f, -0.953306040f, 0.296150888f, -0.955141168f, 0.290284677f, -0.956940336f, 0.284407537f, -0.958703475f, 0.278519689f, -0.960430519f, 0.272621355f, -0.962121404f, 0.266712757f, -0.963776066f, 0.260794118f, -0.965394442f, 0.254865660f, -0.966976471f, 0.248927606f, -0.968522094f, 0.242980180f, -0.970031253f, 0.237023606f, -0.971503891f, 0.231058108f, -0.972939952f, 0.225083911f, -0.974339383f, 0.219101240f, -0.975702130f, 0.213110320f, -0.977028143f, 0.207111376f, -0.978317371f, 0.201104635f, -0.979569766f, 0.195090322f, -0.980785280f, 0.189068664f, -0.981963869f, 0.183039888f, -0.983105487f, 0.177004220f, -0.984210092f, 0.170961889f, -0.985277642f, 0.164913120f, -0.986308097f, 0.158858143f, -0.987301418f, 0.152797185f, -0.988257568f, 0.146730474f, -0.989176510f, 0.140658239f, -0.990058210f, 0.134580709f, -0.990902635f, 0.128498111f, -0.991709754f, 0.122410675f, -0.992479535f, 0.116318631f, -0.993211949f, 0.110222207f, -0.993906970f, 0.104121634f, -0.994564571f, 0.098017140f, -0.995184727f, 0.091908956f, -0.995767414f, 0.085797312f, -0.996312612f, 0.079682438f, -0.996820299f, 0.073564564f, -0.997290457f, 0.067443920f, -0.997723067f, 0.061320736f, -0.998118113f, 0.055195244f, -0.998475581f, 0.049067674f, -0.998795456f, 0.042938257f, -0.999077728f, 0.036807223f, -0.999322385f, 0.030674803f, -0.999529418f, 0.024541229f, -0.999698819f, 0.018406730f, -0.999830582f, 0.012271538f, -0.999924702f, 0.006135885f, -0.999981175f }
 
@@ -23,6 +20,9 @@
 #define NUM_BINS 513
 
 #define NUM_FBANK_BINS 80
+#define MFCC_SAMPLE_RATE 16000
+#define MFCC_LOW_FREQ 20.0f      // mel filterbank 범위 (Hz), filterbank는 mfcc_init 때 생성
+#define MFCC_HIGH_FREQ 4000.0f
 
 #define NUM_FRAMES 49
 #define RECORDING_WIN 49
@@ -97,6 +97,13 @@ bool erase_all_nvs_data();
 //model inference task에서 센서 데이터를 받을 때 사용하는 queue handler반환
 QueueHandle_t get_sensor_data_queue();
 
+// model_setup()이 NVS에서 읽은 모델 blob (화자 DB의 모델 hash 계산용, 모델이 없으면 NULL)
+const uint8_t* get_model_data(size_t* length);
+// 현재 모델의 출력 tensor 크기 (float 개수, sv_system_check_model용, 모델이 없으면 0)
+int get_model_output_size(void);
+// 등록 특징 [num_frames][num_bins]으로 모델 출력(화자 임베딩)을 계산 (추론 task와 interpreter를 잠금으로 공유)
+bool model_embed_features(const float* features, int num_frames, int num_bins, float* embedding, int embedding_size);
+
 
 
 //=========================== tasks ===========================
@@ -2,19 +2,75 @@
 #define SPEAKER_VERIFIER_H
 
 //=========================== header ==========================
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
 
 
 //=========================== define ===========================
+#define SV_LOG_TAG "speaker_verifier"  // log tag
+
 #ifndef SV_EMBEDDING_DIM
-#define SV_EMBEDDING_DIM 192
+#define SV_EMBEDDING_DIM 192   // 기본 입력 임베딩 차원 (config.embedding_dim = 0)
+#endif
+#ifndef SV_MAX_EMBEDDING_DIM
+#define SV_MAX_EMBEDDING_DIM 512  // config.embedding_dim 최대값 (임베딩 작업 버퍼 크기, task stack 사용량에 비례)
 #endif
 
-#define SV_MAX_SPEAKERS 40     // 시스템이 최대로 저장할 화자 수
+#define SV_DB_CHUNK_SHIFT 5    // DB 임베딩 행 chunk 크기 (2의 거듭제곱)
+#define SV_DB_CHUNK_ROWS (1 << SV_DB_CHUNK_SHIFT)  // chunk당 행 수 (RAM DB는 이 단위로 메모리를 늘림)
+#define SV_DEFAULT_RERANK_K 4  // int8 DB 모드에서 float로 재순위화할 상위 후보 수
+#define SV_MAX_RERANK_K 64     // rerank_k 최대값
+#define SV_MAX_TOPK 8          // sv_system_verify_topk()가 반환할 수 있는 최대 후보 수
+
+#define SV_DEFAULT_SMOOTHING_ALPHA 0.5f  // score smoothing: 새 점수 반영 비율
+#define SV_DEFAULT_HYSTERESIS 0.05f      // score smoothing: exit 임계값 = enter 임계값 - 이 값
+
+#define SV_DEFAULT_COHORT_SIZE 128       // AS-norm: cohort(사칭자) 임베딩 최대 개수
+#define SV_DEFAULT_COHORT_TOP_N 32       // AS-norm: 통계에 사용할 상위 cohort 점수 개수
 #define SV_MAX_NAME_LEN 20     // 화자 이름 최대 길이
 
-#define SV_VOTING_WINDOW_SIZE 9  // majority voting 윈도우 크기: (1.8s/200ms 주기 = 9개 프레임)
+#define SV_VOTING_WINDOW_SIZE 9  // majority voting 기본 윈도우 크기: (1.8s/200ms 주기 = 9개 프레임)
+
+#define SV_SCORE_INVALID (-1e30f)  // 삭제된 DB 행의 점수 (판정에서 제외)
+
+#define SV_MAX_READERS 8       // DB snapshot을 동시에 참조할 수 있는 reader 수 (세션별 판정 task, 이름 조회 등)
+#define SV_MAX_BATCH 16        // sv_verify_sessions() 한 번에 판정할 수 있는 최대 세션 수
+
+#define SV_DEFAULT_IVF_PROBE 4 // IVF 색인: 판정마다 탐색할 목록 수
+#define SV_MAX_IVF_PROBE 64    // ivf_probe 최대값
+#define SV_IVF_REBUILD_DIV 4   // IVF 색인: 색인 이후 추가된 행이 색인 행 수의 1/4을 넘으면 다시 생성
+
+#define SV_ABANDON_BLOCKS 4    // early-abandon: 내적을 나누어 계산할 블록 수 (192차원: 4 x 48)
+#define SV_ABANDON_PROBE_FRAMES 16     // early-abandon: 포기율을 평가하는 판정 구간 (프레임 수)
+#define SV_ABANDON_MAX_WORK 0.4f       // early-abandon: 구간 평균 계산량(전체 계산 대비)이 이 값을 넘으면 전체 계산으로 전환
+#define SV_ABANDON_BACKOFF_FRAMES 256  // early-abandon: 전환 후 다시 평가하기 전까지 전체 계산할 프레임 수
+
+#define SV_MAX_TEMPLATES 8                // 다중 template: 화자당 template 최대 개수 (max_templates 상한)
+#define SV_DEFAULT_TEMPLATE_MERGE_SIM 0.7f // 다중 template: 가장 가까운 template과의 유사도가 이 값 이상이면 합침
+#define SV_TEMPLATE_MAX_WEIGHT 32         // 다중 template: running mean 가중치 상한 (이후 지수 평균으로 최근 음성을 따라감)
+#define SV_TEMPLATE_OUTLIER_K 3.0f        // 온라인 갱신: 유사도가 평균 - K * 표준편차 미만이면 이상치로 거부
+#define SV_TEMPLATE_MIN_STATS 4           // 온라인 갱신: 이상치 판정을 시작할 최소 합친 횟수
+#define SV_TEMPLATE_MIN_STD 0.02f         // 온라인 갱신: 표준편차 하한 (비슷한 샘플만 합쳐진 template의 과도한 거부 방지)
+
+#define SV_MAX_ENROLL_UTTS 8   // 모델 교체 재임베딩: 화자당 보관할 등록 발화 특징 최대 개수
+#define SV_MIGRATE_MAX_RETRIES 5  // 모델 교체 재임베딩: 연속 실패가 이 횟수에 이르면 보류 (sv_system_migrate_retry로 다시 대기)
+
+// 판정 통계 (sv_get_stats): 빌드 시 -DSV_ENABLE_STATS=1로 켜며, 0이면 카운터 코드가 모두 빠짐
+#ifndef SV_ENABLE_STATS
+#define SV_ENABLE_STATS 0
+#endif
+#ifndef SV_STATS_SCORE_MIN
+#define SV_STATS_SCORE_MIN (-1.0f)  // best_score 히스토그램 범위 (코사인 기준, PLDA/AS-norm은 빌드 시 재정의)
+#endif
+#ifndef SV_STATS_SCORE_MAX
+#define SV_STATS_SCORE_MAX 1.0f
+#endif
+#define SV_STATS_SCORE_BINS 40      // best_score 히스토그램 구간 수 (범위 밖은 below/above)
+#define SV_STATS_MAX_HOPS 16        // 판정 지연 히스토그램 구간 수 (마지막 구간: 15 프레임 이상)
+#define SV_NUM_POST_ALGOS 4         // sv_post_algo_t 개수 (통계 배열 크기)
 
 
 //=========================== typedef ===========================
@@ -22,73 +78,385 @@
 typedef enum {
     SV_SUCCESS = 0,     // 성공
     SV_ERROR,           // 일반 오류
-    //SV_DB_FULL,
-    SV_NOT_FOUND        // 화자를 찾을 수 없음
+    SV_NOT_FOUND,       // 화자를 찾을 수 없음
+    SV_DB_FULL,         // 메모리(또는 저장소) 부족으로 등록 불가
+    SV_BUSY             // 다른 쓰기 작업 중이라 기다리지 않고 건너뜀 (판정 thread의 온라인 template 갱신)
 } sv_status_t;
 
 // 후처리 판정 알고리즘
 typedef enum {
     POST_NONE,               // 후처리 없음 (가장 높은 점수 즉시 반환)
     POST_CONSECUTIVE,        // 2회 연속 판정
-    POST_MAJORITY_VOTING    // Majority Voting (윈도우: 1.8초)
+    POST_MAJORITY_VOTING,   // Sliding-window Majority Voting (윈도우가 찬 뒤 매 프레임 판정)
+    POST_SCORE_SMOOTHING    // 화자별 점수 EMA + hysteresis (enter/exit 임계값)
 } sv_post_algo_t;
 
-// 화자 DB 항목 (RAM에 저장됨)
+// 화자 DB 임베딩 저장 형식
+typedef enum {
+    SV_DB_FLOAT = 0,         // float32 (화자당 dim * 4 바이트, dim은 embedding_dim 또는 projection 차원)
+    SV_DB_INT8,              // int8 + 화자별 scale (화자당 dim + 4 바이트)
+    SV_DB_FP16               // fp16 (화자당 dim * 2 바이트, DB 이미지 전용)
+} sv_db_format_t;
+
+// 점수 정규화 방식
+typedef enum {
+    SV_NORM_NONE = 0,        // 코사인 유사도 그대로 사용
+    SV_NORM_ASNORM           // Adaptive S-norm (cohort 상위 N개 점수의 평균/표준편차로 정규화)
+} sv_score_norm_t;
+
+// 점수 계산 backend (sv_backend.h)
+typedef enum {
+    SV_BACKEND_COSINE = 0,   // 코사인 유사도
+    SV_BACKEND_PLDA          // two-covariance PLDA 로그 우도비 (PLDA projection 필요, AS-norm 사용 안 함)
+} sv_backend_t;
+
+// 화자 DB 탐색 방식
+typedef enum {
+    SV_SCAN_FULL = 0,        // 모든 화자의 전체 차원 내적 계산
+    SV_SCAN_EARLY_ABANDON    // 블록 단위 내적 + Cauchy-Schwarz 상한으로 판정을 바꿀 수 없는 화자는 중간에 포기
+} sv_scan_t;
+
+// 다중 template 화자 점수 (max_templates > 1)
+typedef enum {
+    SV_TEMPLATE_MAX = 0,     // template 점수 중 최대값 (조건별 음성 중 가장 가까운 것)
+    SV_TEMPLATE_MEAN         // template 점수 평균
+} sv_template_score_t;
+
+// 화자 DB 항목 (RAM에 저장됨, 임베딩은 같은 행 번호의 임베딩 행에 별도 저장)
 typedef struct {
-    int speaker_id;
+    int speaker_id;              // -1: 삭제된 행
     char speaker_name[SV_MAX_NAME_LEN];
-    float embedding[SV_EMBEDDING_DIM];
+    uint32_t model_hash;         // 임베딩을 만든 모델 (sv_model_hash, 0: 알 수 없음)
 } sv_speaker_entry_t;
 
 // 
 typedef struct {
-    float threshold;             // 코사인 유사도 임계값
+    // 모델 출력 임베딩 차원 (0: SV_EMBEDDING_DIM, 최대 SV_MAX_EMBEDDING_DIM)
+    // 모델을 바꿀 때 다시 빌드하지 않고 이 값만 바꾸면 됨 (sv_system_check_model()로 출력 tensor와 대조)
+    // projection의 in_dim, 저장소 header, sv_database.h(SV_DATABASE_DIM)와 다르면 해당 입력은 사용하지 않음
+    int embedding_dim;
+
+    float threshold;             // 점수 임계값 (코사인 유사도, SV_BACKEND_PLDA는 로그 우도비)
     sv_post_algo_t algorithm;    // 사용할 판정 알고리즘
+    sv_db_format_t db_format;    // DB 저장 형식 (기본: SV_DB_FLOAT)
+    int rerank_k;                // int8 모드 재순위화 후보 수 (0: SV_DEFAULT_RERANK_K)
+    float margin;                // 1위와 2위 점수 차 최소값 (미만이면 Unknown, 0: 사용 안 함)
+    int voting_window;           // majority voting 윈도우 길이 (프레임 수, 0: SV_VOTING_WINDOW_SIZE)
+
+    // score smoothing (POST_SCORE_SMOOTHING) 설정
+    float smoothing_alpha;       // EMA 계수 (0~1, 클수록 새 점수 비중이 큼, 0: SV_DEFAULT_SMOOTHING_ALPHA)
+    float enter_threshold;       // 평활 점수가 이 값 이상이면 화자 판정 시작 (0: threshold)
+    float exit_threshold;        // 판정된 화자의 평활 점수가 이 값 미만이면 해제 (0: enter - SV_DEFAULT_HYSTERESIS)
+
+    // 점수 정규화 (SV_NORM_ASNORM 사용 시 threshold 등은 정규화된 점수 기준)
+    sv_score_norm_t score_norm;  // 점수 정규화 방식 (기본: SV_NORM_NONE)
+    int cohort_size;             // cohort 임베딩 최대 개수 (0: SV_DEFAULT_COHORT_SIZE)
+    int cohort_top_n;            // 통계에 사용할 상위 cohort 점수 개수 (0: SV_DEFAULT_COHORT_TOP_N)
+
+    // 영구 저장소 (sv_store.h, NULL: RAM DB만 사용)
+    const char* store_name;      // flash 파티션 label (host: 파일 경로), 사용 시 db_format은 SV_DB_FLOAT로 고정
+
+    // 바이너리 DB 이미지 (sv_image.h, NULL: sv_database.h 사용)
+    // 지정 시 이미지에서 바로 점수를 계산하며 (읽기 전용, db_format은 이미지 인코딩을 따름),
+    // 영구 저장소와 함께 사용하면 비어 있는 저장소의 초기 화자로만 사용
+    const void* db_image;
+
+    // 차원 축소 projection (sv_projection.h, NULL: 사용 안 함)
+    // 지정 시 등록/쿼리/cohort 임베딩을 out_dim 차원으로 투영한 뒤 점수 계산 (DB 행도 out_dim 차원)
+    const void* projection;
+
+    // 점수 계산 backend (기본: SV_BACKEND_COSINE)
+    // SV_BACKEND_PLDA는 projection에 PLDA 모델(sv_fit_projection ... plda)이 필요하며, 없으면 cosine 사용
+    sv_backend_t backend;
+
+    // IVF 색인 (sv_ivf.h, 화자 수천 명 이상인 gateway용, 0: 전체 선형 탐색)
+    // 지정 시 가까운 목록 ivf_probe개의 화자만 정확히 점수 계산 (근사 탐색, 목록 수는 sqrt(화자 수) 정도 권장)
+    int ivf_lists;               // 목록 수 (0: 사용 안 함)
+    int ivf_probe;               // 판정마다 탐색할 목록 수 (0: SV_DEFAULT_IVF_PROBE)
+
+    // 탐색 방식 (기본: SV_SCAN_FULL)
+    // SV_SCAN_EARLY_ABANDON은 raw 판정이 전체 계산과 같고, 포기한 화자의 점수는 포기 시점의 상한으로 기록됨
+    // 앞쪽 차원에 에너지가 몰릴수록 상한이 빨리 좁혀지므로 projection(분산 내림차순 성분)과 함께 쓸 때 효과가 큼
+    // (차원별 분산이 고른 투영 전 임베딩은 대부분의 화자가 마지막 블록까지 남아 오히려 느릴 수 있음, sv_abandon_bench)
+    // 세션마다 SV_ABANDON_PROBE_FRAMES 판정의 평균 계산량을 보고, 포기가 적어 SV_ABANDON_MAX_WORK를 넘으면
+    // SV_ABANDON_BACKOFF_FRAMES 동안 전체 계산으로 판정한 뒤 다시 평가함
+    // (best_score/second_score는 raw 판정이 있으면 1위는 정확, 없으면 상한일 수 있음)
+    // float/fp16 DB의 단일 세션 판정에만 적용 (int8, score smoothing, topk 요청, 배치, IVF는 전체 계산)
+    sv_scan_t scan;
+
+    // 다중 template (RAM DB 전용, 영구 저장소/DB 이미지 모드에서는 화자당 1개로 고정)
+    // 화자마다 최대 max_templates개의 하위 중심(template)을 DB 행으로 두고, 모든 행을 같은 kernel로 점수 계산한 뒤
+    // template_score로 화자 점수를 만듭니다. (메모리: 화자당 최대 max_templates 행)
+    // update_threshold > 0이면 새로 최종 판정된 화자의 best_score가 이 값 이상일 때 그 임베딩으로 template을 갱신
+    // (가장 가까운 template에 running mean으로 합치고 (이상치는 거부), 멀면 빈 자리에 새 template 추가)
+    // (갱신은 판정 thread에서 수행하되, 등록/삭제 등 다른 쓰기 작업 중이면 기다리지 않고 다음 프레임으로 미룸)
+    int max_templates;               // 화자당 template 최대 개수 (0, 1: 1개, 최대 SV_MAX_TEMPLATES)
+    sv_template_score_t template_score;  // 화자 점수 (기본: SV_TEMPLATE_MAX, MEAN은 early-abandon 사용 안 함)
+    float template_merge_sim;        // 이 코사인 유사도 이상이면 기존 template에 합침 (0: SV_DEFAULT_TEMPLATE_MERGE_SIM)
+    float update_threshold;          // 온라인 갱신 점수 임계값 (0: 갱신 안 함, threshold 이상 권장)
+
+    // 임베딩 모델 hash (sv_model_hash(모델 blob), 0: 추적 안 함)
+    // 등록되는 DB 행과 저장소 record에 기록되며, 저장소에서 다른 hash로 기록된 화자는 로드하지 않음
+    // (다른 모델의 임베딩은 오류 없이 잘못된 점수를 냄, hash가 없는 기존 record와 sv_database.h는 현재 모델로 간주)
+    // 모델 교체는 sv_system_set_model() + sv_system_migrate_step()
+    uint32_t model_hash;
 } sv_config_t;
 
 // 화자 판정 결과
 typedef struct {
     int raw_speaker_id;          // 후처리 전, 현재 프레임의 최고 점수 화자 ID (-1: 임계값 미만)
     int final_speaker_id;        // 후처리 후, 최종 판정된 화자 ID (-1: 판정 보류)
-    float best_score;            // 현재 프레임의 최고 유사도 점수
+    float best_score;            // 현재 프레임의 최고 점수
+    int second_speaker_id;       // 현재 프레임의 2위 화자 ID (-1: 화자가 1명 이하)
+    float second_score;          // 현재 프레임의 2위 유사도 점수
 } sv_result_t;
 
+// 판정 통계 (sv_get_stats, SV_ENABLE_STATS=1 빌드에서만 수집, 모든 handle/세션 합산)
+typedef struct {
+    // 판정 소요 시간 (sv_system_verify / sv_session_verify 1회, 배치는 세션당 평균)
+    // target: CPU cycle (esp_cpu_get_cycle_count), host: ns (clock_gettime)
+    uint32_t num_verify;
+    uint64_t total_cycles;
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+
+    // best_score 히스토그램 [SV_STATS_SCORE_MIN, SV_STATS_SCORE_MAX) 등간격 (등록된 화자가 있는 판정만)
+    uint32_t score_hist[SV_STATS_SCORE_BINS];
+    uint32_t score_below;        // SV_STATS_SCORE_MIN 미만
+    uint32_t score_above;        // SV_STATS_SCORE_MAX 이상
 
-// 내부 상태 구조체 (handle 내부에 포함)
+    // 판정 지연: 화자가 처음 raw 판정된 프레임부터 그 화자가 최종 판정될 때까지의 hop 수 (후처리 알고리즘별)
+    uint32_t decisions[SV_NUM_POST_ALGOS];                        // 최종 판정 횟수
+    uint32_t dropped[SV_NUM_POST_ALGOS];                          // raw 판정됐지만 최종 판정 전에 다른 화자로 바뀐 횟수
+    uint64_t total_hops[SV_NUM_POST_ALGOS];
+    uint32_t hop_hist[SV_NUM_POST_ALGOS][SV_STATS_MAX_HOPS];      // [알고리즘][hop 수]
+} sv_stats_t;
+
+// Top-K 후보 (sv_system_verify_topk)
+typedef struct {
+    int speaker_id;              // 화자 ID (-1: 빈 슬롯)
+    float score;                 // 유사도 점수
+} sv_candidate_t;
+
+
+// 내부 상태 구조체 (세션 내부에 포함)
 typedef struct {
     // 2회 연속 판정 (POST_CONSECUTIVE) 상태
     int last_speaker_id;
     int consecutive_count;
 
-    // Majority Voting (POST_MAJORITY_VOTING) 상태
-    int history_buffer[SV_VOTING_WINDOW_SIZE]; // 화자 ID 저장 (-1은 unknown)
-    int history_index; // 현재 버퍼 위치
-    int history_count; // 윈도우가 찼는지 확인 (최대 SV_VOTING_WINDOW_SIZE)
+    // Majority Voting (POST_MAJORITY_VOTING) 상태 (sliding window)
+    int* history_buffer; // [voting_window] DB 행 인덱스 저장 (-1은 unknown)
+    int* vote_counts;    // [capacity] 윈도우 내 DB 행별 등장 횟수 (증분 갱신)
+    int history_index;   // 현재 버퍼 위치
+    int history_count;   // 윈도우가 찼는지 확인 (최대 voting_window)
+    int majority_row;    // 현재 과반수 DB 행 (-1: 없음)
+
+    // Score Smoothing (POST_SCORE_SMOOTHING) 상태
+    float* smoothed_scores; // [capacity] DB 행별 지수 평활 점수
+    int smoothed_rows;      // 평활 값이 유효한 행 수 (이후 행은 첫 점수로 초기화)
+    int locked_row;         // 현재 판정 유지 중인 DB 행 (-1: 없음)
+    int leading_row;        // 직전 프레임의 평활 점수 최고 행 (-1: 없음, IVF 후보 유지용)
+
+    uint32_t layout_id;     // 상태가 기준으로 하는 DB 행 배치 (sv_db_t.layout_id와 다르면 초기화)
+
+    // 판정 지연 통계 (SV_ENABLE_STATS)
+    uint32_t frame;         // 판정 횟수
+    int pending_id;         // 최종 판정을 기다리는 raw 판정 화자 ID (-1: 없음)
+    uint32_t pending_frame; // pending_id가 처음 raw 판정된 frame
+    int decided_id;         // 마지막으로 최종 판정된 화자 ID (unknown 프레임에서 -1로 초기화)
+
+    // 다중 template 온라인 갱신 (config.update_threshold > 0)
+    int updated_id;         // 현재 판정 구간에서 이미 template을 갱신한 화자 ID (unknown 프레임에서 -1로 초기화)
 } sv_internal_state_t;
 
 
+// 다중 template 행 정보 (DB 행마다 하나)
+// 화자의 첫 행(lead)이 화자를 대표하며 (speaker ID 조회, 후처리 상태), 나머지 template 행은 next로 연결됩니다.
+typedef struct {
+    int lead;                        // 화자의 lead 행
+    int next;                        // 같은 화자의 다음 template 행 (-1: 끝)
+    uint16_t rows;                   // 화자의 template 수 (lead 행만 유효)
+    uint16_t count;                  // 이 template에 합친 임베딩 수 (running mean 가중치)
+    float sim_mean;                  // 합친 임베딩과 template의 유사도 평균 (온라인 갱신 이상치 판정)
+    float sim_var;                   // 유사도 분산
+} sv_template_t;
+
+// 재임베딩 callback (sv_system_migrate_step): 보관된 등록 특징으로 새 모델의 임베딩을 계산
+// features: [num_frames][num_bins] (sv_system_add_features로 넘긴 특징의 복원값), embedding: [handle->embedding_dim]
+typedef sv_status_t (*sv_embed_fn_t)(void* ctx, const float* features, int num_frames, int num_bins,
+                                     float* embedding);
+
+// 화자별 등록 특징 (모델 교체 재임베딩용, handle이 소유하며 writer만 접근)
+typedef struct sv_enroll {
+    int speaker_id;                  // -1: 재임베딩 도중 삭제됨 (재임베딩이 끝나면 해제)
+    char speaker_name[SV_MAX_NAME_LEN];  // 재임베딩을 기다리는 동안 (DB 행이 없을 때) 이름 보관
+    uint32_t model_hash;             // 현재 DB 행을 만든 모델 (settings.model_hash와 다르면 재임베딩 대기, 0: DB 행 없음)
+    int num_utts;                    // 보관된 발화 수 (최대 SV_MAX_ENROLL_UTTS, 0: 특징 없이 이름만 보관된 저장소 화자)
+    uint8_t failures;                // 현재 모델로의 연속 재임베딩 실패 수 (SV_MIGRATE_MAX_RETRIES: 보류)
+    uint16_t backoff;                // 다음 재시도까지 건너뛸 migrate_step 호출 수
+    struct sv_features* utts;        // 인코딩된 발화 특징 목록 (sv_features.h, 등록 순서)
+    struct sv_enroll* next;
+} sv_enroll_t;
+
+// 화자 DB snapshot (게시된 뒤에는 변경되지 않음)
+// 등록/삭제는 현재 snapshot을 복사한 새 snapshot을 만들어 원자적으로 교체하며,
+// 이전 snapshot은 참조 중인 reader가 모두 빠져나간 뒤 해제됩니다. (RCU)
+// 임베딩 행(chunk)은 snapshot 간에 공유되며, 어떤 snapshot도 살아 있는 행으로 보지 않는 행에만 기록됩니다.
+typedef struct sv_db {
+    int num_speakers;                // DB 행 수 (삭제된 행 포함)
+    int num_dead;                    // 삭제된 행 수 (speaker_id = -1, 점수는 SV_SCORE_INVALID)
+    uint32_t layout_id;              // 기존 행의 의미가 바뀌면 증가 (삭제, 재사용, compaction)
+    int capacity;                    // 행별 배열 크기 (SV_DB_CHUNK_ROWS의 배수)
+
+    sv_speaker_entry_t* speakers_db; // [capacity] (snapshot 소유)
+
+    // 단위 정규화된 임베딩 행 chunk 테이블 [capacity / SV_DB_CHUNK_ROWS] (테이블은 snapshot 소유, chunk는 공유)
+    // r번째 행(speakers_db[r]의 임베딩)은 sv_db_row(db, r), 원소 형식은 db_format (float / int8 / fp16)
+    // RAM: PSRAM pool chunk, 영구 저장소/DB 이미지: 매핑된 flash를 직접 가리킴 (읽기 전용)
+    const uint8_t** chunks;
+    size_t row_bytes;                // 행 간격 (바이트)
+    int emb_stride;                  // 행 간격 (원소 개수)
+
+    float* q_scales;                 // int8 행별 scale [capacity] (SV_DB_INT8, snapshot 소유)
+    float* row_scales;               // 정규화되지 않은 이미지의 행별 1/norm (공유, 그 외 NULL)
+    float* row_bias;                 // 행별 점수 상수 항 [capacity] (row_bias가 있는 backend만, snapshot 소유)
+    float* suffix_norms;             // 행별 블록 suffix norm [capacity][SV_ABANDON_BLOCKS] (SV_SCAN_EARLY_ABANDON, snapshot 소유)
+                                     // [b] = |row[b * abandon_block ..dim)| (row_scales 반영), 등록 시 한 번 계산
+
+    // AS-norm (SV_NORM_ASNORM 모드에서만 사용)
+    float* cohort_matrix;            // 투영/정규화된 cohort 임베딩 [cohort_size][handle->dim] (공유, 교체 시 유예 해제)
+    int num_cohort;                  // 현재 cohort 임베딩 수 (0이면 정규화 생략)
+    float* enroll_mean;              // 등록 화자별 상위 N cohort 점수 평균 [capacity] (snapshot 소유)
+    float* enroll_std;               // 등록 화자별 상위 N cohort 점수 표준편차 [capacity] (snapshot 소유)
+
+    // IVF 색인 (config.ivf_lists > 0, 행이 적으면 NULL = 선형 탐색)
+    struct sv_ivf* ivf;              // 색인 (공유, 교체 시 유예 해제)
+    int* ivf_pending;                // 색인 이후 추가/재사용된 행 [capacity] (선형 탐색, snapshot 소유)
+    int num_pending;
+
+    // 다중 template (max_templates > 1 또는 update_threshold > 0, 그 외 NULL)
+    sv_template_t* templates;        // 행별 template 정보 [capacity] (snapshot 소유)
+    int num_templates;               // 살아 있는 lead가 아닌 template 행 수 (0이면 화자 점수 합산 생략)
+} sv_db_t;
+
+// 해제 대기 중인 메모리 또는 DB 행 (retire 이후의 epoch에 들어온 reader만 남으면 해제)
+typedef struct sv_retired {
+    void* ptr;
+    void (*free_fn)(void* ptr);
+    int row;                         // >= 0: pool로 반환할 삭제된 행 (ptr 대신)
+    uint32_t epoch;
+    struct sv_retired* next;
+} sv_retired_t;
+
+
+struct sv_store;         // sv_store.h
+struct sv_image_header;  // sv_image.h
+struct sv_session;       // 아래 sv_session_t
+struct sv_pool;          // sv_pool.h
+struct sv_projection_header;  // sv_projection.h
+struct sv_backend_ops;   // sv_backend.h
+struct sv_ivf;           // sv_ivf.h
+struct sv_features;      // sv_features.h
+
 // handle 구조체 (시스템의 모든 상태와 DB 관리, 사용자는 포인터 sv_handle_t*만 다룸)
 typedef struct {
     sv_config_t settings;
-    int max_speakers;
 
-    // 화자 데이터베이스 (RAM)
-    sv_speaker_entry_t* speakers_db; // 동적 할당될 배열
-    int num_speakers;                // 현재 등록된 화자 수
+    // 화자 데이터베이스 (현재 게시된 snapshot, reader는 pin한 뒤에만 접근)
+    _Atomic(sv_db_t*) db;
 
-    // 판정 알고리즘을 위한 내부 상태
-    sv_internal_state_t state;
+    // RCU: reader별 진입 epoch (0: 비어 있음)와 해제 대기 목록
+    _Atomic uint32_t epoch;
+    _Atomic uint32_t reader_epoch[SV_MAX_READERS];
+    sv_retired_t* retired;           // writer만 접근 (write_lock)
+
+    // writer 직렬화 (등록/삭제/cohort 설정끼리만 직렬화, 판정과는 경합하지 않음)
+    pthread_mutex_t write_lock;
+    int next_speaker_id;             // 다음 등록에 부여할 화자 ID (행 번호와 무관)
+
+    // RAM DB 임베딩 행 pool (저장소/이미지 모드에서는 NULL, writer만 접근)
+    struct sv_pool* pool;
+
+    // 영구 저장소 (config.store_name 지정 시에만 사용, writer만 접근)
+    struct sv_store* store;
+
+    // DB 이미지 (config.db_image 지정 시에만 사용, 임베딩은 이미지를 직접 가리킴)
+    const struct sv_image_header* image;
+
+    // 차원 축소 projection (config.projection 지정 시에만 사용, 행렬은 projection을 직접 가리킴)
+    const struct sv_projection_header* projection;
+    const float* proj_mean;          // [embedding_dim]
+    const float* proj_matrix;        // [dim][embedding_dim]
+    int embedding_dim;               // 입력 임베딩 차원 (config.embedding_dim, 모델 출력 크기)
+    int dim;                         // 점수 계산 차원 (DB 행, 쿼리, cohort): projection의 out_dim 또는 embedding_dim
+    int abandon_block;               // early-abandon 블록 길이 (dim / SV_ABANDON_BLOCKS를 4의 배수로 올림)
+
+    // 점수 계산 backend (config.backend, 모델 계수는 backend_ctx)
+    const struct sv_backend_ops* backend;
+    void* backend_ctx;
+
+    float* enroll_work;              // writer용 cohort 점수 작업 버퍼 [cohort_size] (AS-norm)
+
+    // 모델 교체 재임베딩 (writer만 접근, 현재 모델은 settings.model_hash)
+    sv_enroll_t* enrolls;            // 등록 특징을 보관하는 화자 목록 (저장소 모드: 다른 모델로 등록된 화자, 특징 없음)
+    sv_enroll_t* migrating;          // sv_system_migrate_step()이 쓰기 잠금 밖에서 재임베딩 중인 화자 (NULL: 없음)
+
+    // sv_system_verify()가 사용하는 기본 세션 (단일 스트림용)
+    struct sv_session* session;
 
 } sv_handle_t;
 
+// 판정 세션 (오디오 스트림 하나의 후처리 상태와 작업 버퍼만 소유, DB는 handle과 공유)
+// 같은 handle의 세션들은 각자 다른 task에서 동시에 판정할 수 있습니다. (세션 하나는 한 task에서만 사용)
+typedef struct sv_session {
+    sv_handle_t* handle;             // 공유 DB를 가진 handle
+
+    // 판정용 작업 버퍼 (매 프레임 재사용)
+    float* query;                    // backend가 변환한 현재 임베딩 [handle->dim]
+    float q_bias;                    // 쿼리 쪽 점수 상수 항 (backend, cosine은 0)
+    int capacity;                    // 행별 버퍼 크기 (DB가 커지면 판정 시 늘림)
+    float* scores;                   // 화자별 유사도 [capacity]
+    int8_t* q_query;                 // 양자화된 현재 임베딩 (int8 모드)
+    float q_scale;                   // q_query의 scale (int8 모드)
+    int32_t* q_acc;                  // int8 내적 누산 결과 [capacity] (int8 모드)
+    float* cohort_scores;            // cohort 점수 작업 버퍼 [cohort_size] (AS-norm)
+
+    // IVF 색인 탐색 (config.ivf_lists > 0)
+    int num_cand;                    // 점수를 계산한 후보 수 (-1: 모든 행의 점수가 scores에 있음)
+    int* cand_rows;                  // 후보 DB 행 [capacity] (scores[cand_rows[j]] == cand_scores[j])
+    float* cand_scores;              // 후보 점수 [capacity]
+    uint32_t* cand_mark;             // 행별 마지막 후보 선정 번호 [capacity] (목록과 pending 중복 제거)
+    uint32_t cand_stamp;
+    float* centroid_scores;          // 중심 점수 작업 버퍼 [ivf_lists]
+
+    // early-abandon 효과 감시 (SV_SCAN_EARLY_ABANDON)
+    float abandon_work;              // 현재 구간의 판정별 계산량 합 (전체 계산 대비 비율, 0~1)
+    uint16_t abandon_frames;         // 현재 구간의 early-abandon 판정 수
+    uint16_t abandon_skip;           // 전체 계산으로 판정할 남은 프레임 수 (포기가 적은 구간 뒤)
+
+    // 판정 알고리즘을 위한 내부 상태
+    sv_internal_state_t state;
+} sv_session_t;
+
 
 //=========================== variables ===========================
 
 
 //=========================== prototypes ===========================
+/**
+ * @brief snapshot의 row번째 임베딩 행 주소 (SV_KERNEL_ALIGN 정렬, 형식은 db_format)
+ */
+static inline const void* sv_db_row(const sv_db_t* db, int row) {
+    return db->chunks[row >> SV_DB_CHUNK_SHIFT] + (size_t)(row & (SV_DB_CHUNK_ROWS - 1)) * db->row_bytes;
+}
+
 /**
  * @brief 화자 검증 시스템 핸들을 초기화합니다.
  * sv_database.h에 정의된 사전 등록 화자를 RAM으로 로드합니다.
+ * (store_name 지정 시 저장소를 매핑하여 사용하며, 비어 있는 저장소에는 사전 등록 화자를 기록)
+ * (db_image 지정 시 sv_database.h 대신 이미지의 화자를 사용)
+ * (projection 지정 시 모든 임베딩을 투영된 차원에서 비교, 이미지/저장소도 같은 차원이어야 함)
  *
  * @param config 시스템 설정 (임계값, 알고리즘)
  * @return 성공 시 sv_handle_t 포인터, 실패(메모리 부족 등) 시 NULL
@@ -107,30 +475,250 @@ void sv_system_deinit(sv_handle_t* handle);
  * (3회 녹음 후 평균화된 임베딩을 인자로 받는다고 가정)
  *
  * @param handle 핸들
- * @param new_embedding 등록할 화자의 평균 임베딩 벡터 (크기: SV_EMBEDDING_DIM)
+ * @param new_embedding 등록할 화자의 평균 임베딩 벡터 (크기: handle->embedding_dim)
  * @param name 등록할 화자 이름
  * @return sv_status_t (SV_SUCCESS, SV_DB_FULL 등)
+ * (RAM DB는 삭제된 행을 먼저 재사용하고, 메모리가 부족할 때만 SV_DB_FULL)
+ * (영구 저장소 사용 시 journal에 추가되며, journal이 가득 차면 compaction 후 추가)
+ * (DB 이미지 모드에서는 읽기 전용이므로 SV_ERROR)
  */
 sv_status_t sv_system_register(sv_handle_t* handle, float* new_embedding, const char* name);
 
+/**
+ * @brief 화자를 DB에서 삭제합니다. (해당 행은 판정에서 제외됨)
+ * RAM DB는 삭제된 행을 다음 등록에 재사용하며, 삭제된 행이 SV_DB_CHUNK_ROWS개 이상 쌓이면
+ * 뒤쪽 행을 앞으로 옮겨 행렬을 조밀하게 만든 뒤 남는 chunk를 반환합니다.
+ * 영구 저장소 사용 시 journal에 삭제 record를 추가합니다.
+ *
+ * @param handle 핸들
+ * @param speaker_id 삭제할 화자 ID
+ * @return sv_status_t (SV_SUCCESS, SV_NOT_FOUND, SV_ERROR)
+ */
+sv_status_t sv_system_unregister(sv_handle_t* handle, int speaker_id);
+
+/**
+ * @brief 등록된 화자에 임베딩 하나를 template으로 추가합니다. (RAM DB, 다중 template)
+ * 가장 가까운 template과의 코사인 유사도가 template_merge_sim 이상이면 그 template에 running mean으로 합치고,
+ * 아니면 max_templates개까지 새 template을 만듭니다. (가득 차면 가장 가까운 template에 합침)
+ * 등록 발화를 하나씩 넘기면 되므로 미리 평균을 계산할 필요가 없습니다. (max_templates = 1이면 전체 running mean)
+ *
+ * @param handle 핸들
+ * @param speaker_id sv_system_register()로 등록된 화자 ID
+ * @param embedding 임베딩 (크기: handle->embedding_dim)
+ * @return sv_status_t (SV_SUCCESS, SV_NOT_FOUND, SV_DB_FULL, SV_ERROR: 영구 저장소/DB 이미지 모드)
+ */
+sv_status_t sv_system_add_template(sv_handle_t* handle, int speaker_id, const float* embedding);
+
+/**
+ * @brief 화자의 등록 발화 특징 하나를 보관합니다. (RAM DB, 모델 교체 후 재임베딩용)
+ * 등록에 사용한 발화마다 모델 입력 특징(예: melspec_compute 출력)을 넘기면 bin별 8비트로 인코딩하여 보관하고,
+ * sv_system_set_model() 이후 sv_system_migrate_step()이 이 특징으로 새 모델의 임베딩을 다시 계산합니다.
+ * (특징이 없는 화자는 모델 교체 시 DB에서 빠지므로 다시 등록해야 함)
+ *
+ * @param handle 핸들
+ * @param speaker_id 등록된 화자 ID
+ * @param features 특징 [num_frames][num_bins] (모델 입력과 같은 형태)
+ * @param num_frames 프레임 수
+ * @param num_bins 프레임당 bin 수
+ * @return sv_status_t (SV_SUCCESS, SV_NOT_FOUND, SV_DB_FULL: 메모리 부족 또는 SV_MAX_ENROLL_UTTS 초과,
+ *                      SV_ERROR: 영구 저장소/DB 이미지 모드)
+ */
+sv_status_t sv_system_add_features(sv_handle_t* handle, int speaker_id, const float* features,
+                                   int num_frames, int num_bins);
+
+/**
+ * @brief 임베딩 모델이 교체되었음을 알립니다.
+ * RAM DB: 다른 모델의 hash로 기록된 화자는 즉시 판정에서 빠지고 (이전 모델의 임베딩은 새 쿼리와 비교할 수 없음),
+ * 등록 특징이 있는 화자는 재임베딩 대기 목록에 들어갑니다. 특징이 없는 화자는 삭제됩니다.
+ * 판정은 멈추지 않으며, 재임베딩이 끝난 화자부터 다시 판정됩니다. (sv_system_migrate_step)
+ * 영구 저장소: 등록 특징을 flash에 보관하지 않으므로 현재 모델로 등록된 화자가 있으면 교체를 거부합니다.
+ * (모델 blob을 기록하기 전에 호출하여 확인하고, 화자를 모두 삭제한 뒤 교체하여 다시 등록)
+ * 다른 모델로 등록된 record는 부팅 시에도 지우지 않고 판정에서만 제외하며 (ID와 이름은 handle->enrolls),
+ * sv_system_unregister로 삭제하거나 그 모델로 되돌리면 다시 판정됩니다.
+ * AS-norm cohort도 이전 모델의 임베딩이므로 비워지며, 새 모델의 cohort를 sv_system_set_cohort()로 다시 설정해야 합니다.
+ * (projection은 모델마다 학습되므로 projection을 쓰는 handle은 새 projection으로 다시 초기화해야 함)
+ *
+ * @param handle 핸들
+ * @param model_hash 새 모델의 hash (sv_model_hash)
+ * @return sv_status_t (SV_SUCCESS, SV_ERROR: 저장소에 현재 모델의 화자가 있음, DB 이미지/projection 사용 또는 메모리 부족)
+ */
+sv_status_t sv_system_set_model(sv_handle_t* handle, uint32_t model_hash);
+
+/**
+ * @brief 재임베딩 대기 중인 화자 하나를 새 모델로 다시 등록합니다. (낮은 우선순위의 idle task에서 반복 호출)
+ * 보관된 발화마다 embed를 호출하여 (쓰기 잠금 밖에서, 판정/등록과 동시에 실행 가능)
+ * 첫 발화로 화자를 같은 ID로 다시 등록하고 나머지 발화는 template으로 추가합니다. (sv_system_add_template과 같음)
+ * embed는 판정 task와 같은 모델 interpreter를 쓴다면 호출자가 직렬화해야 하며, 이 handle의 API를 호출하면 안 됩니다.
+ * embed나 재등록(메모리 부족)이 실패해도 화자와 등록 특징은 지우지 않고 대기 목록에 남깁니다.
+ * 실패한 화자는 실패할 때마다 두 배로 늘어나는 횟수의 호출 동안 건너뛰고 (backoff),
+ * SV_MIGRATE_MAX_RETRIES번 연속 실패하면 보류되어 남은 수에서 빠집니다. (sv_system_migrate_retry로 다시 대기)
+ *
+ * @param handle 핸들
+ * @param embed 특징 -> 임베딩 callback
+ * @param ctx callback 인자
+ * @return 남은 재임베딩 대기 화자 수 (backoff 중인 화자 포함, 보류된 화자 제외, 0: 완료)
+ */
+int sv_system_migrate_step(sv_handle_t* handle, sv_embed_fn_t embed, void* ctx);
+
+/**
+ * @brief 재임베딩이 반복 실패하여 보류된 화자를 다시 대기 목록에 넣습니다.
+ * 보류된 화자는 DB 행 없이 이름과 등록 특징만 보관된 상태이며 (판정에서 제외, sv_system_unregister로 삭제 가능),
+ * 실패 원인(메모리 부족, 모델 출력 크기 등)을 해결한 뒤 호출하고 sv_system_migrate_step을 다시 반복합니다.
+ * (sv_system_set_model로 모델이 바뀌어도 실패 횟수는 초기화됨)
+ *
+ * @param handle 핸들
+ * @return 다시 대기 목록에 넣은 화자 수
+ */
+int sv_system_migrate_retry(sv_handle_t* handle);
+
+/**
+ * @brief 모델 blob의 hash를 계산합니다. (FNV-1a 32비트, config.model_hash / sv_system_set_model용)
+ * 0은 '추적 안 함'이므로 반환하지 않습니다.
+ *
+ * @param data 모델 blob (예: NVS에서 읽은 tflite 모델)
+ * @param size 크기 (바이트)
+ * @return hash (0이 아닌 값)
+ */
+uint32_t sv_model_hash(const void* data, size_t size);
+
+/**
+ * @brief IVF 색인을 현재 DB로 다시 만듭니다. (config.ivf_lists > 0)
+ * 색인은 초기화, compaction, 그리고 색인 이후 추가된 화자가 일정 수 이상 쌓이면 자동으로 다시 만들어지므로,
+ * 대량 등록 직후 탐색 품질을 바로 맞추고 싶을 때만 호출합니다. (판정은 이전 색인으로 계속 수행)
+ *
+ * @param handle 핸들
+ * @return sv_status_t (SV_SUCCESS, SV_ERROR: 색인 미사용)
+ */
+sv_status_t sv_system_build_index(sv_handle_t* handle);
+
+/**
+ * @brief AS-norm에 사용할 cohort(사칭자) 임베딩을 설정합니다.
+ * cohort를 정규화하여 저장한 뒤, 등록된 모든 화자의 cohort 통계를 다시 계산합니다.
+ * (이후 등록되는 화자는 등록 시점에 통계가 계산됨)
+ *
+ * @param handle 핸들 (score_norm = SV_NORM_ASNORM 으로 초기화된 핸들)
+ * @param cohort cohort 임베딩 배열 [num_cohort][handle->embedding_dim]
+ * @param num_cohort cohort 임베딩 수 (cohort_size를 넘는 부분은 무시)
+ * @return sv_status_t (SV_SUCCESS, SV_ERROR)
+ */
+sv_status_t sv_system_set_cohort(sv_handle_t* handle, const float* cohort, int num_cohort);
+
 /**
  * @brief 현재 오디오 청크에서 추출된 임베딩으로 화자를 판정합니다.
  * 이 함수는 200ms마다 호출되어야 합니다.
+ * (한 task에서만 호출, 등록/삭제는 다른 task에서 동시에 호출해도 판정이 멈추지 않음)
  *
  * @param handle 핸들
- * @param current_embedding TFLite 모델에서 방금 추론된 임베딩 (크기: SV_EMBEDDING_DIM)
+ * @param current_embedding TFLite 모델에서 방금 추론된 임베딩 (크기: handle->embedding_dim)
  * @return sv_result_t (후처리 전/후 결과 포함)
  */
 sv_result_t sv_system_verify(sv_handle_t* handle, float* current_embedding);
 
+/**
+ * @brief sv_system_verify()와 같은 판정을 수행하면서 상위 K개 후보를 함께 반환합니다.
+ * 점수 계산은 한 번만 수행되며, 상위 후보는 부분 선택으로 구합니다.
+ *
+ * @param handle 핸들
+ * @param current_embedding TFLite 모델에서 방금 추론된 임베딩 (크기: handle->embedding_dim)
+ * @param topk 후보 출력 배열 (점수 내림차순, 남는 슬롯은 speaker_id = -1)
+ * @param k 요청 후보 수 (최대 SV_MAX_TOPK)
+ * @return sv_result_t (후처리 전/후 결과 포함)
+ */
+sv_result_t sv_system_verify_topk(sv_handle_t* handle, float* current_embedding,
+                                  sv_candidate_t* topk, int k);
+
+/**
+ * @brief 화자 ID의 이름을 복사합니다. (판정과 동시에 다른 task에서 호출 가능)
+ *
+ * @param handle 핸들
+ * @param speaker_id 화자 ID
+ * @param name 출력 버퍼 [SV_MAX_NAME_LEN]
+ * @return sv_status_t (SV_SUCCESS, SV_NOT_FOUND)
+ */
+sv_status_t sv_system_get_speaker_name(sv_handle_t* handle, int speaker_id, char* name);
+
+/**
+ * @brief 모델 출력 tensor의 크기가 handle의 임베딩 차원과 같은지 확인합니다.
+ * 차원이 다른 임베딩은 오류 없이 잘못된 점수를 내므로, 모델을 로드한 직후 한 번 호출합니다.
+ * (예: sv_system_check_model(handle, output->bytes / sizeof(float)))
+ *
+ * @param handle 핸들
+ * @param output_size 모델 출력 tensor의 float 원소 수
+ * @return sv_status_t (SV_SUCCESS, 다르면 SV_ERROR)
+ */
+sv_status_t sv_system_check_model(const sv_handle_t* handle, int output_size);
+
 /**
  * @brief 후처리 알고리즘의 내부 상태를 초기화합니다.
  * (예: 디렉토리 내 파일 인식 모드에서 다음 파일 시작 시 호출)
  *
- * @param handle 핸들
+ * @param handle 핸들 (기본 세션을 초기화)
  */
 void sv_system_reset_state(sv_handle_t* handle);
 
+/**
+ * @brief 같은 DB를 공유하는 새 판정 세션을 만듭니다. (스트림/마이크마다 하나)
+ * 세션은 후처리 상태와 작업 버퍼만 할당하므로 DB를 다시 로드하지 않습니다.
+ *
+ * @param handle 핸들 (세션보다 오래 유지되어야 함)
+ * @return 세션 포인터, 실패 시 NULL
+ */
+sv_session_t* sv_session_create(sv_handle_t* handle);
+
+/**
+ * @brief 세션을 해제합니다.
+ */
+void sv_session_destroy(sv_session_t* session);
+
+/**
+ * @brief 세션의 후처리 상태를 초기화합니다.
+ */
+void sv_session_reset(sv_session_t* session);
+
+/**
+ * @brief 세션의 현재 임베딩으로 화자를 판정합니다. (sv_system_verify_topk와 같은 판정)
+ *
+ * @param session 세션
+ * @param current_embedding 임베딩 (크기: handle->embedding_dim)
+ * @param topk 후보 출력 배열 (NULL 허용, k = 0)
+ * @param k 요청 후보 수 (최대 SV_MAX_TOPK)
+ * @return sv_result_t (후처리 전/후 결과 포함)
+ */
+sv_result_t sv_session_verify(sv_session_t* session, float* current_embedding,
+                              sv_candidate_t* topk, int k);
+
+/**
+ * @brief 여러 세션의 임베딩을 한 번에 판정합니다.
+ * 모든 쿼리를 같은 DB snapshot에 대해 블록 단위 행렬-행렬 곱 한 번으로 계산하므로,
+ * 세션별로 sv_session_verify()를 호출할 때보다 DB 행렬을 캐시로 읽는 횟수가 줄어듭니다.
+ * 이득은 DB 행렬이 캐시보다 클 때만 나타나며 (host 16세션: L2 안 ~1.0x, L2 밖 1.4~1.6x),
+ * target은 DB가 항상 32KB 캐시보다 크므로 여러 스트림을 판정할 때 이 경로를 사용합니다.
+ * (후처리는 세션별 상태로 각각 수행)
+ *
+ * @param sessions 세션 배열 (모두 같은 handle의 세션, 같은 세션 중복 불가)
+ * @param embeddings 세션별 임베딩 포인터 배열 (각 크기: handle->embedding_dim)
+ * @param count 세션 수 (SV_MAX_BATCH를 넘으면 나누어 계산)
+ * @param results 세션별 결과 출력 [count]
+ * @return sv_status_t (SV_SUCCESS, SV_ERROR)
+ */
+sv_status_t sv_verify_sessions(sv_session_t* const* sessions, float* const* embeddings, int count,
+                               sv_result_t* results);
+
+/**
+ * @brief 판정 통계의 현재 값을 복사합니다. (SV_ENABLE_STATS=1 빌드)
+ * 모든 handle과 세션의 판정을 합산하며, 판정 task와 동시에 호출해도 됩니다.
+ * threshold와 후처리 알고리즘을 현장 데이터(점수 분포, 판정 지연)로 조정하는 데 사용합니다.
+ *
+ * @param out 통계 복사본
+ * @return SV_SUCCESS, 통계가 빌드에서 제외되었으면 SV_ERROR (out은 0으로 채움)
+ */
+sv_status_t sv_get_stats(sv_stats_t* out);
+
+/**
+ * @brief 판정 통계를 0으로 초기화합니다. (SV_ENABLE_STATS=0 빌드에서는 아무것도 하지 않음)
+ */
+void sv_reset_stats(void);
+
 
 //=========================== tasks ===========================
 
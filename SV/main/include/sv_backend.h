@@ -0,0 +1,44 @@
+#ifndef SV_BACKEND_H
+#define SV_BACKEND_H
+
+//=========================== header ==========================
+#include "speaker_verifier.h"  // sv_handle_t, sv_status_t
+
+/*
+ * 점수 계산 backend (sv_config_t.backend로 선택)
+ *
+ * 모든 backend의 점수는 DB 행과 쿼리 벡터의 내적에 상수 항을 더한 형태입니다.
+ *   score(r) = dot(row_r, query) + row_bias[r] + query_bias
+ * 화자별 항(DB 행, row_bias)은 등록/로드 시 한 번만 계산하므로,
+ * 판정 시에는 backend와 무관하게 같은 행렬-벡터 커널 한 번과 행별 덧셈만 수행합니다.
+ *
+ *   cosine: 행/쿼리 모두 (투영 후) 단위 벡터, 상수 항 없음
+ *   plda:   two-covariance PLDA 로그 우도비 (config.projection에 PLDA 모델 필요, 점수는 LLR 단위)
+ */
+
+//=========================== typedef ===========================
+typedef struct sv_backend_ops {
+    const char* name;
+    bool unit_rows;  // DB 행이 단위 벡터 (정규화되지 않은 이미지 행은 1/norm 보정, AS-norm 사용 가능)
+
+    // 모델 준비 (handle->backend_ctx 할당, 실패 시 SV_ERROR) / 해제
+    sv_status_t (*create)(sv_handle_t* handle);
+    void (*destroy)(sv_handle_t* handle);
+
+    // 입력 임베딩 [handle->embedding_dim] -> DB 행 벡터 [handle->dim] (등록, 저장소 seed, cohort; in != out)
+    void (*enroll)(const sv_handle_t* handle, const float* in, float* out);
+
+    // DB 행의 상수 항 (NULL: 항상 0)
+    float (*row_bias)(const sv_handle_t* handle, const float* row);
+
+    // 입력 임베딩 [handle->embedding_dim] -> 쿼리 벡터 [handle->dim]와 쿼리 상수 항 (in != out)
+    void (*query)(const sv_handle_t* handle, const float* in, float* out, float* query_bias);
+} sv_backend_ops_t;
+
+
+//=========================== variables ===========================
+extern const sv_backend_ops_t sv_backend_cosine;
+extern const sv_backend_ops_t sv_backend_plda;
+
+
+#endif
@@ -4,11 +4,11 @@
 #ifndef SV_DATABASE_H
 #define SV_DATABASE_H
 
-#define SV_EMBEDDING_DIM 192
+#define SV_DATABASE_DIM 192
 
 
 // 화자: S_CLEAN_Far_V
-const float S_CLEAN_FAR_V_EMB[SV_EMBEDDING_DIM] = {
+const float S_CLEAN_FAR_V_EMB[SV_DATABASE_DIM] = {
     -0.10802276f, -0.06316585f, -0.10893821f, 0.08513657f, -0.01281626f, 0.00915447f, 0.02471707f, 0.04119512f, 
     0.02746341f, 0.10344552f, -0.01922439f, -0.15562601f, 0.03478699f, -0.00823902f, 0.19956745f, 0.04760325f, 
     0.15837234f, -0.09520650f, -0.00183089f, 0.00640813f, -0.02746342f, 0.02380162f, 0.11351544f, -0.03570243f, 
@@ -36,7 +36,7 @@ const float S_CLEAN_FAR_V_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_CLEAN_V
-const float S_CLEAN_V_EMB[SV_EMBEDDING_DIM] = {
+const float S_CLEAN_V_EMB[SV_DATABASE_DIM] = {
     -0.04760325f, 0.00549268f, -0.13182439f, -0.00732358f, -0.15654145f, -0.08696748f, 0.06041951f, 0.02105528f, 
     -0.01739349f, 0.08239024f, 0.07689755f, -0.08422113f, -0.01739350f, -0.05218048f, 0.19499023f, 0.04394146f, 
     0.07689755f, -0.09154471f, -0.02288618f, -0.03570244f, -0.05858861f, -0.03204065f, 0.22153820f, -0.07781300f, 
@@ -64,7 +64,7 @@ const float S_CLEAN_V_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_CLEAN_Far_V
-const float I_CLEAN_FAR_V_EMB[SV_EMBEDDING_DIM] = {
+const float I_CLEAN_FAR_V_EMB[SV_DATABASE_DIM] = {
     -0.11443088f, -0.14464064f, -0.19132845f, 0.01190081f, -0.14555609f, -0.01739350f, -0.01006992f, 0.07140487f, 
     -0.08239024f, 0.10069919f, 0.04394146f, -0.09337560f, 0.03661789f, -0.06316585f, 0.10069919f, 0.08055934f, 
     0.09978374f, -0.11443088f, -0.01281626f, 0.03112520f, 0.07323577f, 0.06316585f, 0.19407480f, -0.10344553f, 
@@ -92,7 +92,7 @@ const float I_CLEAN_FAR_V_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_CLEAN_V
-const float I_CLEAN_V_EMB[SV_EMBEDDING_DIM] = {
+const float I_CLEAN_V_EMB[SV_DATABASE_DIM] = {
     -0.04119512f, -0.07048943f, -0.22153820f, -0.05858861f, -0.19224389f, -0.12816260f, 0.03570244f, 0.05675772f, 
     -0.08147479f, 0.07232032f, 0.08879837f, -0.07781301f, 0.03661789f, -0.04577236f, 0.09246016f, 0.04119512f, 
     0.08696747f, -0.08879837f, -0.04668780f, 0.05767317f, -0.02471707f, 0.04211057f, 0.23618536f, -0.03936422f, 
@@ -120,7 +120,7 @@ const float I_CLEAN_V_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_CLEAN_Far_A
-const float S_CLEAN_FAR_A_EMB[SV_EMBEDDING_DIM] = {
+const float S_CLEAN_FAR_A_EMB[SV_DATABASE_DIM] = {
     -0.10161462f, 0.02837886f, -0.07689755f, 0.05858861f, -0.03570244f, -0.02563252f, 0.01373171f, 0.04485691f, 
     -0.00366179f, 0.11809268f, 0.00457723f, -0.08330569f, -0.01281626f, 0.01098536f, 0.11168454f, -0.05309593f, 
     0.08055934f, -0.05767317f, -0.01830894f, 0.00915447f, -0.01281626f, -0.00640813f, 0.06041951f, -0.05584227f, 
@@ -148,7 +148,7 @@ const float S_CLEAN_FAR_A_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_CLEAN_A
-const float S_CLEAN_A_EMB[SV_EMBEDDING_DIM] = {
+const float S_CLEAN_A_EMB[SV_DATABASE_DIM] = {
     -0.05218049f, 0.03936423f, -0.02013984f, -0.04027967f, -0.11717723f, -0.06865853f, 0.00000000f, -0.02288618f, 
     -0.09795284f, 0.09795284f, 0.05675772f, -0.00640813f, -0.05492683f, -0.02471707f, 0.10802276f, -0.05218048f, 
     0.01464715f, -0.08605203f, -0.03661789f, -0.02471707f, -0.06041951f, -0.00640813f, 0.09154471f, -0.05950406f, 
@@ -176,7 +176,7 @@ const float S_CLEAN_A_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_CLEAN_Far_A
-const float I_CLEAN_FAR_A_EMB[SV_EMBEDDING_DIM] = {
+const float I_CLEAN_FAR_A_EMB[SV_DATABASE_DIM] = {
     -0.07689755f, -0.05767317f, -0.12175446f, 0.01647805f, -0.12083902f, -0.03204065f, -0.03570244f, -0.00274634f, 
     -0.07689755f, 0.07598212f, 0.04211057f, -0.01373171f, 0.02563252f, -0.01098536f, 0.07415121f, 0.04668780f, 
     0.04027967f, -0.04119512f, -0.05584227f, -0.01281626f, 0.05126504f, 0.02380162f, 0.09246016f, -0.05858861f, 
@@ -204,7 +204,7 @@ const float I_CLEAN_FAR_A_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_CLEAN_A
-const float I_CLEAN_A_EMB[SV_EMBEDDING_DIM] = {
+const float I_CLEAN_A_EMB[SV_DATABASE_DIM] = {
     -0.04760325f, -0.03112520f, -0.11809268f, -0.02929430f, -0.08513659f, -0.16203414f, 0.06408130f, -0.04668780f, 
     -0.10619187f, 0.08788291f, 0.07323576f, -0.00457723f, -0.00274634f, -0.00274634f, 0.06499674f, 0.04211057f, 
     0.05584227f, -0.03020976f, -0.07415121f, 0.01281626f, -0.06408129f, 0.05950406f, 0.05309593f, -0.06865853f, 
@@ -232,7 +232,7 @@ const float I_CLEAN_A_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_RIR
-const float S_RIR_EMB[SV_EMBEDDING_DIM] = {
+const float S_RIR_EMB[SV_DATABASE_DIM] = {
     -0.06124341f, 0.05465219f, 0.01263317f, -0.05163122f, -0.09035463f, -0.02059756f, -0.01949902f, -0.02773805f, 
     -0.11397317f, 0.13704243f, 0.06591219f, -0.05053268f, -0.07772146f, -0.03432927f, 0.12688097f, -0.05629999f, 
     0.03432927f, -0.10710731f, -0.02526634f, -0.00823902f, -0.05520146f, 0.00714049f, 0.16532974f, -0.07470048f, 
@@ -260,7 +260,7 @@ const float S_RIR_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_RIR_Far
-const float S_RIR_FAR_EMB[SV_EMBEDDING_DIM] = {
+const float S_RIR_FAR_EMB[SV_DATABASE_DIM] = {
     -0.10765658f, -0.00054927f, -0.04146975f, 0.10133999f, 0.01016146f, 0.03075902f, -0.02526634f, 0.04833561f, 
     -0.01840049f, 0.15269657f, -0.02718878f, -0.14116194f, -0.03130829f, -0.00494341f, 0.14418292f, -0.00576732f, 
     0.09941756f, -0.07634829f, -0.03597707f, 0.04558927f, -0.01071073f, 0.02059756f, 0.06261658f, -0.07277805f, 
@@ -288,7 +288,7 @@ const float S_RIR_FAR_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_RIR
-const float I_RIR_EMB[SV_EMBEDDING_DIM] = {
+const float I_RIR_EMB[SV_DATABASE_DIM] = {
     -0.07305268f, 0.00247171f, -0.11205073f, -0.06453902f, -0.05272975f, -0.13237365f, -0.00439415f, -0.04119512f, 
     -0.08184097f, 0.10491023f, 0.08074244f, -0.07991853f, -0.03515317f, -0.00631658f, 0.07030634f, 0.04394146f, 
     0.10188926f, -0.07662292f, -0.03350536f, 0.04696244f, -0.03487853f, 0.07909463f, 0.12880341f, -0.08046780f, 
@@ -316,7 +316,7 @@ const float I_RIR_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_RIR_Far
-const float I_RIR_FAR_EMB[SV_EMBEDDING_DIM] = {
+const float I_RIR_FAR_EMB[SV_DATABASE_DIM] = {
     -0.10079072f, -0.03515317f, -0.07524975f, 0.04201902f, -0.10710731f, 0.01592878f, -0.03762488f, 0.00659122f, 
     -0.09447414f, 0.10436097f, 0.01647805f, -0.05465219f, 0.00851366f, -0.03295609f, 0.09804439f, 0.05712390f, 
     0.07250341f, -0.07140487f, -0.02361854f, 0.01977366f, 0.02828732f, 0.04119512f, 0.11012828f, -0.07936927f, 
@@ -344,7 +344,7 @@ const float I_RIR_FAR_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_NOISEcvd_Far_A
-const float S_NOISECVD_FAR_A_EMB[SV_EMBEDDING_DIM] = {
+const float S_NOISECVD_FAR_A_EMB[SV_DATABASE_DIM] = {
     -0.12175447f, -0.09337560f, -0.16752683f, 0.06408130f, -0.01922439f, -0.02013984f, 0.03112520f, 0.01464715f, 
     -0.02105528f, 0.10436097f, -0.07689755f, -0.03478699f, -0.01098536f, 0.03936423f, 0.06957398f, 0.05218048f, 
     0.11900812f, -0.11443088f, 0.00183089f, -0.00732358f, -0.04211057f, -0.00091545f, 0.05492683f, -0.09062926f, 
@@ -372,7 +372,7 @@ const float S_NOISECVD_FAR_A_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_NOISEcvd_A
-const float S_NOISECVD_A_EMB[SV_EMBEDDING_DIM] = {
+const float S_NOISECVD_A_EMB[SV_DATABASE_DIM] = {
     -0.03387154f, -0.08330568f, -0.13365528f, -0.05309593f, -0.08879837f, -0.03112520f, -0.01281626f, -0.00549268f, 
     -0.13365526f, 0.04851870f, -0.01190081f, 0.06682764f, -0.05401138f, -0.01464715f, 0.05218049f, 0.01647805f, 
     0.07048943f, -0.10436097f, -0.04394146f, 0.02837886f, -0.06499674f, 0.00549268f, 0.13731706f, -0.03844878f, 
@@ -400,7 +400,7 @@ const float S_NOISECVD_A_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_NOISEcvd_Far_A
-const float I_NOISECVD_FAR_A_EMB[SV_EMBEDDING_DIM] = {
+const float I_NOISECVD_FAR_A_EMB[SV_DATABASE_DIM] = {
     -0.09612194f, -0.09703740f, -0.17942762f, 0.03204065f, -0.12358537f, -0.01556260f, -0.02288618f, 0.00366179f, 
     -0.07964390f, 0.06133495f, -0.01190081f, 0.00366179f, 0.02013984f, -0.01830894f, 0.04943414f, 0.07140487f, 
     0.05401138f, -0.04943414f, -0.03112520f, -0.01190081f, -0.02105528f, 0.04485691f, 0.07872845f, -0.06682764f, 
@@ -428,7 +428,7 @@ const float I_NOISECVD_FAR_A_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_NOISEcvd_A
-const float I_NOISECVD_A_EMB[SV_EMBEDDING_DIM] = {
+const float I_NOISECVD_A_EMB[SV_DATABASE_DIM] = {
     -0.06774308f, -0.10436097f, -0.18766665f, -0.07048943f, -0.08879837f, -0.10985365f, 0.03844878f, -0.02288618f, 
     -0.09886829f, 0.03295609f, 0.00183089f, 0.04851870f, -0.03753333f, 0.01190081f, -0.00183089f, 0.07048943f, 
     0.04119512f, -0.03204064f, -0.06682764f, 0.02837886f, -0.08330569f, 0.03570244f, 0.11168454f, -0.05492683f, 
@@ -456,7 +456,7 @@ const float I_NOISECVD_A_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_CCd
-const float S_CCD_EMB[SV_EMBEDDING_DIM] = {
+const float S_CCD_EMB[SV_DATABASE_DIM] = {
     -0.03735024f, 0.01647805f, -0.04256829f, -0.05739853f, -0.09639658f, -0.03789951f, -0.01785122f, -0.02718878f, 
     -0.11397316f, 0.13045122f, 0.04998341f, -0.02169610f, -0.06371512f, -0.02306927f, 0.11259999f, -0.04449073f, 
     0.04256829f, -0.11205073f, -0.03982195f, 0.01208390f, -0.06563756f, -0.00219707f, 0.17713900f, -0.06783463f, 
@@ -484,7 +484,7 @@ const float S_CCD_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_Far_CCd
-const float S_FAR_CCD_EMB[SV_EMBEDDING_DIM] = {
+const float S_FAR_CCD_EMB[SV_DATABASE_DIM] = {
     -0.09639658f, -0.02636488f, -0.07882000f, 0.09612194f, 0.01098536f, 0.00686585f, 0.01537951f, 0.04778634f, 
     -0.00411951f, 0.15983706f, -0.03844878f, -0.11726878f, -0.01098536f, -0.00521805f, 0.13566926f, 0.00164780f, 
     0.09996683f, -0.07058097f, -0.03652634f, 0.05025805f, -0.01922439f, 0.01345707f, 0.07524975f, -0.05794780f, 
@@ -512,7 +512,7 @@ const float S_FAR_CCD_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_CCd
-const float I_CCD_EMB[SV_EMBEDDING_DIM] = {
+const float I_CCD_EMB[SV_DATABASE_DIM] = {
     -0.06508829f, -0.05382829f, -0.16093560f, -0.04833561f, -0.05987024f, -0.16121023f, 0.03130829f, -0.03982195f, 
     -0.08074243f, 0.10848048f, 0.05712390f, -0.05904634f, -0.01675268f, 0.00109854f, 0.04751170f, 0.03735024f, 
     0.11122682f, -0.04751170f, -0.06948244f, 0.04504000f, -0.05437756f, 0.05437756f, 0.12633170f, -0.09227707f, 
@@ -540,7 +540,7 @@ const float I_CCD_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_Far_CCd
-const float I_FAR_CCD_EMB[SV_EMBEDDING_DIM] = {
+const float I_FAR_CCD_EMB[SV_DATABASE_DIM] = {
     -0.09804438f, -0.07387658f, -0.11836731f, 0.04888487f, -0.11287463f, -0.00631659f, -0.03432927f, 0.00054927f, 
     -0.08705902f, 0.11314926f, 0.01043610f, -0.05382829f, 0.02691415f, -0.04888487f, 0.08705902f, 0.07909463f, 
     0.04915951f, -0.06701073f, -0.04201902f, 0.01043610f, 0.02856195f, 0.04888487f, 0.12605706f, -0.06481366f, 
@@ -568,7 +568,7 @@ const float I_FAR_CCD_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_CCv
-const float S_CCV_EMB[SV_EMBEDDING_DIM] = {
+const float S_CCV_EMB[SV_DATABASE_DIM] = {
     -0.04284292f, 0.01647805f, -0.04970878f, -0.05410292f, -0.09337561f, -0.04613853f, -0.01400634f, -0.01345707f, 
     -0.11314926f, 0.13237365f, 0.04915951f, -0.02389317f, -0.06096878f, -0.03103366f, 0.11754341f, -0.04064585f, 
     0.04696244f, -0.10793121f, -0.03680097f, 0.00906293f, -0.06481365f, -0.00768976f, 0.16313266f, -0.07305268f, 
@@ -596,7 +596,7 @@ const float S_CCV_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_Far_CCv
-const float S_FAR_CCV_EMB[SV_EMBEDDING_DIM] = {
+const float S_FAR_CCV_EMB[SV_DATABASE_DIM] = {
     -0.10408634f, -0.03130829f, -0.07964390f, 0.09667121f, 0.00933756f, 0.00109854f, 0.01949902f, 0.05684926f, 
     -0.00521805f, 0.15352047f, -0.03405463f, -0.11754341f, -0.01098536f, -0.01290780f, 0.14528146f, -0.00164781f, 
     0.10875512f, -0.06755999f, -0.03707561f, 0.05108195f, -0.01757658f, 0.01400634f, 0.06618683f, -0.06398975f, 
@@ -624,7 +624,7 @@ const float S_FAR_CCV_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_CCv
-const float I_CCV_EMB[SV_EMBEDDING_DIM] = {
+const float I_CCV_EMB[SV_DATABASE_DIM] = {
     -0.06234195f, -0.05437756f, -0.16505511f, -0.04970878f, -0.06344048f, -0.16230877f, 0.03597707f, -0.03295610f, 
     -0.08129170f, 0.10518487f, 0.06069414f, -0.05739854f, -0.01428097f, -0.00604195f, 0.05794780f, 0.03899805f, 
     0.11452243f, -0.04394146f, -0.06756000f, 0.03954732f, -0.05272975f, 0.05245512f, 0.11699414f, -0.09612194f, 
@@ -652,7 +652,7 @@ const float I_CCV_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_Far_CCv
-const float I_FAR_CCV_EMB[SV_EMBEDDING_DIM] = {
+const float I_FAR_CCV_EMB[SV_DATABASE_DIM] = {
     -0.10271316f, -0.07579902f, -0.12221219f, 0.04998341f, -0.10930438f, -0.01180927f, -0.03323073f, 0.00768976f, 
     -0.08541121f, 0.10848048f, 0.01208390f, -0.04998341f, 0.03185756f, -0.05327902f, 0.09529804f, 0.07497512f, 
     0.05190585f, -0.06426439f, -0.04201902f, 0.00961219f, 0.02883658f, 0.04092048f, 0.12990194f, -0.07058097f, 
@@ -680,7 +680,7 @@ const float I_FAR_CCV_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_Far_ddd
-const float S_FAR_DDD_EMB[SV_EMBEDDING_DIM] = {
+const float S_FAR_DDD_EMB[SV_DATABASE_DIM] = {
     -0.08330569f, -0.10619187f, -0.17393495f, 0.01556260f, -0.03020976f, -0.02105528f, 0.02471707f, -0.03478699f, 
     -0.01556260f, 0.08055934f, -0.08788291f, 0.01281626f, -0.05767317f, 0.06774308f, 0.01464715f, 0.09795284f, 
     0.10344552f, -0.15654145f, -0.01464715f, -0.00274634f, -0.08239024f, 0.00823902f, 0.08239024f, -0.08788291f, 
@@ -708,7 +708,7 @@ const float S_FAR_DDD_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_ddd
-const float S_DDD_EMB[SV_EMBEDDING_DIM] = {
+const float S_DDD_EMB[SV_DATABASE_DIM] = {
     -0.04943414f, -0.09978373f, -0.12999348f, -0.07415122f, -0.02471707f, -0.01373171f, -0.02654796f, -0.07232032f, 
     -0.10802275f, 0.05675772f, -0.06957398f, 0.09520650f, -0.08788291f, 0.05492683f, -0.05401138f, -0.00457724f, 
     0.12999348f, -0.15013331f, -0.04119512f, 0.09062926f, -0.11534633f, 0.00366179f, 0.14372520f, -0.03570244f, 
@@ -736,7 +736,7 @@ const float S_DDD_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_Far_ddd
-const float I_FAR_DDD_EMB[SV_EMBEDDING_DIM] = {
+const float I_FAR_DDD_EMB[SV_DATABASE_DIM] = {
     -0.04577236f, -0.11717723f, -0.15471055f, 0.01830894f, -0.14738698f, -0.01281626f, 0.00183089f, -0.03661789f, 
     -0.04668780f, 0.04119512f, -0.03936423f, 0.00640813f, -0.00640813f, 0.02105528f, 0.01922439f, 0.08605202f, 
     0.07323577f, -0.04211056f, -0.02929431f, -0.00366179f, -0.04668780f, -0.00457723f, 0.11351544f, -0.06591220f, 
@@ -764,7 +764,7 @@ const float I_FAR_DDD_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_ddd
-const float I_DDD_EMB[SV_EMBEDDING_DIM] = {
+const float I_DDD_EMB[SV_DATABASE_DIM] = {
     -0.08788293f, -0.12450080f, -0.16478047f, -0.06865853f, -0.10344552f, -0.06957398f, -0.01006992f, -0.06133496f, 
     -0.09154471f, 0.04943414f, -0.04485691f, 0.05950406f, -0.05584227f, 0.03661789f, -0.06041951f, 0.03844878f, 
     0.02105528f, -0.06774308f, -0.05218048f, 0.05309593f, -0.11259999f, -0.01190081f, 0.14189430f, -0.05675772f, 
@@ -792,7 +792,7 @@ const float I_DDD_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_Far_vvv
-const float S_FAR_VVV_EMB[SV_EMBEDDING_DIM] = {
+const float S_FAR_VVV_EMB[SV_DATABASE_DIM] = {
     -0.17485040f, -0.15471056f, -0.20872194f, 0.07781300f, -0.02288618f, -0.05767317f, 0.07323577f, 0.04394146f, 
     -0.03295610f, 0.03112520f, -0.09154471f, 0.01464715f, -0.03387154f, 0.02288618f, 0.09703740f, 0.05492683f, 
     0.17301948f, -0.12999350f, 0.03112520f, -0.05492683f, -0.03387154f, -0.02654797f, -0.02013984f, -0.12633170f, 
@@ -820,7 +820,7 @@ const float S_FAR_VVV_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: S_vvv
-const float S_VVV_EMB[SV_EMBEDDING_DIM] = {
+const float S_VVV_EMB[SV_DATABASE_DIM] = {
     -0.07415122f, -0.12999348f, -0.20872194f, -0.05767317f, -0.04211057f, -0.05034959f, 0.01373171f, 0.02288618f, 
     -0.11626178f, 0.01464715f, -0.06957398f, 0.07598211f, -0.05584227f, -0.00823902f, 0.00640813f, 0.04027967f, 
     0.17210405f, -0.08239024f, -0.01281626f, 0.02837886f, -0.06591219f, -0.01281626f, 0.05950406f, -0.05767317f, 
@@ -848,7 +848,7 @@ const float S_VVV_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_Far_vvv
-const float I_FAR_VVV_EMB[SV_EMBEDDING_DIM] = {
+const float I_FAR_VVV_EMB[SV_DATABASE_DIM] = {
     -0.12358535f, -0.12816261f, -0.21879186f, 0.04485691f, -0.09886829f, -0.04668780f, -0.00091545f, 0.00915447f, 
     -0.05767317f, 0.01739349f, -0.03936423f, 0.03295609f, 0.03112520f, -0.01098536f, 0.08147479f, 0.06865853f, 
     0.09337560f, -0.03844878f, -0.00640813f, -0.02288618f, -0.02746341f, -0.00549268f, 0.08696748f, -0.09520650f, 
@@ -876,7 +876,7 @@ const float I_FAR_VVV_EMB[SV_EMBEDDING_DIM] = {
 };
 
 // 화자: I_vvv
-const float I_VVV_EMB[SV_EMBEDDING_DIM] = {
+const float I_VVV_EMB[SV_DATABASE_DIM] = {
     -0.09337560f, -0.13182439f, -0.24167804f, -0.07048943f, -0.12907805f, -0.08879837f, 0.06865853f, -0.01739350f, 
     -0.09886829f, 0.01190081f, 0.00091545f, 0.08605202f, -0.01098536f, -0.00366179f, -0.00091545f, 0.05492682f, 
     0.04394146f, -0.00549268f, -0.03112520f, 0.01006992f, -0.05858861f, 0.01647805f, 0.05218049f, -0.07232032f, 
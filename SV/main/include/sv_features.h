@@ -0,0 +1,64 @@
+#ifndef SV_FEATURES_H
+#define SV_FEATURES_H
+
+//=========================== header ==========================
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * 등록 발화 특징 보관 (모델 교체 후 재임베딩용)
+ *
+ * 모델 입력 특징(log-mel 등, [num_frames][num_bins])을 bin별 8비트 선형 양자화로 저장합니다.
+ *   값 = offset[b] + q[f][b] * step[b]   (offset/step은 발화 안의 bin별 최소값/범위 / 255)
+ * 3초 발화(299 x 80)는 float 96KB 대신 약 24KB이며, 양자화 오차는 bin 범위의 1/510 이하입니다.
+ * 블록 하나(header + offset + step + q)를 한 번에 할당합니다. (target: PSRAM 우선)
+ */
+
+//=========================== define ===========================
+#define SV_FEATURES_TAG "sv_features"    // log tag
+
+
+//=========================== typedef ===========================
+// 인코딩된 발화 특징 하나 (같은 화자의 발화는 next로 연결)
+typedef struct sv_features {
+    struct sv_features* next;        // 다음 발화 (NULL: 끝)
+    uint16_t num_frames;
+    uint16_t num_bins;
+    const float* offset;             // [num_bins] bin별 최소값 (같은 블록 안)
+    const float* step;               // [num_bins] bin별 양자화 간격
+    const uint8_t* q;                // [num_frames][num_bins]
+} sv_features_t;
+
+
+//=========================== prototypes ===========================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 특징 행렬을 인코딩한 블록을 만듭니다.
+ *
+ * @param features 특징 [num_frames][num_bins]
+ * @param num_frames 프레임 수 (1 ~ 65535)
+ * @param num_bins 프레임당 bin 수 (1 ~ 65535)
+ * @return 블록 포인터 (sv_features_free로 해제), 실패 시 NULL
+ */
+sv_features_t* sv_features_encode(const float* features, int num_frames, int num_bins);
+
+/**
+ * @brief 블록을 특징 행렬로 복원합니다.
+ *
+ * @param out 출력 [num_frames][num_bins]
+ */
+void sv_features_decode(const sv_features_t* features, float* out);
+
+/**
+ * @brief 블록 하나를 해제합니다. (next는 해제하지 않음)
+ */
+void sv_features_free(sv_features_t* features);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef SV_IMAGE_H
+#define SV_IMAGE_H
+
+//=========================== header ==========================
+#include <stdint.h>
+
+/*
+ * 화자 DB 바이너리 이미지 형식 (csv_to_header.py가 sv_database.bin으로 생성)
+ *
+ *   [header 64B][speaker_id int32[N]][scale float[N] (int8만)][name char[N][name_len]][pad][row 0][row 1]...
+ * 모든 offset은 이미지 시작 기준이며, 임베딩 행은 16바이트 정렬되어 있습니다.
+ * 검증기는 이미지에서 바로 점수를 계산하므로 (sv_config_t.db_image) 임베딩을 RAM으로 복사하지 않습니다.
+ *
+ * 사용 예:
+ *   1) 펌웨어에 포함: main/CMakeLists.txt의 idf_component_register(... EMBED_FILES "sv_database.bin")
+ *      extern const uint8_t sv_db_start[] asm("_binary_sv_database_bin_start");
+ *      config.db_image = sv_db_start;
+ *   2) 파티션에 기록: esptool.py write_flash <offset> sv_database.bin 후
+ *      esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &config.db_image, &mmap_handle);
+ *      (화자 목록이 바뀌어도 펌웨어를 다시 빌드할 필요 없음)
+ */
+
+//=========================== define ===========================
+#define SV_IMAGE_MAGIC 0x4D495653u       // "SVIM"
+#define SV_IMAGE_VERSION 1
+#define SV_IMAGE_HEADER_SIZE 64
+#define SV_IMAGE_ALIGN 16                // 임베딩 행 정렬 단위 (바이트)
+
+#define SV_IMAGE_FLAG_NORMALIZED 0x01    // 임베딩이 미리 L2 정규화되어 있음
+
+
+//=========================== typedef ===========================
+// 임베딩 인코딩
+typedef enum {
+    SV_IMAGE_F32 = 0,                    // float32
+    SV_IMAGE_INT8 = 1,                   // int8 + 행별 scale (값 = q * scale)
+    SV_IMAGE_FP16 = 2                    // IEEE 754 half
+} sv_image_encoding_t;
+
+// 이미지 header (little-endian)
+typedef struct sv_image_header {
+    uint32_t magic;          // SV_IMAGE_MAGIC
+    uint16_t version;        // SV_IMAGE_VERSION
+    uint16_t dim;            // 임베딩 차원 (projection 사용 시 투영된 차원)
+    uint32_t num_speakers;   // 화자 수
+    uint8_t encoding;        // sv_image_encoding_t
+    uint8_t flags;           // SV_IMAGE_FLAG_*
+    uint16_t name_len;       // 이름 항목 크기 (바이트, 널 종료 포함)
+    uint32_t row_stride;     // 임베딩 행 간격 (바이트, SV_IMAGE_ALIGN의 배수)
+    uint32_t ids_offset;     // int32 speaker_id[num_speakers]
+    uint32_t scales_offset;  // float scale[num_speakers] (int8만, 그 외 0)
+    uint32_t names_offset;   // char name[num_speakers][name_len]
+    uint32_t rows_offset;    // 임베딩 행 시작 (SV_IMAGE_ALIGN 정렬)
+    uint32_t total_size;     // 이미지 전체 크기 (바이트)
+    uint8_t reserved[SV_IMAGE_HEADER_SIZE - 40];
+} sv_image_header_t;
+
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef SV_IVF_H
+#define SV_IVF_H
+
+//=========================== header ==========================
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * 화자 DB 역색인 (IVF, inverted file) - 대규모 화자 목록용 (gateway)
+ *
+ * DB 행을 k-means 중심(centroid) nlist개로 묶고, 목록별 DB 행 번호를 목록 순서대로 연속 저장합니다.
+ * 판정 시에는 쿼리와 가까운 중심 nprobe개의 목록에 속한 행만 원래 DB 행으로 정확히 점수를 계산하므로
+ * 판정 비용이 O(nlist·D + nprobe·N/nlist·D)로 줄어듭니다. (nlist ~ sqrt(N)이면 O(sqrt(N)·D))
+ * 행 데이터(sv_speaker_entry_t, 임베딩 chunk)는 DB와 공유하며 색인은 행 번호만 가집니다.
+ *
+ * 색인은 만든 뒤 변경되지 않으며 (DB snapshot 사이에 공유), 색인 생성 이후 추가/재사용된 행은
+ * snapshot의 ivf_pending 목록으로 선형 탐색하다가 일정 수 이상 쌓이면 색인을 다시 만듭니다.
+ * 삭제된 행은 목록에 남아 있어도 점수 계산에서 제외됩니다.
+ */
+
+//=========================== define ===========================
+#define SV_IVF_TAG "sv_ivf"              // log tag
+
+#define SV_IVF_MIN_LIST_SIZE 8           // 목록당 평균 행 수 최소값 (행이 적으면 목록 수를 줄이거나 색인 생략)
+#define SV_IVF_ITERATIONS 10             // k-means 반복 횟수
+
+
+//=========================== typedef ===========================
+typedef struct sv_ivf {
+    int nlist;               // 목록(중심) 수
+    int dim;                 // 중심 차원 (점수 계산 차원)
+    float* centroids;        // 단위 정규화된 중심 [nlist][dim] (SV_KERNEL_ALIGN 정렬)
+    int* offsets;            // 목록 l의 행은 rows[offsets[l] .. offsets[l + 1] - 1] [nlist + 1]
+    int* rows;               // 목록 순서로 연속 저장된 DB 행 번호 [num_rows]
+    int num_rows;            // 색인된 행 수
+} sv_ivf_t;
+
+
+//=========================== prototypes ===========================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 벡터들을 spherical k-means로 묶어 색인을 만듭니다. (writer에서 호출, O(iter·n·nlist·dim))
+ * 목록 수는 n / SV_IVF_MIN_LIST_SIZE 이하로 줄이며, 2개 미만이면 색인을 만들지 않습니다.
+ *
+ * @param vecs 점수 계산 공간의 벡터 [n][dim] (SV_KERNEL_ALIGN 정렬, 연속)
+ * @param rows 벡터별 DB 행 번호 [n]
+ * @param n 벡터 수
+ * @param dim 차원
+ * @param nlist 요청 목록 수
+ * @return 색인, 행이 적거나 메모리 부족 시 NULL
+ */
+sv_ivf_t* sv_ivf_build(const float* vecs, const int* rows, int n, int dim, int nlist);
+
+/**
+ * @brief 색인을 해제합니다. (NULL 허용, DB snapshot 유예 해제에 사용하므로 void*)
+ */
+void sv_ivf_destroy(void* ptr);
+
+/**
+ * @brief 쿼리와 가까운 목록 nprobe개를 고릅니다. (중심과의 내적 내림차순)
+ *
+ * @param work 중심 점수 작업 버퍼 [ivf->nlist]
+ * @param lists 선택된 목록 번호 출력 [nprobe]
+ * @return 선택된 목록 수 (min(nprobe, nlist))
+ */
+int sv_ivf_probe(const sv_ivf_t* ivf, const float* query, int nprobe, float* work, int* lists);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef SV_KERNELS_H
+#define SV_KERNELS_H
+
+//=========================== header ==========================
+#include <stddef.h>
+#include <stdint.h>
+
+
+//=========================== define ===========================
+#define SV_KERNEL_ALIGN 16     // 임베딩 행렬/벡터 정렬 단위 (바이트)
+
+
+//=========================== prototypes ===========================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief SV_KERNEL_ALIGN 바이트 정렬된 메모리를 할당합니다.
+ * (target: heap_caps_aligned_alloc, host: aligned_alloc)
+ *
+ * @param size 할당 크기 (바이트)
+ * @return 할당된 포인터, 실패 시 NULL
+ */
+void* sv_aligned_alloc(size_t size);
+
+/**
+ * @brief sv_aligned_alloc()으로 할당한 메모리를 해제합니다.
+ */
+void sv_aligned_free(void* ptr);
+
+/**
+ * @brief 벡터를 단위 길이로 L2 정규화합니다. (in == out 허용)
+ * norm이 0에 가까우면 0 벡터를 출력합니다.
+ *
+ * @param in  입력 벡터
+ * @param out 출력 벡터
+ * @param dim 벡터 차원
+ * @return 정규화 전 L2 norm
+ */
+float sv_l2_normalize(const float* in, float* out, int dim);
+
+/**
+ * @brief 행렬-벡터 곱으로 모든 행의 내적을 한 번에 계산합니다.
+ * out[r] = dot(mat + r * stride, vec, dim)
+ * (target: esp-dsp dsps_dotprod_f32, host: 자동 벡터화되는 C 루프, dim이 128/192/256/512이면 길이 특수화 커널)
+ *
+ * @param mat    행렬 시작 주소 (각 행은 SV_KERNEL_ALIGN 정렬 권장)
+ * @param stride 행 간격 (float 개수)
+ * @param vec    입력 벡터
+ * @param dim    벡터 차원
+ * @param rows   행 개수
+ * @param out    출력 (크기: rows)
+ */
+void sv_matvec_f32(const float* mat, int stride, const float* vec, int dim, int rows, float* out);
+
+/**
+ * @brief float 벡터를 대칭 int8로 양자화합니다. (per-vector scale)
+ * in[i] ≈ out[i] * (*scale), scale = max|in| / 127
+ *
+ * @param in    입력 벡터
+ * @param out   출력 int8 벡터
+ * @param dim   벡터 차원
+ * @param scale 출력 scale (0 벡터면 0)
+ */
+void sv_quantize_s8(const float* in, int8_t* out, int dim, float* scale);
+
+/**
+ * @brief int8 x int8 -> int32 행렬-벡터 곱 (esp-nn ansi 커널과 같은 형태, dim이 128/192/256/512이면 길이 특수화 커널)
+ * out[r] = sum(mat[r * stride + i] * vec[i])
+ *
+ * @param mat    int8 행렬 시작 주소
+ * @param stride 행 간격 (int8 개수)
+ * @param vec    int8 입력 벡터
+ * @param dim    벡터 차원
+ * @param rows   행 개수
+ * @param out    int32 누산 결과 (크기: rows)
+ */
+void sv_matvec_s8(const int8_t* mat, int stride, const int8_t* vec, int dim, int rows, int32_t* out);
+
+/**
+ * @brief float 벡터와 int8 벡터의 내적 (양자화 DB 재순위화용)
+ */
+float sv_dot_f32_s8(const float* a, const int8_t* b, int dim);
+
+/**
+ * @brief IEEE 754 half(fp16)를 float로 변환합니다. (subnormal/inf/NaN 포함)
+ */
+float sv_f16_to_f32(uint16_t h);
+
+/**
+ * @brief fp16 행렬과 float 벡터의 행렬-벡터 곱 (fp16 DB 이미지용)
+ * 행을 블록 단위로 float 변환한 뒤 float 내적 커널을 사용합니다.
+ *
+ * @param mat    fp16 행렬 시작 주소
+ * @param stride 행 간격 (fp16 개수)
+ * @param vec    입력 벡터
+ * @param dim    벡터 차원
+ * @param rows   행 개수
+ * @param out    출력 (크기: rows)
+ */
+void sv_matvec_f16(const uint16_t* mat, int stride, const float* vec, int dim, int rows, float* out);
+
+/**
+ * @brief 행렬과 여러 벡터의 곱 (여러 세션의 쿼리를 한 번에 판정할 때 사용)
+ * outs[q][r] = dot(mat + r * stride, vecs[q], dim)
+ * 행을 블록 단위로 나누어 블록 하나를 모든 벡터에 재사용하므로, 행렬은 캐시로 한 번만 읽습니다.
+ *
+ * @param mat      행렬 시작 주소
+ * @param stride   행 간격 (float 개수)
+ * @param vecs     입력 벡터 포인터 배열 (크기: num_vecs)
+ * @param num_vecs 벡터 개수
+ * @param dim      벡터 차원
+ * @param rows     행 개수
+ * @param outs     출력 포인터 배열 (각 크기: rows)
+ */
+void sv_matmat_f32(const float* mat, int stride, const float* const* vecs, int num_vecs,
+                   int dim, int rows, float* const* outs);
+
+/**
+ * @brief int8 행렬과 여러 int8 벡터의 곱 (sv_matmat_f32의 int8 버전)
+ */
+void sv_matmat_s8(const int8_t* mat, int stride, const int8_t* const* vecs, int num_vecs,
+                  int dim, int rows, int32_t* const* outs);
+
+/**
+ * @brief fp16 행렬과 여러 float 벡터의 곱 (행의 float 변환을 모든 벡터가 공유)
+ */
+void sv_matmat_f16(const uint16_t* mat, int stride, const float* const* vecs, int num_vecs,
+                   int dim, int rows, float* const* outs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
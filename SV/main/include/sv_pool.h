@@ -0,0 +1,104 @@
+#ifndef SV_POOL_H
+#define SV_POOL_H
+
+//=========================== header ==========================
+#include <stddef.h>
+#include <stdint.h>
+
+#include "speaker_verifier.h"  // sv_status_t, SV_DB_CHUNK_ROWS
+
+/*
+ * RAM 화자 DB의 임베딩 행 pool (chunk 단위 할당)
+ *
+ * 행은 SV_DB_CHUNK_ROWS개씩 묶인 chunk에 저장되며, chunk는 한 번 할당되면 이동하지 않습니다.
+ * 등록마다 힙을 할당하지 않고 chunk가 가득 찰 때만 새 chunk를 할당하므로 단편화가 생기지 않으며,
+ * 용량은 컴파일 시 상수가 아니라 메모리 크기로만 제한됩니다.
+ * (target: PSRAM에 할당, PSRAM이 없으면 내부 RAM / host: aligned_alloc)
+ *
+ * 삭제된 행은 free-list로 돌려받아 다음 등록에 재사용합니다.
+ * 어떤 reader도 더 이상 그 행을 보지 않는 시점에 반환하는 것은 호출자의 책임입니다. (DB snapshot 유예 해제)
+ * pool 자체는 writer만 접근합니다.
+ */
+
+//=========================== define ===========================
+#define SV_POOL_TAG "sv_pool"            // log tag
+
+
+//=========================== typedef ===========================
+typedef struct sv_pool {
+    size_t row_bytes;        // 행 크기 (SV_KERNEL_ALIGN의 배수)
+    uint8_t** chunks;        // chunk 테이블 [table_size] (앞의 num_chunks개 사용)
+    int num_chunks;
+    int table_size;
+
+    int num_rows;            // 한 번이라도 할당된 행 수 (이후 행은 미사용)
+    int* free_rows;          // 재사용 가능한 행 stack [num_chunks * SV_DB_CHUNK_ROWS]
+    int num_free;
+} sv_pool_t;
+
+
+//=========================== prototypes ===========================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 빈 pool을 만듭니다. (chunk는 첫 할당 시 생성)
+ *
+ * @param row_bytes 행 크기 (바이트, SV_KERNEL_ALIGN 배수로 올림)
+ * @return pool 포인터, 실패 시 NULL
+ */
+sv_pool_t* sv_pool_create(size_t row_bytes);
+
+/**
+ * @brief pool과 모든 chunk를 해제합니다.
+ */
+void sv_pool_destroy(sv_pool_t* pool);
+
+/**
+ * @brief 행 하나를 할당합니다. free-list의 행을 먼저 재사용하고, 없으면 끝에 추가합니다.
+ * (끝의 chunk가 가득 찬 경우에만 새 chunk를 할당)
+ *
+ * @return 행 번호, 메모리 부족 시 -1
+ */
+int sv_pool_alloc(sv_pool_t* pool);
+
+/**
+ * @brief 행을 free-list로 반환합니다. (이 행을 읽는 reader가 없어야 함)
+ */
+void sv_pool_free(sv_pool_t* pool, int row);
+
+/**
+ * @brief chunk를 새 메모리에 복사하여 교체합니다. (게시된 snapshot이 보는 행을 고칠 때의 copy-on-write)
+ * 이후 sv_pool_row()는 복사본을 가리키며, 이전 chunk를 읽는 reader가 모두 나간 뒤
+ * 반환된 이전 chunk를 sv_aligned_free()로 해제하는 것은 호출자의 책임입니다.
+ *
+ * @return 이전 chunk, 메모리 부족 시 NULL (교체하지 않음)
+ */
+uint8_t* sv_pool_clone_chunk(sv_pool_t* pool, int chunk);
+
+/**
+ * @brief 앞쪽 num_rows개 행만 남기고 뒤쪽 chunk를 해제합니다. free-list는 비워집니다.
+ * (compaction 후 호출, 남는 행은 모두 사용 중이고 잘리는 행을 읽는 reader가 없어야 함)
+ */
+void sv_pool_trim(sv_pool_t* pool, int num_rows);
+
+/**
+ * @brief 행 주소를 반환합니다. (SV_KERNEL_ALIGN 정렬)
+ */
+static inline uint8_t* sv_pool_row(const sv_pool_t* pool, int row) {
+    return pool->chunks[row >> SV_DB_CHUNK_SHIFT] + (size_t)(row & (SV_DB_CHUNK_ROWS - 1)) * pool->row_bytes;
+}
+
+/**
+ * @brief 현재 할당된 chunk로 저장할 수 있는 행 수
+ */
+static inline int sv_pool_capacity(const sv_pool_t* pool) {
+    return pool->num_chunks * SV_DB_CHUNK_ROWS;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
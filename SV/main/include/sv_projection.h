@@ -0,0 +1,56 @@
+#ifndef SV_PROJECTION_H
+#define SV_PROJECTION_H
+
+//=========================== header ==========================
+#include <stdint.h>
+
+/*
+ * 차원 축소 projection 바이너리 형식 (SV/host/sv_fit_projection이 sv_projection.bin으로 생성)
+ *
+ *   [header 64B][mean float[in_dim]][pad][matrix float[out_dim][in_dim]][psi float[out_dim] (PLDA만)]
+ * y = matrix * (x - mean) 으로 in_dim(handle의 embedding_dim) 임베딩을 out_dim 차원으로 줄인 뒤 L2 정규화하여 점수를 계산합니다.
+ * 등록 임베딩은 등록 시 한 번, 쿼리는 판정마다 한 번 투영되므로
+ * DB 메모리와 점수 계산량이 out_dim / in_dim 배로 줄어듭니다. (예: 192 -> 64, 약 1/3)
+ *
+ * 사용 예 (DB 이미지와 같은 방식, sv_image.h 참고):
+ *   1) 펌웨어에 포함: idf_component_register(... EMBED_FILES "sv_projection.bin")
+ *      extern const uint8_t sv_proj_start[] asm("_binary_sv_projection_bin_start");
+ *      config.projection = sv_proj_start;
+ *   2) 파티션에 기록 후 esp_partition_mmap으로 매핑하여 config.projection에 지정
+ *
+ * PLDA 모델 (SV_PROJ_FLAG_PLDA)은 같은 형식에 화자 간 분산 psi를 추가한 것입니다.
+ * matrix는 화자 내 공분산을 I로, 화자 간 공분산을 diag(psi)로 만드는 변환이며,
+ * 입력은 L2 정규화한 임베딩 기준입니다. (sv_config_t.backend = SV_BACKEND_PLDA, sv_backend.h 참고)
+ *
+ * 같은 DB 이미지/영구 저장소는 같은 projection으로만 사용해야 합니다.
+ * (DB 이미지 행은 투영된 차원으로 저장: csv_to_header.py의 PROJECTION_BIN_FILE,
+ *  영구 저장소는 차원이 다르면 열리지 않음)
+ */
+
+//=========================== define ===========================
+#define SV_PROJ_MAGIC 0x4A505653u        // "SVPJ"
+#define SV_PROJ_VERSION 1
+#define SV_PROJ_HEADER_SIZE 64
+#define SV_PROJ_ALIGN 16                 // mean/matrix 정렬 단위 (바이트)
+
+#define SV_PROJ_FLAG_LDA 0x01            // LDA로 학습됨 (없으면 PCA, 정보용)
+#define SV_PROJ_FLAG_PLDA 0x02           // two-covariance PLDA 모델 (psi_offset 유효)
+
+
+//=========================== typedef ===========================
+// projection header (little-endian)
+typedef struct sv_projection_header {
+    uint32_t magic;          // SV_PROJ_MAGIC
+    uint16_t version;        // SV_PROJ_VERSION
+    uint16_t flags;          // SV_PROJ_FLAG_*
+    uint16_t in_dim;         // 입력 임베딩 차원 (config.embedding_dim과 같아야 함)
+    uint16_t out_dim;        // 투영 차원 (1 ~ in_dim)
+    uint32_t mean_offset;    // float mean[in_dim] (SV_PROJ_ALIGN 정렬)
+    uint32_t matrix_offset;  // float matrix[out_dim][in_dim] (SV_PROJ_ALIGN 정렬, 행 우선)
+    uint32_t total_size;     // 전체 크기 (바이트)
+    uint32_t psi_offset;     // float psi[out_dim] 화자 간 분산 (PLDA만, 그 외 0)
+    uint8_t reserved[SV_PROJ_HEADER_SIZE - 28];
+} sv_projection_header_t;
+
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef SV_STORE_H
+#define SV_STORE_H
+
+//=========================== header ==========================
+#include <stddef.h>
+#include <stdint.h>
+
+#include "speaker_verifier.h"  // sv_status_t, SV_MAX_NAME_LEN
+
+#ifdef ESP_PLATFORM
+#include "esp_partition.h"
+#endif
+
+/*
+ * 화자 DB 영구 저장소 (flash 파티션, append-only journal)
+ *
+ * 파티션을 두 개의 bank로 나누어 사용하며, 유효한 header 중 generation이 큰 bank가 활성 bank입니다.
+ *   bank = [header 64B][record 0][record 1]...   (record는 고정 stride, 임베딩은 16바이트 정렬)
+ * 등록/삭제는 활성 bank 끝에 ADD/DEL record로 추가만 하고, bank가 가득 차면
+ * 살아 있는 ADD record만 다른 bank로 옮겨 쓰는 compaction을 수행합니다.
+ * 파티션 전체를 esp_partition_mmap으로 매핑하므로 임베딩은 복사 없이 flash에서 바로 읽습니다.
+ * (host 빌드에서는 파일을 mmap하여 파티션을 대신함)
+ *
+ * partitions.csv 예시:
+ *   sv_db,   data, 0x40,    ,           256K
+ */
+
+//=========================== define ===========================
+#define SV_STORE_TAG "sv_store"            // log tag
+#define SV_STORE_PARTITION_LABEL "sv_db"   // 기본 파티션 label (host: 파일 경로)
+#define SV_STORE_HOST_SIZE (256 * 1024)    // host 파일 크기 (파티션 크기 대용)
+
+#define SV_STORE_MAGIC 0x42445653u         // "SVDB"
+#define SV_STORE_VERSION 1
+#define SV_STORE_SECTOR_SIZE 4096          // flash erase 단위
+#define SV_STORE_HEADER_SIZE 64
+
+#define SV_STORE_OP_ERASED 0xFFFFFFFFu     // 비어 있는 slot (또는 쓰기 중 끊긴 record)
+#define SV_STORE_OP_ADD 0x0000A5A5u        // 화자 등록
+#define SV_STORE_OP_DEL 0x00005A5Au        // 화자 삭제
+#define SV_STORE_HASH_NONE 0xFFFFFFFFu     // model_hash 없이 기록된 record (기록되지 않은 flash)
+
+
+//=========================== typedef ===========================
+// bank header (compaction 완료 시 마지막에 기록되는 커밋 마커)
+typedef struct {
+    uint32_t magic;          // SV_STORE_MAGIC
+    uint16_t version;        // SV_STORE_VERSION
+    uint16_t dim;            // 임베딩 차원
+    uint32_t record_stride;  // record 간격 (바이트, 16의 배수)
+    uint32_t capacity;       // bank당 record 수
+    uint32_t generation;     // 클수록 최신 bank
+    uint32_t crc;            // 위 필드의 CRC32
+    uint8_t reserved[SV_STORE_HEADER_SIZE - 24];
+} sv_store_header_t;
+
+// record header (뒤에 float embedding[dim]이 이어짐)
+// op는 나머지 필드를 모두 쓴 뒤 마지막에 기록하여 끊긴 쓰기를 구분
+typedef struct {
+    uint32_t op;                       // SV_STORE_OP_*
+    int32_t speaker_id;
+    char name[SV_MAX_NAME_LEN];
+    uint32_t model_hash;               // 임베딩을 만든 모델 (0 또는 SV_STORE_HASH_NONE: 알 수 없음)
+} sv_store_record_t;
+
+// 열린 저장소 (읽기는 매핑된 메모리, 쓰기는 flash API)
+typedef struct sv_store {
+    const uint8_t* base;     // 매핑된 파티션 시작 주소
+    size_t size;             // 파티션 크기
+    size_t bank_size;        // bank 크기 (sector 배수)
+
+    int active_bank;         // 활성 bank (0 또는 1)
+    uint32_t generation;     // 활성 bank의 generation
+    int dim;                 // 임베딩 차원
+    size_t stride;           // record 간격 (바이트)
+    int capacity;            // bank당 record 수
+    int used;                // 활성 bank에 기록된 record 수 (journal 끝)
+
+#ifdef ESP_PLATFORM
+    const esp_partition_t* part;
+    esp_partition_mmap_handle_t mmap_handle;
+#else
+    int fd;
+#endif
+} sv_store_t;
+
+
+//=========================== prototypes ===========================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 저장소를 열고 매핑합니다. 유효한 bank가 없으면 bank 0을 새로 포맷합니다.
+ * 임베딩은 복사하지 않으며, record header만 훑어 journal 끝을 찾습니다.
+ *
+ * @param name 파티션 label (host: 파일 경로)
+ * @param dim 임베딩 차원 (저장된 header와 다르면 실패)
+ * @return 저장소 포인터, 실패 시 NULL
+ */
+sv_store_t* sv_store_open(const char* name, int dim);
+
+/**
+ * @brief 매핑을 해제하고 저장소를 닫습니다.
+ */
+void sv_store_close(sv_store_t* store);
+
+/**
+ * @brief 활성 bank의 slot번째 record header를 반환합니다. (매핑된 메모리)
+ */
+const sv_store_record_t* sv_store_record(const sv_store_t* store, int slot);
+
+/**
+ * @brief 활성 bank의 slot번째 record 임베딩을 반환합니다. (매핑된 메모리, 16바이트 정렬)
+ */
+const float* sv_store_embedding(const sv_store_t* store, int slot);
+
+/**
+ * @brief 화자 등록 record를 journal 끝에 추가합니다.
+ *
+ * @param embedding 저장할 (정규화된) 임베딩 [dim]
+ * @param model_hash 임베딩을 만든 모델 (sv_model_hash, 0: 알 수 없음)
+ * @return SV_SUCCESS, 저장소가 가득 찼으면 SV_ERROR (sv_store_compact 후 재시도)
+ */
+sv_status_t sv_store_append_add(sv_store_t* store, int speaker_id, const char* name, const float* embedding,
+                                uint32_t model_hash);
+
+/**
+ * @brief 화자 삭제 record를 journal 끝에 추가합니다.
+ */
+sv_status_t sv_store_append_del(sv_store_t* store, int speaker_id);
+
+/**
+ * @brief 살아 있는 ADD record만 다른 bank에 옮겨 쓰고 활성 bank를 전환합니다.
+ * 이전 bank는 다음 compaction 전까지 그대로 유지됩니다.
+ * (전환 후 slot 번호와 매핑 주소가 바뀌므로 호출자는 DB view를 다시 만들어야 함)
+ */
+sv_status_t sv_store_compact(sv_store_t* store);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
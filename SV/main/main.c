@@ -1,4 +1,5 @@
 #include "main.h"
+#include "model_manager.h" // get_model_output_size
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h> // rand, RAND_MAX
@@ -108,13 +109,19 @@ int main() {
     printf("200ms 주기로 TFLite 추론을 시뮬레이션합니다.\n\n");
 
     // 1. 시스템 설정
-    sv_config_t my_config;
+    sv_config_t my_config = {0};
     my_config.threshold = DEFAULT_SV_SENSITIVITY;   // 임계값 (매우 높게 설정 - 시뮬레이션이므로)
     my_config.algorithm = DEFAULT_SV_ALGORITHM;   // 2회 연속 판정 알고리즘 사용
     
     // (Majority Voting 테스트 시)
     // my_config.algorithm = POST_MAJORITY_VOTING;
 
+    // (영구 저장소 사용 시: 런타임 등록 화자가 재부팅 후에도 유지됨)
+    // my_config.store_name = SV_STORE_PARTITION_LABEL;
+
+    // (모델 교체 추적 시: 현재 모델 blob의 hash, 등록 화자마다 기록됨)
+    // my_config.model_hash = sv_model_hash(model_blob, model_len);
+
     // 2. 시스템 초기화 (사전 등록된 DB 로드)
     sv_handle_t* sv_system = sv_system_init(&my_config);
     if (!sv_system) {
@@ -122,16 +129,29 @@ int main() {
         return -1;
     }
     
-    for (int i=0; i < sv_system->num_speakers; ++i) {
+    // 모델 출력 크기 확인 (model_setup() 이후, 모델 출력 tensor의 float 개수)
+    // 다른 차원의 모델을 쓰려면 my_config.embedding_dim을 모델 출력 크기로 설정
+    if (sv_system_check_model(sv_system, get_model_output_size()) != SV_SUCCESS) {
+        printf("\n[오류] 모델 출력 차원이 설정과 다릅니다!\n");
+        sv_system_deinit(sv_system);
+        return -1;
+    }
+
+    // (초기화 직후에는 다른 task가 DB를 바꾸지 않으므로 현재 snapshot을 바로 읽음)
+    const sv_db_t* db = atomic_load(&sv_system->db);
+    for (int i=0; i < db->num_speakers; ++i) {
         printf("  - 로드된 화자 ID %d: %s\n", 
-               sv_system->speakers_db[i].speaker_id,
-               sv_system->speakers_db[i].speaker_name);
+               db->speakers_db[i].speaker_id,
+               db->speakers_db[i].speaker_name);
     }
     printf("\n실시간 추론 루프 시작 (총 10 프레임, 2초 시뮬레이션):\n");
 
     // 3. (옵션) 런타임에 화자 등록
     // float runtime_emb[SV_EMBEDDING_DIM] = { ... }; // 3회 녹음 평균 임베딩
     // sv_system_register(sv_system, runtime_emb, "NewUser");
+    // (모델 교체 후 재임베딩하려면 녹음마다 모델 입력 특징을 보관)
+    // sv_system_add_features(sv_system, new_id, melspec, NUM_FRAMES, NUM_MEL_BINS);
+    // (모델 교체 후: sv_system_set_model(sv_system, new_hash) 뒤 idle task에서 sv_system_migrate_step 반복)
 
 
     // 4. 실시간 추론 루프 (200ms 주기)
@@ -147,26 +167,46 @@ int main() {
         // (B) 화자 판정 (핵심 API 호출)
         sv_result_t result = sv_system_verify(sv_system, current_embedding);
 
-        // (C) 결과 처리
+        // (C) 결과 처리 (이름은 ID로 조회: 등록/삭제가 동시에 일어나도 안전)
+        char name[SV_MAX_NAME_LEN] = "";
+        if (result.raw_speaker_id != -1) {
+            sv_system_get_speaker_name(sv_system, result.raw_speaker_id, name);
+        }
         if (result.final_speaker_id != -1) {
             // 최종 판정 성공!
             int id = result.final_speaker_id;
+            sv_system_get_speaker_name(sv_system, id, name);
             printf("\n\n==============================================\n");
             printf("[최종 판정!] 화자: %s (ID: %d), Score: %.4f\n", 
-                   sv_system->speakers_db[id].speaker_name, id, result.best_score);
+                   name, id, result.best_score);
             printf("==============================================\n\n");
         } 
         else if (result.raw_speaker_id != -1) {
             // 원시 판정 성공 (후처리 대기 중)
             printf("  (판정 중... %s, Score: %.4f)\n", 
-                   sv_system->speakers_db[result.raw_speaker_id].speaker_name,
-                   result.best_score);
+                   name, result.best_score);
         } else {
             // 원시 판정 실패 (Unknown)
              printf("  (Unknown, Score: %.4f)\n", result.best_score);
         }
     }
 
+#if SV_ENABLE_STATS
+    // (옵션) 판정 통계: threshold / 후처리 알고리즘 조정용 (-DSV_ENABLE_STATS=1 빌드)
+    sv_stats_t stats;
+    if (sv_get_stats(&stats) == SV_SUCCESS && stats.num_verify > 0) {
+        int algo = my_config.algorithm;
+        printf("\n[통계] 판정 %u회, 평균 %llu cycles (최소 %u, 최대 %u)\n", (unsigned)stats.num_verify,
+               (unsigned long long)(stats.total_cycles / stats.num_verify),
+               (unsigned)stats.min_cycles, (unsigned)stats.max_cycles);
+        if (stats.decisions[algo] > 0) {
+            printf("[통계] 최종 판정 %u회, 첫 raw 판정부터 평균 %.2f hop, 미확정 %u회\n",
+                   (unsigned)stats.decisions[algo],
+                   (double)stats.total_hops[algo] / stats.decisions[algo], (unsigned)stats.dropped[algo]);
+        }
+    }
+#endif
+
     // 5. 시스템 종료
     sv_system_deinit(sv_system);
     printf("\n\n데모 종료.\n");
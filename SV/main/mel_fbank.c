@@ -0,0 +1,123 @@
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h> // malloc, free
+#include <string.h> // memset
+#include <math.h>   // log, exp
+
+#include "mel_fbank.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#endif
+
+#define LOG_I(tag, format, ...) printf("[%s] " format "\n", tag, ##__VA_ARGS__)
+#define LOG_E(tag, format, ...) printf("[ERROR %s] " format "\n", tag, ##__VA_ARGS__)
+
+
+//=========================== variables ===========================
+static const char* TAG = MEL_FBANK_TAG;
+
+
+//=========================== prototypes ==========================
+static inline double _mel_scale(double freq);
+// filter b의 FFT bin k 가중치 (filter 밖이면 0)
+static double _weight(double mel_low, double mel_delta, int b, double freq);
+// 블록 메모리 할당 (target: 매 frame 읽으므로 내부 RAM)
+static void* _block_alloc(size_t size);
+
+
+//=========================== public ==============================
+int mel_fbank_build(mel_fbank_t* fbank, int num_filters, int fft_len, int sample_rate,
+                    float low_freq, float high_freq) {
+    if (!fbank || num_filters <= 0 || fft_len <= 0 || sample_rate <= 0 ||
+        low_freq < 0.0f || high_freq <= low_freq || high_freq > sample_rate / 2.0f) {
+        LOG_E(TAG, "Invalid filterbank parameters");
+        return -1;
+    }
+    memset(fbank, 0, sizeof(mel_fbank_t));
+
+    int num_fft_bins = fft_len / 2 + 1;
+    double mel_low = _mel_scale(low_freq);
+    double mel_delta = (_mel_scale(high_freq) - mel_low) / (num_filters + 1);
+    double bin_hz = (double)sample_rate / fft_len;
+
+    // 1. 가중치 수 (할당 크기)
+    int num_weights = 0;
+    for (int b = 0; b < num_filters; ++b) {
+        for (int k = 0; k < num_fft_bins; ++k) {
+            num_weights += (_weight(mel_low, mel_delta, b, k * bin_hz) > 0.0);
+        }
+    }
+
+    size_t size = sizeof(int32_t) * (2 * num_filters + 1) + sizeof(float) * num_weights;
+    uint8_t* block = (uint8_t*)_block_alloc(size);
+    if (!block) {
+        LOG_E(TAG, "Failed to allocate filterbank (%u bytes)", (unsigned)size);
+        return -1;
+    }
+    fbank->num_filters = num_filters;
+    fbank->num_weights = num_weights;
+    fbank->first = (int32_t*)block;
+    fbank->offset = fbank->first + num_filters;
+    fbank->weight = (float*)(fbank->offset + num_filters + 1);
+
+    // 2. filter마다 연속된 0이 아닌 가중치 (삼각 filter라 구간이 끊기지 않음)
+    int n = 0;
+    for (int b = 0; b < num_filters; ++b) {
+        fbank->first[b] = 0;
+        fbank->offset[b] = n;
+        for (int k = 0; k < num_fft_bins; ++k) {
+            double w = _weight(mel_low, mel_delta, b, k * bin_hz);
+            if (w <= 0.0) {
+                continue;
+            }
+            if (n == fbank->offset[b]) {
+                fbank->first[b] = k;
+            }
+            fbank->weight[n++] = (float)w;
+        }
+    }
+    fbank->offset[num_filters] = n;
+
+    LOG_I(TAG, "Filterbank built: %d filters, %d weights (%.0f ~ %.0f Hz, FFT %d)",
+          num_filters, num_weights, low_freq, high_freq, fft_len);
+    return 0;
+}
+
+void mel_fbank_free(mel_fbank_t* fbank) {
+    if (!fbank || !fbank->first) {
+        return;
+    }
+#ifdef ESP_PLATFORM
+    heap_caps_free(fbank->first);
+#else
+    free(fbank->first);
+#endif
+    memset(fbank, 0, sizeof(mel_fbank_t));
+}
+
+
+//=========================== private ==============================
+static inline double _mel_scale(double freq) {
+    return 1127.0 * log(1.0 + freq / 700.0);
+}
+
+static double _weight(double mel_low, double mel_delta, int b, double freq) {
+    double left = mel_low + b * mel_delta;
+    double center = left + mel_delta;
+    double right = center + mel_delta;
+    double mel = _mel_scale(freq);
+
+    if (mel <= left || mel >= right) {
+        return 0.0;
+    }
+    return (mel <= center) ? (mel - left) / mel_delta : (right - mel) / mel_delta;
+}
+
+static void* _block_alloc(size_t size) {
+#ifdef ESP_PLATFORM
+    return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+    return malloc(size);
+#endif
+}
@@ -1,34 +1,73 @@
 #include "melspec.h"
 #include "melspec_filters.h"
-#include "esp_log.h"
+#include "mel_fbank.h"
 #include <stdio.h>
 #include <math.h>
 #include <stdlib.h>
 #include <sys/time.h>
+#ifdef ESP_PLATFORM
+#include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
 #include "esp_system.h"
+#else
+// host 빌드 (host/melspec_q15_report): esp-dsp FFT는 아래 _host_fft_* 로 대체
+#define ESP_LOGI(tag, format, ...) printf("[%s] " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGE(tag, format, ...) printf("[ERROR %s] " format "\n", tag, ##__VA_ARGS__)
+#endif
 
 
 #define EPSILON 1e-12
+#define LOG2_TABLE_BITS 8   // Q15 경로 log2 table: 가수 상위 8비트로 찾고 다음 8비트로 선형 보간
+#define FUSED_MAX_SLOTS 2   // fused kernel: FFT bin 하나가 기여하는 최대 mel filter 수 (삼각 filter는 2)
 const float window_func[FRAME_LEN] = WINDOW_FUNC;
-const int32_t fbank_filter_first[NUM_FBANK_BINS] = FBANK_FILTER_FIRST;
-const int32_t fbank_filter_last[NUM_FBANK_BINS] = FBANK_FILTER_LAST;
-const float mel_fbank[NUM_FBANK_BINS][14] = MEL_FBANK;
+// mel filterbank (CSR, melspec_init 때 MELSPEC_LOW_FREQ ~ MELSPEC_HIGH_FREQ로 생성)
+static mel_fbank_t fbank;
 const float twiddleCoef_rfft_512[FFT_LEN] = TWIDDLECOEF_RFFT_512;
 
 float frame[FRAME_LEN_PADDED] __attribute__((section(".ext_ram.bss")));
 float s_buffer[FRAME_LEN_PADDED] __attribute__((section(".ext_ram.bss")));
 float mel_energies[NUM_FBANK_BINS] __attribute__((section(".ext_ram.bss")));
 
-static inline float InverseMelScale(float mel_freq) {
-    return 700.0f * (expf(mel_freq / 1127.0f) - 1.0f);
-}
+// batch: 연속 두 frame을 실수/허수부에 담은 FFT_LEN 점 complex FFT 버퍼와 두 번째 frame의 magnitude
+float pair_buffer[FFT_LEN * 2] __attribute__((section(".ext_ram.bss")));
+float pair_mag[NUM_SPECTROGRAM_BINS] __attribute__((section(".ext_ram.bss")));
 
-static inline float MelScale(float freq) {
-    return 1127.0f * logf(1.0f + freq / 700.0f);
-}
+// fused kernel: 작업 버퍼와 bin별 mel 기여 table (매 frame 전체를 읽으므로 PSRAM이 아닌 내부 RAM)
+// fused_mel[k][s] < 0이면 빈 slot, power slot(fused_power[mel])의 가중치는 제곱, 실수 분리의 1/2도 가중치에 포함
+float fused_window[FRAME_LEN];                       // window / 32768 (변환 + window를 곱 한 번으로)
+float fused_frame[FFT_LEN];
+float fused_mel_energies[NUM_FBANK_BINS];
+int16_t fused_mel[NUM_SPECTROGRAM_BINS][FUSED_MAX_SLOTS];
+float fused_weight[NUM_SPECTROGRAM_BINS][FUSED_MAX_SLOTS];
+uint8_t fused_power[NUM_FBANK_BINS];                 // 1: power 영역 누산 후 0.5·log
+uint8_t fused_need_sqrt[NUM_SPECTROGRAM_BINS];       // magnitude slot이 있는 bin만 sqrtf
+int32_t fused_first_bin = 0, fused_last_bin = -1;    // mel에 쓰이는 FFT bin 범위
+int fused_ready = 0;                                 // table 생성 실패(slot 초과) 시 0 → 단계별 경로 사용
+
+// Q15 경로: float table에서 melspec_init 때 생성하는 정수 table과 작업 버퍼 (작으므로 내부 RAM)
+int16_t window_q15[FRAME_LEN];
+int16_t twiddle_q15[FFT_LEN];
+int16_t fft_w_q15[FFT_LEN];                        // Q15 FFT twiddle (esp-dsp와 같이 bit-reverse 순서)
+uint16_t mel_weight_q15[2 * NUM_SPECTROGRAM_BINS]; // fbank.weight * 32768 (1.0 = 32768)
+int32_t log2_table[(1 << LOG2_TABLE_BITS) + 1];    // log2(1 + i / 256), Q16
+int16_t frame_q15[FRAME_LEN_PADDED];               // FFT 입력/출력 (complex FFT_LEN / 2 개)
+int32_t spec_i32[FRAME_LEN_PADDED];                // real spectrum (stage_rfft_f32와 같은 배치와 스케일)
+uint32_t mag_q8[NUM_SPECTROGRAM_BINS];             // magnitude, Q8
+
+#ifndef ESP_PLATFORM
+// host FFT twiddle (esp-dsp와 같이 bit-reverse 순서로 저장)
+float host_w_fc32[FFT_LEN];
+#endif
+
+// 스트리밍: 계산된 frame ring과 다음 frame을 만들 오디오
+// (두 frame 분량이 모이면 batch로 함께 계산, push가 끝났을 때 한 frame만 완성되었으면 그 frame만 계산)
+float stream_frames[NUM_FRAMES][NUM_FBANK_BINS] __attribute__((section(".ext_ram.bss")));
+int16_t stream_audio[FRAME_LEN + FRAME_STEP];
+int stream_audio_len = 0;  // stream_audio에 모인 샘플 수
+int stream_head = 0;       // 다음 frame을 쓸 ring 위치
+int stream_count = 0;      // ring의 유효 frame 수 (최대 NUM_FRAMES)
 
 static void stage_rfft_f32(float *p, float *pOut)
 {
@@ -86,7 +125,336 @@ static void stage_rfft_f32(float *p, float *pOut)
     } while (k > 0u);
 }
 
+// FFT 출력 / twiddle 순서 복원 (esp-dsp dsps_bit_rev_*와 같음)
+static void _bit_rev_sc16(int16_t *data, int n) {
+    for (int i = 1, j = 0; i < n; i++) {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            int16_t re = data[i * 2], im = data[i * 2 + 1];
+            data[i * 2] = data[j * 2];
+            data[i * 2 + 1] = data[j * 2 + 1];
+            data[j * 2] = re;
+            data[j * 2 + 1] = im;
+        }
+    }
+}
+
+#ifndef ESP_PLATFORM
+static void _bit_rev_fc32(float *data, int n) {
+    for (int i = 1, j = 0; i < n; i++) {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            float re = data[i * 2], im = data[i * 2 + 1];
+            data[i * 2] = data[j * 2];
+            data[i * 2 + 1] = data[j * 2 + 1];
+            data[j * 2] = re;
+            data[j * 2 + 1] = im;
+        }
+    }
+}
+
+// esp-dsp dsps_fft2r_*_ansi와 같은 radix-2 DIF (twiddle은 bit-reverse 순서, 출력도 bit-reverse 순서)
+static void _host_fft_init(void) {
+    for (int i = 0; i < FFT_LEN / 2; i++) {
+        double angle = 2.0 * M_PI * i / FFT_LEN;
+        host_w_fc32[i * 2] = (float)cos(angle);
+        host_w_fc32[i * 2 + 1] = (float)sin(angle);
+    }
+    _bit_rev_fc32(host_w_fc32, FFT_LEN / 2);
+}
+
+static void _host_fft_fc32(float *data, int n) {
+    int ie = 1;
+    for (int n2 = n / 2; n2 > 0; n2 >>= 1) {
+        int ia = 0;
+        for (int j = 0; j < ie; j++) {
+            float c = host_w_fc32[j * 2], s = host_w_fc32[j * 2 + 1];
+            for (int i = 0; i < n2; i++, ia++) {
+                int m = ia + n2;
+                float re_temp = c * data[m * 2] + s * data[m * 2 + 1];
+                float im_temp = c * data[m * 2 + 1] - s * data[m * 2];
+                data[m * 2] = data[ia * 2] - re_temp;
+                data[m * 2 + 1] = data[ia * 2 + 1] - im_temp;
+                data[ia * 2] += re_temp;
+                data[ia * 2 + 1] += im_temp;
+            }
+            ia += n2;
+        }
+        ie <<= 1;
+    }
+}
+#endif
+
+// n 점 complex FFT (n <= FFT_LEN, 출력은 자연 순서)
+static void _fft_fc32(float *data, int n) {
+#ifdef ESP_PLATFORM
+    dsps_fft2r_fc32(data, n);
+    dsps_bit_rev_fc32(data, n);
+#else
+    _host_fft_fc32(data, n);
+    _bit_rev_fc32(data, n);
+#endif
+}
+
+/*
+ * FFT_LEN / 2 점 complex Q15 FFT (출력은 자연 순서), 반환: 전체 shift (결과 = FFT / 2^shift)
+ * dsps_fft2r_sc16과 같은 radix-2 DIF이지만 stage마다 1/2로 고정하지 않고 block floating point로 내림
+ *   butterfly 출력 성분은 (1 + √2)·M 이하 (M: stage 입력 최대 성분)이므로
+ *   이 bound가 int16에 남는 최소 shift(0~2)만 반올림하여 적용
+ *   (입력은 Q15, 곱은 1비트 내려 Q29로 더하므로 int32 중간값이 넘치지 않음)
+ * 고정 1/2 scaling은 256점에서 8비트를 잃어 배음 사이 골짜기(peak 대비 -60 dB 부근)가
+ * 양자화 잡음에 묻히지만, 신호가 stage마다 2배씩 자라지 않는 한 내릴 비트가 그보다 적습니다.
+ */
+static int32_t _fft_q15(int16_t *data) {
+    const int n = FFT_LEN / 2;
+    int32_t total = 0, peak = 0;
+    int i;
+
+    for (i = 0; i < n * 2; i++) {
+        int32_t v = data[i] < 0 ? -data[i] : data[i];
+        if (v > peak) {
+            peak = v;
+        }
+    }
+
+    int ie = 1;
+    for (int n2 = n / 2; n2 > 0; n2 >>= 1) {
+        int32_t bound = peak + ((peak * 46341) >> 15);  // (1 + √2)·M, 46341 / 2^15 ≈ √2
+        int32_t s = 0;
+        while ((bound >> s) >= INT16_MAX) {
+            s++;
+        }
+        const int32_t q = 14 + s;
+        const int32_t half = 1 << (q - 1);
+        int ia = 0;
+
+        peak = 0;
+        for (int j = 0; j < ie; j++) {
+            int32_t c = fft_w_q15[j * 2], sn = fft_w_q15[j * 2 + 1];
+            for (i = 0; i < n2; i++, ia++) {
+                int m = ia + n2;
+                int32_t re_temp = (c * data[m * 2] + sn * data[m * 2 + 1]) >> 1;
+                int32_t im_temp = (c * data[m * 2 + 1] - sn * data[m * 2]) >> 1;
+                int32_t a_re = data[ia * 2] * (1 << 14) + half, a_im = data[ia * 2 + 1] * (1 << 14) + half;
+                int32_t v[4] = {(a_re - re_temp) >> q, (a_im - im_temp) >> q,
+                                (a_re + re_temp) >> q, (a_im + im_temp) >> q};
+                data[m * 2] = (int16_t)v[0];
+                data[m * 2 + 1] = (int16_t)v[1];
+                data[ia * 2] = (int16_t)v[2];
+                data[ia * 2 + 1] = (int16_t)v[3];
+                for (int k = 0; k < 4; k++) {
+                    int32_t av = v[k] < 0 ? -v[k] : v[k];
+                    if (av > peak) {
+                        peak = av;
+                    }
+                }
+            }
+            ia += n2;
+        }
+        total += s;
+        ie <<= 1;
+    }
+    _bit_rev_sc16(data, n);
+    return total;
+}
+
+// Q15 경로 table 생성 (float table과 같은 값을 정수로)
+static void _init_q15_tables(void) {
+    int i;
+
+    for (i = 0; i < FRAME_LEN; i++) {
+        window_q15[i] = (int16_t)lrintf(window_func[i] * INT16_MAX);
+    }
+    for (i = 0; i < FFT_LEN; i++) {
+        twiddle_q15[i] = (int16_t)lrintf(twiddleCoef_rfft_512[i] * INT16_MAX);
+    }
+    for (i = 0; i < FFT_LEN / 2; i++) {
+        double angle = 2.0 * M_PI * i / FFT_LEN;
+        fft_w_q15[i * 2] = (int16_t)lrint(cos(angle) * INT16_MAX);
+        fft_w_q15[i * 2 + 1] = (int16_t)lrint(sin(angle) * INT16_MAX);
+    }
+    _bit_rev_sc16(fft_w_q15, FFT_LEN / 2);
+    for (i = 0; i < fbank.num_weights; i++) {
+        mel_weight_q15[i] = (uint16_t)lrintf(fbank.weight[i] * 32768.0f);
+    }
+    for (i = 0; i <= (1 << LOG2_TABLE_BITS); i++) {
+        log2_table[i] = (int32_t)lrint(log2(1.0 + (double)i / (1 << LOG2_TABLE_BITS)) * 65536.0);
+    }
+}
+
+// magnitude spectrum [NUM_SPECTROGRAM_BINS] → log-mel [NUM_FBANK_BINS]
+static void _mel_log_f32(const float *magnitude, float *freq_data) {
+    int32_t i, j, bin;
+
+    // 7. Mel filterbank 적용 (filter마다 연속된 가중치만)
+    for (bin = 0; bin < NUM_FBANK_BINS; bin++) {
+        float mel_energy = 0.0f;
+        const float *spectrum = &magnitude[fbank.first[bin]];
+        
+        for (i = fbank.offset[bin], j = 0; i < fbank.offset[bin + 1]; i++, j++) {
+            mel_energy += spectrum[j] * fbank.weight[i];
+        }
+        mel_energies[bin] = mel_energy;
+    }
+
+    // 8. Log 적용
+    for (bin = 0; bin < NUM_FBANK_BINS; bin++) {
+        freq_data[bin] = logf(mel_energies[bin] + EPSILON);  // ✅ FLT_MIN 대신 EPSILON
+    }
+}
+
+#if !MELSPEC_FIXED_POINT
+/*
+ * 연속 두 frame (a = audio_data, b = audio_data + FRAME_STEP)을 FFT 한 번으로 계산
+ *   z = a + j*b 의 FFT_LEN 점 complex FFT Z에서
+ *   A[k] = (Z[k] + conj(Z[N-k])) / 2,  B[k] = (Z[k] - conj(Z[N-k])) / 2j
+ * 분리에는 twiddle 곱이 없으므로 frame마다 하던 stage_rfft_f32의 복소 곱셈이 빠지고,
+ * FFT 호출/bit-reverse도 두 frame에 한 번입니다.
+ */
+static void _compute_pair_f32(const int16_t *audio_data, float *freq_data) {
+    const int16_t *second = &audio_data[FRAME_STEP];
+    int32_t i;
+
+    // 1~3. 변환 + zero padding + Hann window (a: 실수부, b: 허수부)
+    for (i = 0; i < FRAME_LEN; i++) {
+        pair_buffer[i * 2] = (float)audio_data[i] * window_func[i] / 32768.0f;
+        pair_buffer[i * 2 + 1] = (float)second[i] * window_func[i] / 32768.0f;
+    }
+    memset(&pair_buffer[FRAME_LEN * 2], 0, sizeof(float) * 2 * (FFT_LEN - FRAME_LEN));
+
+    // 4. FFT
+    _fft_fc32(pair_buffer, FFT_LEN);
+
+    // 5, 6. 두 spectrum 분리 + magnitude (s_buffer: a, pair_mag: b)
+    for (i = 0; i <= FFT_LEN / 2; i++) {
+        int32_t m = (FFT_LEN - i) & (FFT_LEN - 1);
+        float zr = pair_buffer[i * 2], zi = pair_buffer[i * 2 + 1];
+        float mr = pair_buffer[m * 2], mi = pair_buffer[m * 2 + 1];
+        float ar = zr + mr, ai = zi - mi;
+        float br = zi + mi, bi = mr - zr;
+        s_buffer[i] = 0.5f * sqrtf(ar * ar + ai * ai);
+        pair_mag[i] = 0.5f * sqrtf(br * br + bi * bi);
+    }
+
+    // 7, 8. Mel filterbank + Log
+    _mel_log_f32(s_buffer, freq_data);
+    _mel_log_f32(pair_mag, &freq_data[NUM_FBANK_BINS]);
+}
+#endif
+
+// stage_rfft_f32의 Q15 버전 (같은 0.5 스케일, 출력은 int16을 넘을 수 있어 int32로 반올림)
+static void _stage_rfft_q15(const int16_t *p, int32_t *out) {
+    const int16_t *coef = twiddle_q15;
+    int32_t k;
+
+    out[0] = (int32_t)p[0] + p[1];
+    out[1] = (int32_t)p[0] - p[1];
+
+    for (k = 1; k < FFT_LEN / 2; k++) {
+        const int16_t *a = &p[k * 2];
+        const int16_t *b = &p[(FFT_LEN / 2 - k) * 2];
+        int32_t twR = coef[k * 2], twI = coef[k * 2 + 1];
+        int32_t t1a = (int32_t)b[0] - a[0];
+        int32_t t1b = (int32_t)b[1] + a[1];
+
+        // 합이 int32를 넘지 않도록 Q13으로 더함 (입력 성분 |z| < 2^15, 곱은 2비트 내림)
+        int32_t re = ((int32_t)a[0] + b[0]) * (1 << 13) + ((twR * t1a) >> 2) + ((twI * t1b) >> 2);
+        int32_t im = ((int32_t)a[1] - b[1]) * (1 << 13) + ((twI * t1a) >> 2) - ((twR * t1b) >> 2);
+        out[k * 2] = (re + (1 << 13)) >> 14;
+        out[k * 2 + 1] = (im + (1 << 13)) >> 14;
+    }
+}
+
+// 정수 제곱근 (x >= 2^30이면 결과는 [2^15, 2^16))
+static inline uint32_t _isqrt32(uint32_t x) {
+    uint32_t res = 0;
+    uint32_t bit = 1u << 30;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+// log2(x), Q16 (x > 0): 지수는 최상위 비트 위치, 가수는 table + 선형 보간
+static inline int32_t _log2_q16(uint64_t x) {
+    int msb = 63 - __builtin_clzll(x);
+    uint64_t m = x << (63 - msb);     // 최상위 비트를 bit 63으로
+    int idx = (int)(m >> (63 - LOG2_TABLE_BITS)) & ((1 << LOG2_TABLE_BITS) - 1);
+    int32_t frac = (int32_t)(m >> (63 - 2 * LOG2_TABLE_BITS)) & ((1 << LOG2_TABLE_BITS) - 1);
+    int32_t lo = log2_table[idx];
+
+    return (msb << 16) + lo + (((log2_table[idx + 1] - lo) * frac) >> LOG2_TABLE_BITS);
+}
+
+// fused kernel table 생성 (mel filter를 FFT bin 기준으로 뒤집어 bin마다 기여할 filter/가중치를 둠)
+static int _init_fused_tables(void) {
+    int32_t i, j, bin, slot;
+
+    for (i = 0; i < FRAME_LEN; i++) {
+        fused_window[i] = window_func[i] / 32768.0f;
+    }
+
+    for (bin = 0; bin < NUM_FBANK_BINS; bin++) {
+        int nonzero = fbank.offset[bin + 1] - fbank.offset[bin];
+        fused_power[bin] = (MELSPEC_FUSED_POWER_MEL || nonzero == 1);
+    }
+
+    for (i = 0; i < NUM_SPECTROGRAM_BINS; i++) {
+        for (slot = 0; slot < FUSED_MAX_SLOTS; slot++) {
+            fused_mel[i][slot] = -1;
+            fused_weight[i][slot] = 0.0f;
+        }
+        fused_need_sqrt[i] = 0;
+    }
+    fused_first_bin = NUM_SPECTROGRAM_BINS;
+    fused_last_bin = -1;
+
+    for (bin = 0; bin < NUM_FBANK_BINS; bin++) {
+        for (j = fbank.offset[bin]; j < fbank.offset[bin + 1]; j++) {
+            float w = fbank.weight[j];
+            i = fbank.first[bin] + (j - fbank.offset[bin]);
+            for (slot = 0; slot < FUSED_MAX_SLOTS && fused_mel[i][slot] >= 0; slot++) {
+            }
+            if (slot == FUSED_MAX_SLOTS) {
+                ESP_LOGE("melspec", "FFT bin %d feeds more than %d mel filters, fused kernel disabled",
+                         (int)i, FUSED_MAX_SLOTS);
+                return -1;
+            }
+            // 실수 분리의 0.5 (power는 0.25)를 가중치에 포함
+            fused_mel[i][slot] = (int16_t)bin;
+            fused_weight[i][slot] = fused_power[bin] ? 0.25f * w * w : 0.5f * w;
+            fused_need_sqrt[i] |= !fused_power[bin];
+            if (i < fused_first_bin) {
+                fused_first_bin = i;
+            }
+            if (i > fused_last_bin) {
+                fused_last_bin = i;
+            }
+        }
+    }
+    return 0;
+}
+
 int melspec_init(void) {  // 수정
+#ifdef ESP_PLATFORM
     esp_err_t ret;
     
     ret = dsps_fft2r_init_fc32(NULL, FFT_LEN);  // 수정
@@ -94,14 +462,27 @@ int melspec_init(void) {  // 수정
         ESP_LOGE("melspec", "FFT initialization failed. Error = %d", ret);
         return -1;
     }
+#else
+    _host_fft_init();
+#endif
+    if (mel_fbank_build(&fbank, NUM_FBANK_BINS, FFT_LEN, SAMPLE_RATE, MELSPEC_LOW_FREQ, MELSPEC_HIGH_FREQ) != 0) {
+        ESP_LOGE("melspec", "mel filterbank initialization failed");
+        melspec_deinit();
+        return -1;
+    }
+    _init_q15_tables();
+    fused_ready = (_init_fused_tables() == 0);
     
-    ESP_LOGI("melspec", "melspec initialized: FRAME_LEN=%d, FFT_LEN=%d, NUM_FBANK_BINS=%d", 
-             FRAME_LEN, FFT_LEN, NUM_FBANK_BINS);
+    ESP_LOGI("melspec", "melspec initialized: FRAME_LEN=%d, FFT_LEN=%d, NUM_FBANK_BINS=%d, fixed point=%d", 
+             FRAME_LEN, FFT_LEN, NUM_FBANK_BINS, MELSPEC_FIXED_POINT);
     return 0;
 }
 
 void melspec_deinit(void) {
+#ifdef ESP_PLATFORM
     dsps_fft2r_deinit_fc32();
+#endif
+    mel_fbank_free(&fbank);
 }
 
 // Global normalization
@@ -127,7 +508,17 @@ void normalize(float *melSpectrogram, int num_frames) {
 }
 
 void melspec_compute(const int16_t *audio_data, float *freq_data) {
-    int32_t i, j, bin;
+#if MELSPEC_FIXED_POINT
+    melspec_compute_q15(audio_data, freq_data);
+#elif MELSPEC_FUSED
+    melspec_compute_fused(audio_data, freq_data);
+#else
+    melspec_compute_f32(audio_data, freq_data);
+#endif
+}
+
+void melspec_compute_f32(const int16_t *audio_data, float *freq_data) {
+    int32_t i;
 
     // 1. Int16 → Float 변환
     for (i = 0; i < FRAME_LEN; i++) {
@@ -143,8 +534,7 @@ void melspec_compute(const int16_t *audio_data, float *freq_data) {
     }
     
     // 4. FFT
-    dsps_fft2r_fc32(frame, FRAME_LEN_PADDED / 2);
-    dsps_bit_rev_fc32(frame, FRAME_LEN_PADDED / 2);
+    _fft_fc32(frame, FRAME_LEN_PADDED / 2);
     stage_rfft_f32(frame, s_buffer);
 
     // 5. Power spectrum
@@ -152,7 +542,7 @@ void melspec_compute(const int16_t *audio_data, float *freq_data) {
     float first_energy = s_buffer[0] * s_buffer[0];
     float last_energy = s_buffer[1] * s_buffer[1];
     
-    for (i = 1; i < half_dim+1; i++) {
+    for (i = 1; i < half_dim; i++) {
         float real = s_buffer[i * 2];
         float im = s_buffer[i * 2 + 1];
         s_buffer[i] = real * real + im * im;
@@ -165,21 +555,252 @@ void melspec_compute(const int16_t *audio_data, float *freq_data) {
         s_buffer[i] = sqrtf(s_buffer[i]);
     }
 
-    // 7. Mel filterbank 적용
+    // 7, 8. Mel filterbank + Log
+    _mel_log_f32(s_buffer, freq_data);
+}
+
+/*
+ * 단일 pass float kernel (melspec_compute_f32와 같은 결과, MELSPEC_FUSED_POWER_MEL=0 기준)
+ *   1. int16 → float 변환과 window를 곱 한 번으로 (zero padding은 FRAME_LEN < FFT_LEN일 때만)
+ *   2. FFT (in-place)
+ *   3. mel에 쓰이는 bin만: stage_rfft_f32의 실수 분리 → power → (필요하면) sqrtf → 최대 2개 mel에 바로 누산
+ *      (s_buffer 왕복과 power/magnitude/mel 단계별 pass가 없음)
+ *   4. log (power 영역 filter는 0.5·log)
+ * 작업 버퍼와 table은 모두 내부 RAM에 있어, 단계마다 PSRAM을 다시 읽지 않습니다.
+ */
+void melspec_compute_fused(const int16_t *audio_data, float *freq_data) {
+    int32_t i, bin;
+
+    if (!fused_ready) {
+        melspec_compute_f32(audio_data, freq_data);
+        return;
+    }
+
+    // 1. 변환 + window
+    for (i = 0; i < FRAME_LEN; i++) {
+        fused_frame[i] = (float)audio_data[i] * fused_window[i];
+    }
+    if (FRAME_LEN < FFT_LEN) {
+        memset(&fused_frame[FRAME_LEN], 0, sizeof(float) * (FFT_LEN - FRAME_LEN));
+    }
+
+    // 2. FFT
+    _fft_fc32(fused_frame, FFT_LEN / 2);
+
+    // 3. 실수 분리 + power + magnitude + mel (bin k는 Z[k]와 Z[N/2 - k]만 사용)
+    memset(fused_mel_energies, 0, sizeof(fused_mel_energies));
+    const float *coef = twiddleCoef_rfft_512;
+    for (i = fused_first_bin; i <= fused_last_bin; i++) {
+        float re, im;
+        if (i == 0 || i == FFT_LEN / 2) {
+            // DC / Nyquist: 2 * (Z0.re ± Z0.im) (가중치의 1/2과 맞춤)
+            re = 2.0f * ((i == 0) ? (fused_frame[0] + fused_frame[1]) : (fused_frame[0] - fused_frame[1]));
+            im = 0.0f;
+        } else {
+            const float *a = &fused_frame[i * 2];
+            const float *b = &fused_frame[(FFT_LEN / 2 - i) * 2];
+            float twR = coef[i * 2], twI = coef[i * 2 + 1];
+            float t1a = b[0] - a[0];
+            float t1b = b[1] + a[1];
+            re = a[0] + b[0] + twR * t1a + twI * t1b;
+            im = a[1] - b[1] + twI * t1a - twR * t1b;
+        }
+
+        float power = re * re + im * im;
+        float magnitude = fused_need_sqrt[i] ? sqrtf(power) : 0.0f;
+        for (int slot = 0; slot < FUSED_MAX_SLOTS; slot++) {
+            int32_t m = fused_mel[i][slot];
+            if (m < 0) {
+                break;
+            }
+            fused_mel_energies[m] += fused_weight[i][slot] * (fused_power[m] ? power : magnitude);
+        }
+    }
+
+    // 4. Log
     for (bin = 0; bin < NUM_FBANK_BINS; bin++) {
-        float mel_energy = 0.0f;
-        int32_t first_index = fbank_filter_first[bin];
-        int32_t last_index = fbank_filter_last[bin];
-        
-        j = 0;
-        for (i = first_index; i <= last_index; i++) {
-            mel_energy += s_buffer[i] * mel_fbank[bin][j++];
+        freq_data[bin] = fused_power[bin] ? 0.5f * logf(fused_mel_energies[bin] + EPSILON * EPSILON)
+                                          : logf(fused_mel_energies[bin] + EPSILON);
+    }
+}
+
+void melspec_compute_batch(const int16_t *audio_data, int num_frames, float *freq_data) {
+    int f = 0;
+
+#if MELSPEC_FIXED_POINT
+    // Q15 경로는 frame마다 block scaling이 달라 묶지 않음
+    for (; f < num_frames; f++) {
+        melspec_compute_q15(&audio_data[f * FRAME_STEP], &freq_data[f * NUM_FBANK_BINS]);
+    }
+#else
+    for (; f + 2 <= num_frames; f += 2) {
+        _compute_pair_f32(&audio_data[f * FRAME_STEP], &freq_data[f * NUM_FBANK_BINS]);
+    }
+    if (f < num_frames) {
+        melspec_compute(&audio_data[f * FRAME_STEP], &freq_data[f * NUM_FBANK_BINS]);
+    }
+#endif
+}
+
+/*
+ * Q15 고정소수점 경로 (float 경로와 같은 단계, 스케일은 모두 2의 거듭제곱으로 추적)
+ *   창 적용 x * w            : Q30 (int32), block scaling(반올림)으로 최대값을 [2^14, 2^15)로 맞춤
+ *   int16 FFT (stage별 shift) : FFT(x) * 2^(30 - shift - fft_shift)
+ *   실수 분리 단계 (0.5)      : X * 2^(30 - shift - fft_shift), int32, power는 uint64
+ *   magnitude (정규화 isqrt)  : |X| * 2^(38 - shift - fft_shift), Q8 정밀도
+ *   mel 누산 (Q15 가중치)     : mel * 2^(53 - shift - fft_shift), uint64
+ * log 결과만 float로 변환하여 melspec_compute와 같은 출력 형식을 유지합니다.
+ * float 경로(직접 DFT와 같음) 대비 오차는 host/melspec_q15_report로 측정합니다.
+ */
+void melspec_compute_q15(const int16_t *audio_data, float *freq_data) {
+    int32_t i, j, bin;
+
+    // 1. DC 제거 + Q15 window + block scaling (조용한 frame도 FFT 입력의 유효 비트를 유지)
+    //    DC는 window 후 bin 0, 1에만 남아 mel(MELSPEC_LOW_FREQ 이상)에 쓰이지 않지만,
+    //    그대로 두면 마이크 offset이 block scaling의 peak를 차지해 음성 bin의 비트를 잃음
+    int32_t sum = 0;
+    for (i = 0; i < FRAME_LEN; i++) {
+        sum += audio_data[i];
+    }
+    const int32_t dc = sum / FRAME_LEN;
+    int32_t peak = 0;
+    for (i = 0; i < FRAME_LEN; i++) {
+        int32_t v = ((int32_t)audio_data[i] - dc) * window_q15[i];
+        if (v < 0) {
+            v = -v;
         }
-        mel_energies[bin] = mel_energy;
+        if (v > peak) {
+            peak = v;
+        }
+    }
+    if (peak == 0) {
+        for (bin = 0; bin < NUM_FBANK_BINS; bin++) {
+            freq_data[bin] = logf(EPSILON);
+        }
+        return;
+    }
+    int32_t shift = (32 - __builtin_clz((uint32_t)peak)) - 15;  // 양수: 오른쪽, 음수: 왼쪽
+    if (shift > 0 && ((peak + (1 << (shift - 1))) >> shift) > INT16_MAX) {
+        shift++;  // 반올림하면 2^15가 되는 경우
     }
+    if (shift > 0) {
+        const int32_t half = 1 << (shift - 1);
+        for (i = 0; i < FRAME_LEN; i++) {
+            frame_q15[i] = (int16_t)((((int32_t)audio_data[i] - dc) * window_q15[i] + half) >> shift);
+        }
+    } else {
+        for (i = 0; i < FRAME_LEN; i++) {
+            frame_q15[i] = (int16_t)(((int32_t)audio_data[i] - dc) * window_q15[i] * (1 << -shift));
+        }
+    }
+    memset(&frame_q15[FRAME_LEN], 0, sizeof(int16_t) * (FRAME_LEN_PADDED - FRAME_LEN));
 
-    // 8. Log 적용
+    // 2. int16 FFT (block floating point) + 실수 spectrum 분리
+    int32_t fft_shift = _fft_q15(frame_q15);
+    _stage_rfft_q15(frame_q15, spec_i32);
+
+    // 3. Power(uint64, 성분 < 2^18) → magnitude(Q8): 최상위 비트를 맞춘 상위 32비트를 isqrt하여 작은 bin도 16비트 정밀도
+    int32_t half_dim = FRAME_LEN_PADDED / 2;
+    for (i = 0; i <= half_dim; i++) {
+        uint64_t power;
+        if (i == 0) {
+            power = (uint64_t)((int64_t)spec_i32[0] * spec_i32[0]);
+        } else if (i == half_dim) {
+            power = (uint64_t)((int64_t)spec_i32[1] * spec_i32[1]);
+        } else {
+            int64_t re = spec_i32[i * 2], im = spec_i32[i * 2 + 1];
+            power = (uint64_t)(re * re + im * im);
+        }
+        if (power == 0) {
+            mag_q8[i] = 1 << 7;
+            continue;
+        }
+        // root = |X| * 2^(norm - 16), power < 2^37이므로 norm >= 13
+        int32_t norm = __builtin_clzll(power) & ~1;
+        uint32_t root = _isqrt32((uint32_t)((power << norm) >> 32));
+        norm >>= 1;
+        mag_q8[i] = (norm <= 24) ? (root << (24 - norm)) : (root >> (norm - 24));
+    }
+
+    // 4. Mel filterbank (Q15 가중치, 64비트 누산) + table log2
+    const float ln2_q16 = 0.69314718f / 65536.0f;
+    const int32_t scale_q16 = (53 - shift - fft_shift) << 16;
     for (bin = 0; bin < NUM_FBANK_BINS; bin++) {
-        freq_data[bin] = logf(mel_energies[bin] + EPSILON);  // ✅ FLT_MIN 대신 EPSILON
+        uint64_t mel_energy = 0;
+        const uint32_t *spectrum = &mag_q8[fbank.first[bin]];
+
+        for (i = fbank.offset[bin], j = 0; i < fbank.offset[bin + 1]; i++, j++) {
+            mel_energy += (uint64_t)spectrum[j] * mel_weight_q15[i];
+        }
+        freq_data[bin] = (mel_energy == 0) ? logf(EPSILON)
+                                           : (float)(_log2_q16(mel_energy) - scale_q16) * ln2_q16;
     }
-}
\ No newline at end of file
+}
+
+void melspec_stream_reset(void) {
+    stream_audio_len = 0;
+    stream_head = 0;
+    stream_count = 0;
+}
+
+int melspec_stream_push(const int16_t *samples, int num_samples) {
+    int computed = 0;
+
+    while (num_samples > 0) {
+        int n = (FRAME_LEN + FRAME_STEP) - stream_audio_len;
+        if (n > num_samples) {
+            n = num_samples;
+        }
+        memcpy(&stream_audio[stream_audio_len], samples, sizeof(int16_t) * n);
+        stream_audio_len += n;
+        samples += n;
+        num_samples -= n;
+        if (stream_audio_len < FRAME_LEN) {
+            break;
+        }
+
+        // 완성된 frame만 계산 (이전 frame은 ring에 그대로 남음)
+        // 두 frame이 ring에서 연속이면 batch 한 번, 아니면 frame마다
+        int ready = (stream_audio_len - FRAME_LEN) / FRAME_STEP + 1;
+        if (ready == 2 && stream_head + 1 < NUM_FRAMES) {
+            melspec_compute_batch(stream_audio, 2, stream_frames[stream_head]);
+        } else {
+            for (int f = 0; f < ready; f++) {
+                melspec_compute(&stream_audio[f * FRAME_STEP], stream_frames[(stream_head + f) % NUM_FRAMES]);
+            }
+        }
+        stream_head = (stream_head + ready) % NUM_FRAMES;
+        stream_count += ready;
+        if (stream_count > NUM_FRAMES) {
+            stream_count = NUM_FRAMES;
+        }
+        computed += ready;
+
+        // 다음 frame과 겹치는 샘플만 남김
+        stream_audio_len -= ready * FRAME_STEP;
+        memmove(stream_audio, &stream_audio[ready * FRAME_STEP], sizeof(int16_t) * stream_audio_len);
+    }
+    return computed;
+}
+
+melspec_window_t melspec_stream_window(void) {
+    melspec_window_t window;
+    int oldest = (stream_head - stream_count + NUM_FRAMES) % NUM_FRAMES;
+    int tail = NUM_FRAMES - oldest;
+
+    window.first = stream_frames[oldest];
+    window.first_frames = (stream_count < tail) ? stream_count : tail;
+    window.second_frames = stream_count - window.first_frames;
+    window.second = (window.second_frames > 0) ? stream_frames[0] : NULL;
+    return window;
+}
+
+int melspec_stream_copy(float *out) {
+    melspec_window_t window = melspec_stream_window();
+    memcpy(out, window.first, sizeof(float) * window.first_frames * NUM_FBANK_BINS);
+    if (window.second_frames > 0) {
+        memcpy(&out[window.first_frames * NUM_FBANK_BINS], window.second,
+               sizeof(float) * window.second_frames * NUM_FBANK_BINS);
+    }
+    return window.first_frames + window.second_frames;
+}
@@ -1,4 +1,5 @@
 #include "mfcc.h"
+#include "mel_fbank.h"
 #include "esp_log.h"
 #include <stdio.h>
 #include <math.h>
@@ -11,9 +12,7 @@
 
 #define EPSILON 1e-12
 const float window_func[FRAME_LEN] = WINDOW_FUNC ;
-const int32_t fbank_filter_first[NUM_FBANK_BINS] = FBANK_FILTER_FIRST;
-const int32_t fbank_filter_last[NUM_FBANK_BINS] = FBANK_FILTER_LAST;
-const float mel_fbank[NUM_FBANK_BINS][26] = MEL_FBANK;
+static mel_fbank_t fbank;  // CSR mel filterbank (mfcc_init 때 생성)
 const float twiddleCoef_rfft_1024[FRAME_LEN_PADDED] = TWIDDLECOEF_RFFT_1024;
 
 float frame[FRAME_LEN_PADDED] __attribute__((section(".ext_ram.bss")));
@@ -95,6 +94,10 @@ void mfcc_init() {
         ESP_LOGE("esp-eye", "Not possible to initialize FFT. Error = %i", ret);
         return;
     }
+    if (mel_fbank_build(&fbank, NUM_FBANK_BINS, FRAME_LEN_PADDED, MFCC_SAMPLE_RATE, MFCC_LOW_FREQ, MFCC_HIGH_FREQ) != 0) {
+        ESP_LOGE("esp-eye", "Not possible to initialize mel filterbank");
+        return;
+    }
 }
 
 void normalize(float* melSpectrogram) {
@@ -154,13 +157,11 @@ void mfcc_compute(const int16_t * audio_data, float * freq_data) {
 	// printf("[");
 	float sqrt_data;
 	for (bin = 0; bin < NUM_FBANK_BINS; bin++) {
-		j = 0;
 		float mel_energy = 0;
-		int32_t first_index = fbank_filter_first[bin];
-		int32_t last_index = fbank_filter_last[bin];
-		for (i = first_index; i <= last_index; i++) {
+		const float * spectrum = &s_buffer[fbank.first[bin]];
+		for (i = fbank.offset[bin], j = 0; i < fbank.offset[bin + 1]; i++, j++) {
 			//sqrt_data = sqrtf(buffer[i]);
-			mel_energy += (s_buffer[i]) * mel_fbank[bin][j++];
+			mel_energy += spectrum[j] * fbank.weight[i];
 		}
 		mel_energies[bin] = mel_energy;
 
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/time.h>
+#include <new>
 
 #include "esp_log.h"
 #include "esp_system.h"
@@ -10,6 +11,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
 
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_log.h"
@@ -30,6 +32,10 @@
 
 uint8_t model_data[MODEL_MAX_LENGTH] __attribute__((section(".ext_ram.bss")));
 uint8_t *dynamic_model_data = &model_data[0];
+size_t model_length = 0; // NVS에서 읽은 모델 blob 크기 (0: 모델 없음)
+
+// interpreter는 추론 task와 화자 재임베딩 task가 함께 사용
+SemaphoreHandle_t interpreter_mutex = NULL;
 
 float imu_buf[6];
 
@@ -79,6 +85,8 @@ int8_t input_frame[RESIZE_ROWS * RESIZE_COLS * NUM_CHANNEL] __attribute__((secti
 bool _is_model_in_nvs();
 //nvs에 저장된 모델을 읽어옴
 bool _read_model_nvs(void);
+//모델을 읽어 interpreter와 tensor를 다시 구성 (interpreter_mutex를 잡은 상태에서 호출)
+bool _load_model(void);
 //=========================== public ==============================
 void model_setup() {
   ESP_LOGI(MODEL_MANAGER_TAG, "model setup start");
@@ -89,69 +97,17 @@ void model_setup() {
   num_classes = model_info.num_classes;
   // queue 연결
   xQueueSensorData = xQueueCreate(5, sizeof(send_data_t));
-  if(!_read_model_nvs())
-  {
-    ESP_LOGE(MODEL_MANAGER_TAG, "Fail model read");
-    return;
-  }
-  model = tflite::GetModel(dynamic_model_data);
-  if (model->version() != TFLITE_SCHEMA_VERSION) {
-    MicroPrintf("Model provided is schema version %d not equal to supported "
-                "version %d.", model->version(), TFLITE_SCHEMA_VERSION);
-    return;
-  }
-
-  static tflite::MicroMutableOpResolver<11> micro_op_resolver;
-  if (micro_op_resolver.AddFullyConnected() != kTfLiteOk) {
-    return;
-  }
-  if (micro_op_resolver.AddRelu() != kTfLiteOk) {
-    return;
-  }
-  if (micro_op_resolver.AddSoftmax() != kTfLiteOk) {
-    return;
-  }
-  if (micro_op_resolver.AddConv2D() != kTfLiteOk) {
-    return;
-  }
-  if (micro_op_resolver.AddDepthwiseConv2D() != kTfLiteOk) {
-    return;
-  }
-  if (micro_op_resolver.AddMaxPool2D() != kTfLiteOk) {
-    return;
-  }
-  if (micro_op_resolver.AddReshape() != kTfLiteOk) {
-    return;
-  }
-  if (micro_op_resolver.AddQuantize() != kTfLiteOk) {
-    return;
-  }
-  if (micro_op_resolver.AddDequantize() != kTfLiteOk) {
-    return;
-  }
-  if(micro_op_resolver.AddMul() != kTfLiteOk) {
-    return;
-  }
-  if(micro_op_resolver.AddAdd() != kTfLiteOk) {
-    return;
-  }
-
-  // Build an interpreter to run the model with.
-  static tflite::MicroInterpreter static_interpreter(
-      model, micro_op_resolver, tensor_arena, kTensorArenaSize);
-  interpreter = &static_interpreter;
-
-  // Allocate memory from the tensor_arena for the model's tensors.
-  TfLiteStatus allocate_status = interpreter->AllocateTensors();
-  if (allocate_status != kTfLiteOk) {
-    MicroPrintf("AllocateTensors() failed");
+  if (interpreter_mutex == NULL) {
+    interpreter_mutex = xSemaphoreCreateMutex();
+  }
+  // 모델 교체 시 재임베딩/추론 task가 Invoke 중일 수 있으므로 모델 blob과 tensor를 잠금 안에서 교체
+  xSemaphoreTake(interpreter_mutex, portMAX_DELAY);
+  bool loaded = _load_model();
+  xSemaphoreGive(interpreter_mutex);
+  if (!loaded) {
     return;
   }
 
-  // Get information about the memory area to use for the model's input.
-  model_input = interpreter->input(0);
-  model_output = interpreter->output(0);
-
   ESP_LOGI(MODEL_MANAGER_TAG, "Complete model setup!");
 }
 
@@ -411,6 +367,143 @@ QueueHandle_t get_sensor_data_queue()
   return xQueueSensorData;
 }
 
+const uint8_t* get_model_data(size_t* length)
+{
+  *length = model_length;
+  return (model_length > 0) ? dynamic_model_data : NULL;
+}
+
+int get_model_output_size(void)
+{
+  if (interpreter_mutex == NULL) {
+    return 0;
+  }
+  xSemaphoreTake(interpreter_mutex, portMAX_DELAY);
+  int output_size = (interpreter != nullptr) ? model_output->bytes / sizeof(float) : 0;
+  xSemaphoreGive(interpreter_mutex);
+  return output_size;
+}
+
+bool model_embed_features(const float* features, int num_frames, int num_bins, float* embedding, int embedding_size)
+{
+  if (interpreter_mutex == NULL) {
+    ESP_LOGE(MODEL_MANAGER_TAG, "Model not ready");
+    return false;
+  }
+
+  // model_setup이 모델을 교체하는 동안에는 interpreter와 tensor 크기가 바뀌므로 잠금 안에서 확인
+  xSemaphoreTake(interpreter_mutex, portMAX_DELAY);
+  if (interpreter == nullptr) {
+    xSemaphoreGive(interpreter_mutex);
+    ESP_LOGE(MODEL_MANAGER_TAG, "Model not ready");
+    return false;
+  }
+  int output_size = model_output->bytes / sizeof(float);
+  if (output_size != embedding_size) {
+    xSemaphoreGive(interpreter_mutex);
+    ESP_LOGE(MODEL_MANAGER_TAG, "Output size %d != embedding size %d", output_size, embedding_size);
+    return false;
+  }
+  int input_size = model_input->bytes / sizeof(float);
+  int count = num_frames * num_bins;
+  for (int i = 0; i < input_size; i++) {
+    model_input->data.f[i] = (i < count) ? features[i] : 0.0f;
+  }
+  TfLiteStatus invokeStatus = interpreter->Invoke();
+  if (invokeStatus == kTfLiteOk) {
+    memcpy(embedding, model_output->data.f, sizeof(float) * embedding_size);
+  }
+  xSemaphoreGive(interpreter_mutex);
+
+  if (invokeStatus != kTfLiteOk) {
+    ESP_LOGE(MODEL_MANAGER_TAG, "Invoke failed!");
+    return false;
+  }
+  return true;
+}
+
+bool _load_model(void)
+{
+  // 실패하면 interpreter와 tensor를 비워 추론 task와 model_embed_features가 프레임을 건너뛰도록 함
+  interpreter = nullptr;
+  model_input = nullptr;
+  model_output = nullptr;
+  if(!_read_model_nvs())
+  {
+    ESP_LOGE(MODEL_MANAGER_TAG, "Fail model read");
+    return false;
+  }
+  model = tflite::GetModel(dynamic_model_data);
+  if (model->version() != TFLITE_SCHEMA_VERSION) {
+    MicroPrintf("Model provided is schema version %d not equal to supported "
+                "version %d.", model->version(), TFLITE_SCHEMA_VERSION);
+    return false;
+  }
+
+  static tflite::MicroMutableOpResolver<11> micro_op_resolver;
+  // op는 한 번만 등록 (모델 교체 시 model_setup이 다시 호출되어도 같은 resolver 사용)
+  static bool ops_registered = false;
+  if (!ops_registered) {
+    if (micro_op_resolver.AddFullyConnected() != kTfLiteOk) {
+      return false;
+    }
+    if (micro_op_resolver.AddRelu() != kTfLiteOk) {
+      return false;
+    }
+    if (micro_op_resolver.AddSoftmax() != kTfLiteOk) {
+      return false;
+    }
+    if (micro_op_resolver.AddConv2D() != kTfLiteOk) {
+      return false;
+    }
+    if (micro_op_resolver.AddDepthwiseConv2D() != kTfLiteOk) {
+      return false;
+    }
+    if (micro_op_resolver.AddMaxPool2D() != kTfLiteOk) {
+      return false;
+    }
+    if (micro_op_resolver.AddReshape() != kTfLiteOk) {
+      return false;
+    }
+    if (micro_op_resolver.AddQuantize() != kTfLiteOk) {
+      return false;
+    }
+    if (micro_op_resolver.AddDequantize() != kTfLiteOk) {
+      return false;
+    }
+    if(micro_op_resolver.AddMul() != kTfLiteOk) {
+      return false;
+    }
+    if(micro_op_resolver.AddAdd() != kTfLiteOk) {
+      return false;
+    }
+    ops_registered = true;
+  }
+
+  // Build an interpreter to run the model with.
+  // 모델 교체 시에는 이전 interpreter를 정리하고 같은 자리에 새로 만들어 tensor_arena를 처음부터 다시 할당
+  alignas(tflite::MicroInterpreter) static uint8_t interpreter_buf[sizeof(tflite::MicroInterpreter)];
+  static tflite::MicroInterpreter* built_interpreter = nullptr;
+  if (built_interpreter != nullptr) {
+    built_interpreter->~MicroInterpreter();
+  }
+  built_interpreter = new (interpreter_buf) tflite::MicroInterpreter(
+      model, micro_op_resolver, tensor_arena, kTensorArenaSize);
+
+  // Allocate memory from the tensor_arena for the model's tensors.
+  TfLiteStatus allocate_status = built_interpreter->AllocateTensors();
+  if (allocate_status != kTfLiteOk) {
+    MicroPrintf("AllocateTensors() failed");
+    return false;
+  }
+
+  // Get information about the memory area to use for the model's input.
+  model_input = built_interpreter->input(0);
+  model_output = built_interpreter->output(0);
+  interpreter = built_interpreter;
+  return true;
+}
+
 bool _read_model_nvs(void)
 {
   esp_err_t err;
@@ -442,6 +535,7 @@ bool _read_model_nvs(void)
     ESP_LOGE(MODEL_MANAGER_TAG, "Error: get model");
     return false;
   }
+  model_length = required_size;
   ESP_LOGI(MODEL_MANAGER_TAG, "Model get complete!");
 
   // //length check
@@ -479,6 +573,13 @@ void model_inference_task(void * arg)
             continue;
           }
           memcpy(imu_buf, received_sensor_data.data.imu_data.buf, sizeof(imu_buf));
+          // model_setup의 모델 교체와 겹치지 않도록 input 기록부터 출력 읽기까지 잠금
+          xSemaphoreTake(interpreter_mutex, portMAX_DELAY);
+          if (interpreter == nullptr) {
+            // 모델 교체 실패: 새 모델이 올라올 때까지 프레임을 건너뜀
+            xSemaphoreGive(interpreter_mutex);
+            break;
+          }
           if (samplesRead == numSamples) {
             accel_sum = (fabs(imu_buf[0]) + fabs(imu_buf[1]) + fabs(imu_buf[2]) + fabs(imu_buf[3]) + fabs(imu_buf[4]) + fabs(imu_buf[5])) / 6.0;
             // check if it's above the threshold
@@ -503,9 +604,10 @@ void model_inference_task(void * arg)
               TfLiteStatus invokeStatus = interpreter->Invoke();
               if (invokeStatus != kTfLiteOk)
               {
+                // 잠금을 쥔 채 멈추면 재임베딩 task도 함께 멈추므로 이번 추론만 버림
+                xSemaphoreGive(interpreter_mutex);
                 ESP_LOGE(MODEL_MANAGER_TAG, "Invoke failed!");
-                while (1);
-                return;
+                break;
               }
               ESP_LOGI(MODEL_MANAGER_TAG,"Input size: %u",model_input->bytes / 4);
               ESP_LOGI(MODEL_MANAGER_TAG, "Output size: %d", model_output->bytes / 4);
@@ -526,6 +628,7 @@ void model_inference_task(void * arg)
               start_time = xTaskGetTickCount();
             }
           }
+          xSemaphoreGive(interpreter_mutex);
           break;
         }
         case SPEECH_DATA:
@@ -559,9 +662,16 @@ void model_inference_task(void * arg)
               data_head += NUM_FBANK_BINS;
             }
 
+            // 입력 기록부터 출력 읽기까지 재임베딩 task와 interpreter를 나누어 씀
+            xSemaphoreTake(interpreter_mutex, portMAX_DELAY);
+            if (interpreter == nullptr) {
+              xSemaphoreGive(interpreter_mutex);
+              heap_caps_free(freq_data);
+              ESP_LOGE(MODEL_MANAGER_TAG, "Model not ready");
+              break;
+            }
             ESP_LOGI(MODEL_MANAGER_TAG,"Input size: %u",model_input->bytes / 4);
             ESP_LOGI(MODEL_MANAGER_TAG, "Output size: %d", model_output->bytes / 4);
-
             for (int i = 0; i < model_input->bytes; ++i) {
               model_input->data.uint8[i] = 0.0f;
             }
@@ -574,9 +684,9 @@ void model_inference_task(void * arg)
             TfLiteStatus invokeStatus = interpreter->Invoke();
             if (invokeStatus != kTfLiteOk)
             {
+              xSemaphoreGive(interpreter_mutex);
               ESP_LOGE(MODEL_MANAGER_TAG, "Invoke failed!");
-              while (1);
-              return;
+              break;
             }
             max_index[0] = 0;
             max_value = 0;
@@ -589,6 +699,7 @@ void model_inference_task(void * arg)
               }
               ESP_LOGI("test","%d:  %f",i, _value);
             }
+            xSemaphoreGive(interpreter_mutex);
             ESP_LOGI("test","Winner:  %d",max_index[0]);
             send_data_to_ble(max_index, sizeof(max_index), INFERENCE_DATA);
           }
@@ -599,6 +710,12 @@ void model_inference_task(void * arg)
           vision_db_t vision_data = received_sensor_data.data.vision_data;
           resize_and_convert_rgb_i8(vision_data.frame, input_frame);
           camera_fb_return(vision_data.frame);
+          xSemaphoreTake(interpreter_mutex, portMAX_DELAY);
+          if (interpreter == nullptr) {
+            xSemaphoreGive(interpreter_mutex);
+            ESP_LOGE(MODEL_MANAGER_TAG, "Model not ready");
+            break;
+          }
           for (int i = 0; i < model_input->bytes; i++) {
             model_input->data.int8[i] = 0.0f;
           }
@@ -610,8 +727,9 @@ void model_inference_task(void * arg)
           TfLiteStatus invokeStatus = interpreter->Invoke();
           if (invokeStatus != kTfLiteOk)
           {
+            xSemaphoreGive(interpreter_mutex);
             ESP_LOGE("test", "Invoke failed!");
-            return;
+            break;
           }
 
           int8_t mask_score = model_output->data.int8[0];
@@ -640,6 +758,7 @@ void model_inference_task(void * arg)
             }
             ESP_LOGI("test","%d:  %d",i, _value);
           }
+          xSemaphoreGive(interpreter_mutex);
           ESP_LOGI("test","Winner:  %d",max_index[0]);
           send_data_to_ble(max_index, sizeof(max_index), INFERENCE_DATA);
           break;
@@ -3,10 +3,28 @@
 #include <stdlib.h> // malloc, free
 #include <string.h> // memcpy, strncpy, memset
 #include <math.h>   // sqrtf
+#include <sched.h>  // sched_yield
+#include <unistd.h> // usleep
 
 #include "speaker_verifier.h"  // 본 모듈의 헤더 파일
+#include "sv_kernels.h"        // 정규화 / 행렬-벡터 곱 커널
+#include "sv_pool.h"           // RAM DB 임베딩 행 pool (PSRAM chunk)
+#include "sv_store.h"          // 영구 저장소 (flash 파티션 journal)
+#include "sv_image.h"          // 바이너리 DB 이미지 형식
+#include "sv_projection.h"     // 차원 축소 projection 형식
+#include "sv_backend.h"        // 점수 계산 backend (cosine / PLDA)
+#include "sv_ivf.h"            // 대규모 화자 목록용 IVF 색인
+#include "sv_features.h"       // 재임베딩용 등록 특징 인코딩
 #include "sv_database.h"       // 사전에 등록된 임베딩 DB
 
+#if SV_ENABLE_STATS
+#ifdef ESP_PLATFORM
+#include "esp_cpu.h"           // esp_cpu_get_cycle_count
+#else
+#include <time.h>              // clock_gettime
+#endif
+#endif
+
 #define LOG_I(tag, format, ...) printf("[%s] " format "\n", tag, ##__VA_ARGS__)
 #define LOG_E(tag, format, ...) printf("[ERROR %s] " format "\n", tag, ##__VA_ARGS__)
 
@@ -15,18 +33,230 @@
 // 전역 변수 (내부에서만 사용)
 static const char* TAG = SV_LOG_TAG; 
 
+#if SV_ENABLE_STATS
+// 판정 통계 (모든 handle/세션 합산, 판정마다 한 번 잠금)
+static sv_stats_t stats;
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 
 //=========================== prototypes ==========================
 /* private 함수들의 프로토타입 (내부에서만 사용) */ 
 
-// cosine similarity 계산
-static float sv_cosine_similarity(const float* emb1, const float* emb2, int dim);
+#if SV_ENABLE_STATS
+// 판정 시간 측정용 시각 (target: CPU cycle, host: ns, 차이만 사용하므로 32비트 wrap 허용)
+static uint32_t _stats_now(void);
+
+// 판정 1회의 소요 시간, best_score, 판정 지연을 통계에 반영
+static void _stats_record(sv_session_t* session, const sv_result_t* result, bool scored, uint32_t cycles);
+#endif
+
+// 결과/후보 배열을 '결과 없음'으로 초기화 (반환값: SV_MAX_TOPK로 제한한 k)
+static int _result_init(sv_result_t* result, sv_candidate_t* topk, int k);
+
+// DB 행 배치가 바뀌었으면 (삭제, compaction) 세션의 행 기반 후처리 상태를 초기화
+static void _session_sync_layout(sv_session_t* session, const sv_db_t* db);
+
+// 세션의 행별 버퍼를 rows 행까지 늘림 (DB가 커진 뒤 첫 판정에서 호출)
+static sv_status_t _session_reserve(sv_session_t* session, int rows);
+
+// 세션 점수(session->scores)로 top-k 선택과 후처리 알고리즘 적용
+static void sv_decide(sv_session_t* session, const sv_db_t* db,
+                      sv_candidate_t* topk, int k, sv_result_t* result);
+
+// 여러 세션의 쿼리를 블록 단위 행렬-행렬 곱 한 번으로 계산한 뒤 세션별로 판정 (count <= SV_MAX_BATCH)
+static void sv_verify_batch(sv_handle_t* handle, const sv_db_t* db, sv_session_t* const* sessions,
+                            float* const* embeddings, int count, sv_result_t* results);
+
+// 현재 임베딩과 DB의 모든 화자 간 점수를 한 번에 계산 (session->scores)
+static void sv_score_all(sv_session_t* session, const sv_db_t* db, const float* current_embedding);
+
+// IVF 색인: 가까운 목록과 색인 이후 추가된 행만 정확히 점수 계산 (session->cand_rows/cand_scores)
+static void sv_score_ivf(sv_session_t* session, const sv_db_t* db, const float* current_embedding);
+
+// IVF 후보에 행 추가 (삭제된 행, 이미 추가된 행 제외)
+static void _add_candidate(sv_session_t* session, const sv_db_t* db, int row);
+
+// 블록 단위 내적 + Cauchy-Schwarz 상한으로 판정을 바꿀 수 없는 행은 중간에 포기 (SV_SCAN_EARLY_ABANDON)
+static void sv_score_abandon(sv_session_t* session, const sv_db_t* db, const float* current_embedding);
+static bool _abandon_enabled(sv_session_t* session);
+
+// 행 scale이 반영된 내적에 행별/쿼리 상수 항과 AS-norm을 적용한 최종 점수 (단조 증가)
+static float _row_score(const sv_session_t* session, const sv_db_t* db, int row, float dot,
+                        float q_mean, float q_std, bool asnorm);
+
+// out[b] = |vec[b * block ..dim)| (b = 0 ~ SV_ABANDON_BLOCKS - 1, 블록이 dim을 넘으면 0)
+static void _suffix_norms(const float* vec, int dim, int block, float* out);
+
+// 커널 출력(session->scores 또는 q_acc)에 행 scale, backend 상수 항, AS-norm, 삭제 행 제외를 적용
+static void _finish_scores(sv_session_t* session, const sv_db_t* db);
+
+// int8 DB 모드: 양자화 누산 결과로 전체 점수를 복원한 뒤 상위 후보만 float 쿼리로 재계산
+static void sv_score_all_q8(sv_session_t* session, const sv_db_t* db);
+
+// backend 상수 항(행별 row_bias + 쿼리 q_bias)을 점수에 더함 (row_bias가 있는 backend만)
+static void _add_bias(sv_session_t* session, const sv_db_t* db);
+
+// scores[0..n-1]에서 상위 k개의 인덱스를 점수 내림차순으로 선택 (부분 선택)
+static int sv_select_topk(const float* scores, int n, int k, int* out_idx);
+
+// 삭제된 행의 점수를 SV_SCORE_INVALID로 덮어씀
+static void _mask_dead_rows(sv_session_t* session, const sv_db_t* db);
+
+// projection header 검증 (in_dim == embedding_dim, out_dim, 정렬)
+static const sv_projection_header_t* _projection_check(const void* data, int embedding_dim);
+
+// 임베딩을 backend로 변환(및 int8 모드에서는 양자화)하여 DB의 idx번째 행에 저장
+static void _store_embedding(sv_handle_t* handle, sv_db_t* db, int idx, const float* embedding);
+
+// backend로 변환된 벡터를 DB의 idx번째 행에 기록하고 행별 값(scale, 상수 항, suffix norm, cohort 통계) 갱신
+static void _write_row(sv_handle_t* handle, sv_db_t* db, int idx, const float* vec);
+
+// 다중 template: template 점수를 화자(lead 행) 점수로 합치고 나머지 template 행은 판정에서 제외
+static void _merge_template_scores(sv_session_t* session, const sv_db_t* db);
+
+// 다중 template: 임베딩을 화자의 가장 가까운 template에 합치거나 새 template으로 추가 (online: 온라인 갱신 규칙)
+static sv_status_t _template_update(sv_handle_t* handle, int speaker_id, const float* embedding, bool online);
+
+// 다중 template: 행에 running mean으로 합침 (chunk copy-on-write, 반환값: 유예 해제할 이전 chunk, 실패 시 NULL)
+static uint8_t* _template_merge(sv_handle_t* handle, sv_db_t* db, int row, const float* vec, float sim);
+
+// 다중 template: 유사도가 template에 합쳐진 유사도 분포의 이상치인지 판단
+static bool _template_outlier(const sv_template_t* t, float sim);
+
+// 온라인 갱신: 새로 최종 판정된 화자의 점수가 update_threshold 이상이면 임베딩으로 template 갱신
+static void _template_feedback(sv_session_t* session, const sv_result_t* result, const float* embedding);
+
+// 모델 교체 재임베딩: 화자의 등록 특징 조회/삭제 (쓰기 잠금 상태에서 호출)
+static sv_enroll_t* _enroll_find(sv_handle_t* handle, int speaker_id);
+static bool _enroll_remove(sv_handle_t* handle, int speaker_id);
+static void _enroll_drop(sv_handle_t* handle, sv_enroll_t* enroll);
+static bool _enroll_pending(const sv_handle_t* handle, const sv_enroll_t* enroll);
+static void _enroll_add_stale(sv_handle_t* handle, int speaker_id, const char name[SV_MAX_NAME_LEN]);
+static int _count_stale(const sv_handle_t* handle);
+
+// 보관된 발화마다 특징을 복원하여 embed 호출 (쓰기 잠금 밖에서 호출)
+static sv_status_t _migrate_embed(const sv_enroll_t* enroll, sv_embed_fn_t embed, void* ctx,
+                                  int embedding_dim, float* embeddings);
+
+// AS-norm: 현재 점수(session->scores)를 cohort 통계로 정규화
+static void sv_asnorm_apply(sv_session_t* session, const sv_db_t* db);
+
+// AS-norm: 정규화된 벡터의 cohort 상위 N개 점수 평균/표준편차 계산
+static void sv_cohort_stats(const sv_handle_t* handle, const sv_db_t* db, const float* unit_vec,
+                            float* work, float* mean, float* std);
+
+// AS-norm: DB의 idx번째 행에 대한 cohort 통계 갱신
+static void _update_enroll_stats(sv_handle_t* handle, sv_db_t* db, int idx);
 
-// majority voting 윈도우에서 과반수 이상 등장한 화자 찾기
-static int sv_find_majority(sv_handle_t* handle);
+// majority voting 윈도우에 현재 판정(DB 행)을 넣고 과반수 행을 O(1)로 갱신
+static int sv_vote_push(sv_session_t* session, int row);
+
+// 화자별 점수를 지수 평활하고 hysteresis로 판정 유지/해제 (판정된 DB 행 반환)
+static int sv_smooth_update(sv_session_t* session, const sv_db_t* db);
 
 // sv_database.h에 정의된 등록 화자를 RAM DB로 복사
-static void _load_preregistered_speakers(sv_handle_t* handle);
+static void _load_preregistered_speakers(sv_handle_t* handle, sv_db_t* db);
+
+// sv_database.h의 임베딩 차원이 handle과 같은지 확인 (다르면 LOG_E)
+static bool _database_dim_ok(const sv_handle_t* handle);
+
+// RAM DB: pool에서 행을 할당(삭제된 행 우선 재사용)하여 화자 추가 (반환값: 행, 메모리 부족 시 -1)
+static int _add_ram_speaker(sv_handle_t* handle, sv_db_t* db, int speaker_id, const char* name,
+                            const float* embedding);
+
+// RAM DB: 행을 할당하고 화자 항목만 기록 (임베딩은 호출자가 기록, 반환값: 행, 메모리 부족 시 -1)
+static int _alloc_ram_row(sv_handle_t* handle, sv_db_t* db, int speaker_id, const char* name);
+
+// 다중 template: compaction으로 from 행이 to 행으로 옮겨질 때 template 연결을 갱신
+static void _template_move(sv_db_t* db, int from, int to);
+
+// RAM DB: 뒤쪽 살아 있는 행을 앞쪽 삭제된 행으로 옮겨 행렬을 조밀하게 만들고 남는 chunk 반환
+static void _compact_rows(sv_handle_t* handle);
+
+// DB 행을 점수 계산 공간의 float 벡터로 복원 (int8/fp16 복원, 이미지 행 scale 적용)
+static void _db_row_f32(const sv_handle_t* handle, const sv_db_t* db, int row, float* out);
+
+// early-abandon용 행별 블록 suffix norm을 계산 (행 기록과 row_scales 설정 이후에 호출)
+static void _update_suffix_norms(const sv_handle_t* handle, sv_db_t* db, int row);
+
+// IVF 색인을 살아 있는 행으로 다시 만듦 (이전 색인은 게시 시 유예 해제)
+static void _ivf_rebuild(sv_handle_t* handle, sv_db_t* db);
+
+// 새로 기록된 행을 색인 대기 목록에 추가 (많이 쌓이면 색인을 다시 만듦)
+static void _ivf_add_row(sv_handle_t* handle, sv_db_t* db, int row);
+
+// 매핑된 행렬(저장소/이미지)을 chunk 테이블로 구성
+static void _map_chunks(sv_db_t* db, const uint8_t* base, size_t row_bytes, int rows);
+
+// DB 이미지: 화자 ID/이름만 복사하고 임베딩 행렬은 이미지를 직접 가리킴
+static void _load_image(sv_handle_t* handle, sv_db_t* db);
+
+// DB 이미지: header 검증 (dim: 점수 계산 차원, 실패 시 NULL)
+static const sv_image_header_t* _image_check(const void* data, int dim);
+
+// DB 이미지: i번째 임베딩을 float로 복원 (정규화 전, int8은 scale 적용)
+static void _image_row_f32(const sv_image_header_t* image, int i, float* out);
+
+// 영구 저장소: 비어 있으면 사전 등록 화자(또는 DB 이미지)를 기록한 뒤 DB view 구성
+static void _load_store(sv_handle_t* handle, sv_db_t* db, const sv_image_header_t* seed_image);
+
+// 영구 저장소: 매핑된 record 전체로 DB view(speakers_db, chunk 테이블)를 다시 구성
+static void _sync_store_view(sv_handle_t* handle, sv_db_t* db);
+
+// 영구 저장소: slot번째 record(ADD/DEL/끊긴 쓰기)를 DB view에 반영
+static void _apply_store_record(sv_handle_t* handle, sv_db_t* db, int slot);
+static bool _apply_store_row(sv_handle_t* handle, sv_db_t* db, int slot, int prev_row);
+static int* _id_slot(int* table, int size, int speaker_id);
+static uint32_t _store_record_hash(const sv_handle_t* handle, const sv_store_record_t* rec);
+
+// 영구 저장소: 모델 교체 (등록 특징을 보관하지 않으므로 현재 모델의 화자가 있으면 거부)
+static sv_status_t _store_set_model(sv_handle_t* handle, uint32_t model_hash);
+
+// 영구 저장소: journal에 slots개의 빈 자리가 없으면 compaction 후 view와 후처리 상태를 다시 구성
+static sv_status_t _reserve_store_slots(sv_handle_t* handle, sv_db_t* db, int slots);
+
+// speaker_id를 가진 살아 있는 DB 행 검색 (다중 template은 lead 행, -1: 없음)
+static int _find_row(const sv_db_t* db, int speaker_id);
+
+// DB 행을 삭제 상태로 표시
+static void _kill_row(sv_db_t* db, int row);
+
+// DB snapshot 할당/해제 (행별 배열과 chunk 테이블은 snapshot마다 소유)
+static sv_db_t* _db_alloc(const sv_handle_t* handle, int capacity);
+static void _db_free(void* ptr);
+
+// snapshot 행별 배열을 capacity 행까지 늘림 (게시 전 사본에만 사용)
+static sv_status_t _db_reserve(const sv_handle_t* handle, sv_db_t* db, int capacity);
+
+// 현재 snapshot의 사본 (쓰기 잠금을 잡은 상태에서 호출)
+static sv_db_t* _db_copy(sv_handle_t* handle);
+
+// 쓰기 잠금을 잡고 현재 snapshot의 사본을 반환 (실패 시 잠금 해제 후 NULL)
+static sv_db_t* _db_begin_write(sv_handle_t* handle);
+static sv_status_t _db_try_begin_write(sv_handle_t* handle, sv_db_t** out);
+
+// 사본을 현재 snapshot으로 게시하고 이전 snapshot을 해제 대기 목록에 추가 (잠금은 호출자가 해제)
+static void _db_publish(sv_handle_t* handle, sv_db_t* next);
+
+// 현재 epoch 이후 어떤 reader도 사용하지 않으면 해제되도록 ptr을 해제 대기 목록에 추가
+static void _db_retire(sv_handle_t* handle, void* ptr, void (*free_fn)(void*));
+
+// 삭제된 행을 어떤 reader도 보지 않게 된 뒤 pool free-list로 반환하도록 예약
+static void _db_retire_row(sv_handle_t* handle, int row);
+
+// 모든 reader가 지나간 해제 대기 항목을 해제 (force: reader 확인 없이 모두 해제)
+static void _db_reclaim(sv_handle_t* handle, bool force);
+
+// 해제 대기 목록이 빌 때까지 대기 (이전 snapshot을 보는 reader가 없음을 보장)
+static void _db_synchronize(sv_handle_t* handle);
+
+// 사용 중인 reader slot의 최소 epoch (없으면 UINT32_MAX)
+static uint32_t _reader_min_epoch(sv_handle_t* handle);
+
+// reader slot을 잡고 현재 snapshot을 pin (반환값: slot 번호)
+static int _reader_enter(sv_handle_t* handle, const sv_db_t** db);
+static void _reader_exit(sv_handle_t* handle, int slot);
 
 
 //=========================== public ==============================
@@ -40,38 +270,228 @@ sv_handle_t* sv_system_init(sv_config_t* config) {
         return NULL;
     }
     memset(handle, 0, sizeof(sv_handle_t));
+    pthread_mutex_init(&handle->write_lock, NULL);
+    atomic_init(&handle->epoch, 1); // reader_epoch 0은 '비어 있음'
+    for (int i = 0; i < SV_MAX_READERS; ++i) {
+        atomic_init(&handle->reader_epoch[i], 0);
+    }
 
     // 2. 설정 복사
     memcpy(&handle->settings, config, sizeof(sv_config_t));
-    handle->max_speakers = SV_MAX_SPEAKERS; // 헤더에 정의된 값 사용
+    if (handle->settings.rerank_k <= 0) {
+        handle->settings.rerank_k = SV_DEFAULT_RERANK_K;
+    }
+    if (handle->settings.voting_window <= 0) {
+        handle->settings.voting_window = SV_VOTING_WINDOW_SIZE;
+    }
+    if (handle->settings.smoothing_alpha <= 0.0f || handle->settings.smoothing_alpha > 1.0f) {
+        handle->settings.smoothing_alpha = SV_DEFAULT_SMOOTHING_ALPHA;
+    }
+    if (handle->settings.enter_threshold == 0.0f) {
+        handle->settings.enter_threshold = handle->settings.threshold;
+    }
+    if (handle->settings.exit_threshold == 0.0f) {
+        handle->settings.exit_threshold = handle->settings.enter_threshold - SV_DEFAULT_HYSTERESIS;
+    }
+    if (handle->settings.cohort_size <= 0) {
+        handle->settings.cohort_size = SV_DEFAULT_COHORT_SIZE;
+    }
+    if (handle->settings.cohort_top_n <= 0) {
+        handle->settings.cohort_top_n = SV_DEFAULT_COHORT_TOP_N;
+    }
 
-    // 3. 화자 DB 메모리 할당
-    handle->speakers_db = (sv_speaker_entry_t*)malloc(sizeof(sv_speaker_entry_t) * handle->max_speakers);
-    if (!handle->speakers_db) {
-        LOG_E(TAG, "Failed to allocate memory for speakers_db");
+    // 입력 임베딩 차원 (모델마다 다름, 작업 버퍼는 SV_MAX_EMBEDDING_DIM 기준)
+    handle->embedding_dim = (handle->settings.embedding_dim > 0) ? handle->settings.embedding_dim : SV_EMBEDDING_DIM;
+    if (handle->embedding_dim > SV_MAX_EMBEDDING_DIM) {
+        LOG_E(TAG, "Embedding dim %d exceeds SV_MAX_EMBEDDING_DIM (%d)", handle->embedding_dim, SV_MAX_EMBEDDING_DIM);
+        pthread_mutex_destroy(&handle->write_lock);
         free(handle);
         return NULL;
     }
-    memset(handle->speakers_db, 0, sizeof(sv_speaker_entry_t) * handle->max_speakers);
 
-    // 4. 내부 상태 초기화 (Private 함수 호출)
-    sv_system_reset_state(handle);
+    // projection: DB 행, 쿼리, cohort 모두 투영된 차원으로 계산
+    handle->dim = handle->embedding_dim;
+    if (handle->settings.projection) {
+        handle->projection = _projection_check(handle->settings.projection, handle->embedding_dim);
+        if (handle->projection) {
+            const uint8_t* base = (const uint8_t*)handle->projection;
+            handle->proj_mean = (const float*)(base + handle->projection->mean_offset);
+            handle->proj_matrix = (const float*)(base + handle->projection->matrix_offset);
+            handle->dim = handle->projection->out_dim;
+            LOG_I(TAG, "Projection %d -> %d (%s)", handle->embedding_dim, handle->dim,
+                  (handle->projection->flags & SV_PROJ_FLAG_LDA) ? "LDA" : "PCA");
+        } else {
+            LOG_E(TAG, "Invalid projection, scoring in %d dims", handle->embedding_dim);
+        }
+    }
+
+    // 점수 계산 backend (모델 계수는 여기서 한 번만 계산)
+    handle->backend = &sv_backend_cosine;
+    if (handle->settings.backend == SV_BACKEND_PLDA) {
+        if (sv_backend_plda.create(handle) == SV_SUCCESS) {
+            handle->backend = &sv_backend_plda;
+        } else {
+            LOG_E(TAG, "PLDA backend unavailable, using cosine");
+            handle->settings.backend = SV_BACKEND_COSINE;
+        }
+    }
+    // AS-norm cohort 통계는 단위 벡터 행의 코사인 점수 기준
+    if (!handle->backend->unit_rows && handle->settings.score_norm == SV_NORM_ASNORM) {
+        LOG_I(TAG, "AS-norm is not used with %s backend", handle->backend->name);
+        handle->settings.score_norm = SV_NORM_NONE;
+    }
+
+    const sv_image_header_t* image = NULL;
+    if (handle->settings.db_image) {
+        image = _image_check(handle->settings.db_image, handle->dim);
+        if (!image) {
+            LOG_E(TAG, "Invalid DB image, using sv_database.h");
+        }
+    }
+
+    // 영구 저장소: 임베딩은 매핑된 flash record를 그대로 사용하므로 float 형식만 지원
+    if (handle->settings.store_name) {
+        handle->store = sv_store_open(handle->settings.store_name, handle->dim);
+        if (!handle->store) {
+            LOG_E(TAG, "Failed to open store '%s', using RAM DB", handle->settings.store_name);
+        } else if (handle->settings.db_format != SV_DB_FLOAT) {
+            LOG_I(TAG, "Store mode supports SV_DB_FLOAT only, db_format ignored");
+            handle->settings.db_format = SV_DB_FLOAT;
+        }
+    }
+
+    // DB 이미지 모드: 형식은 이미지 인코딩을 따름
+    if (image && !handle->store) {
+        handle->image = image;
+        handle->settings.db_format = (image->encoding == SV_IMAGE_INT8) ? SV_DB_INT8 :
+                                     (image->encoding == SV_IMAGE_FP16) ? SV_DB_FP16 : SV_DB_FLOAT;
+    }
+
+    if (handle->settings.rerank_k > SV_MAX_RERANK_K) {
+        handle->settings.rerank_k = SV_MAX_RERANK_K;
+    }
+    if (handle->settings.ivf_probe <= 0) {
+        handle->settings.ivf_probe = SV_DEFAULT_IVF_PROBE;
+    }
+    if (handle->settings.ivf_probe > SV_MAX_IVF_PROBE) {
+        handle->settings.ivf_probe = SV_MAX_IVF_PROBE;
+    }
+
+    // 다중 template: RAM DB 행만 추가/갱신 가능 (저장소는 flash 쓰기 횟수, 이미지는 읽기 전용)
+    if (handle->settings.max_templates <= 0) {
+        handle->settings.max_templates = 1;
+    }
+    if (handle->settings.max_templates > SV_MAX_TEMPLATES) {
+        handle->settings.max_templates = SV_MAX_TEMPLATES;
+    }
+    if (handle->settings.template_merge_sim == 0.0f) {
+        handle->settings.template_merge_sim = SV_DEFAULT_TEMPLATE_MERGE_SIM;
+    }
+    if ((handle->store || handle->image) &&
+        (handle->settings.max_templates > 1 || handle->settings.update_threshold > 0.0f)) {
+        LOG_I(TAG, "Multiple templates and online updates are RAM DB only, using one template");
+        handle->settings.max_templates = 1;
+        handle->settings.update_threshold = 0.0f;
+    }
+
+    // early-abandon: 블록 상한은 float 행 기준, score smoothing은 모든 화자의 점수가 필요
+    if (handle->settings.scan == SV_SCAN_EARLY_ABANDON &&
+        (handle->settings.db_format == SV_DB_INT8 || handle->settings.algorithm == POST_SCORE_SMOOTHING)) {
+        LOG_I(TAG, "Early-abandon scan is not used with int8 DB or score smoothing");
+        handle->settings.scan = SV_SCAN_FULL;
+    }
+    // 포기한 행의 상한은 template 최대값으로는 합칠 수 있지만 평균에는 섞을 수 없음
+    if (handle->settings.scan == SV_SCAN_EARLY_ABANDON && handle->settings.max_templates > 1 &&
+        handle->settings.template_score == SV_TEMPLATE_MEAN) {
+        LOG_I(TAG, "Early-abandon scan is not used with mean template scores");
+        handle->settings.scan = SV_SCAN_FULL;
+    }
+    handle->abandon_block = ((handle->dim + SV_ABANDON_BLOCKS - 1) / SV_ABANDON_BLOCKS + 3) & ~3;
+
+    // 저장소/이미지 모드는 매핑된 행 수가 용량, RAM 모드는 pool chunk가 늘어나는 만큼 (메모리 크기로만 제한)
+    bool use_q8 = (handle->settings.db_format == SV_DB_INT8);
+    int capacity = 0;
+    if (handle->store) {
+        capacity = handle->store->capacity;
+    } else if (handle->image) {
+        capacity = (int)handle->image->num_speakers;
+    }
+
+    // 3. 화자 DB 메모리 할당 (첫 snapshot + 행 pool + 기본 세션)
+    sv_db_t* db = _db_alloc(handle, capacity);
+    atomic_init(&handle->db, db); // 실패 시 sv_system_deinit이 정리할 수 있도록 먼저 연결
+    bool alloc_ok = (db != NULL);
+    handle->session = sv_session_create(handle);
+    if (db) {
+        if (!handle->store && !handle->image) {
+            size_t elem = use_q8 ? sizeof(int8_t) : sizeof(float);
+            handle->pool = sv_pool_create(elem * handle->dim);
+            if (handle->pool) {
+                db->row_bytes = handle->pool->row_bytes;
+                db->emb_stride = (int)(db->row_bytes / elem);
+            }
+            alloc_ok = (handle->pool != NULL);
+        } else if (handle->image && !use_q8 && handle->backend->unit_rows &&
+                   !(handle->image->flags & SV_IMAGE_FLAG_NORMALIZED)) {
+            db->row_scales = (float*)malloc(sizeof(float) * db->capacity);
+            alloc_ok = (db->row_scales != NULL);
+        }
+        if (handle->settings.score_norm == SV_NORM_ASNORM) {
+            int cohort_size = handle->settings.cohort_size;
+            db->cohort_matrix = (float*)sv_aligned_alloc(sizeof(float) * handle->dim * cohort_size);
+            handle->enroll_work = (float*)sv_aligned_alloc(sizeof(float) * cohort_size);
+            alloc_ok = alloc_ok && db->cohort_matrix && handle->enroll_work;
+        }
+    }
+    if (!handle->session || !alloc_ok) {
+        LOG_E(TAG, "Failed to allocate memory for speakers_db");
+        sv_system_deinit(handle);
+        return NULL;
+    }
+
+    // 4. 내부 상태 초기화 (세션 생성 시 완료)
     
-    // 5. 사전 등록된 화자 로드 (Private 함수 호출)
-    handle->num_speakers = 0;
-    _load_preregistered_speakers(handle);
+    // 5. 사전 등록된 화자 로드 (Private 함수 호출, 첫 snapshot은 아직 reader가 없으므로 직접 구성)
+    if (handle->store) {
+        _load_store(handle, db, image);
+    } else if (handle->image) {
+        _load_image(handle, db);
+    } else {
+        _load_preregistered_speakers(handle, db);
+    }
+    _ivf_rebuild(handle, db);
     
     LOG_I(TAG, "SV System Initialized. %d speakers loaded. Algorithm: %d", 
-          handle->num_speakers, handle->settings.algorithm);
+          db->num_speakers, handle->settings.algorithm);
 
     return handle;
 }
 
 void sv_system_deinit(sv_handle_t* handle) {
     if (handle) {
-        if (handle->speakers_db) {
-            free(handle->speakers_db);
+        // 해제 대기 중인 snapshot 정리 (deinit 시점에는 reader가 없어야 함)
+        _db_reclaim(handle, true);
+
+        sv_db_t* db = atomic_load(&handle->db);
+        if (handle->store) {
+            sv_store_close(handle->store); // 임베딩 행은 매핑된 영역이므로 해제하지 않음
+        }
+        sv_pool_destroy(handle->pool);
+        if (db) {
+            free(db->row_scales);
+            sv_aligned_free(db->cohort_matrix);
+            sv_ivf_destroy(db->ivf);
+            _db_free(db);
+        }
+        sv_session_destroy(handle->session);
+        sv_aligned_free(handle->enroll_work);
+        while (handle->enrolls) {
+            _enroll_drop(handle, handle->enrolls);
+        }
+        if (handle->backend) {
+            handle->backend->destroy(handle);
         }
+        pthread_mutex_destroy(&handle->write_lock);
         free(handle);
         LOG_I(TAG, "SV System Deinitialized.");
     }
@@ -79,213 +499,2883 @@ void sv_system_deinit(sv_handle_t* handle) {
 
 sv_status_t sv_system_register(sv_handle_t* handle, float* new_embedding, const char* name) {
     if (!handle) return SV_ERROR;
-    // if (handle->num_speakers >= handle->max_speakers) {
-    //     LOG_E(TAG, "Speaker DB is full. Cannot register new speaker.");
-    //     return SV_DB_FULL;
-    // }
+    if (handle->image) {
+        LOG_E(TAG, "DB image is read-only. Cannot register new speaker.");
+        return SV_ERROR;
+    }
 
-    int new_idx = handle->num_speakers;
-    sv_speaker_entry_t* entry = &handle->speakers_db[new_idx];
+    // 다음 snapshot을 만들어 수정한 뒤 교체 (판정 중인 reader는 이전 snapshot을 계속 사용)
+    sv_db_t* db = _db_begin_write(handle);
+    if (!db) {
+        LOG_E(TAG, "Failed to allocate DB snapshot");
+        return SV_ERROR;
+    }
+    sv_status_t status = SV_SUCCESS;
+    int speaker_id = handle->next_speaker_id;
 
-    // 새 ID 할당 (단순 순차 증가)
-    entry->speaker_id = new_idx; 
-    
-    strncpy(entry->speaker_name, name, SV_MAX_NAME_LEN - 1);
-    entry->speaker_name[SV_MAX_NAME_LEN - 1] = '\0'; // 널 종료 보장
-    
-    memcpy(entry->embedding, new_embedding, sizeof(float) * SV_EMBEDDING_DIM);
+    // 영구 저장소: backend가 변환한 임베딩을 journal에 추가한 뒤 매핑된 record를 그대로 DB 행으로 사용
+    if (handle->store) {
+        float normalized[SV_MAX_EMBEDDING_DIM];
+        handle->backend->enroll(handle, new_embedding, normalized);
+
+        // 저장소가 살아 있는 화자로 가득 차도 삭제할 수 있도록 DEL record 한 자리를 남겨 둠
+        if (_reserve_store_slots(handle, db, 2) != SV_SUCCESS) {
+            LOG_E(TAG, "Speaker store is full. Cannot register new speaker.");
+            status = SV_DB_FULL;
+        } else {
+            status = sv_store_append_add(handle->store, speaker_id, name, normalized, handle->settings.model_hash);
+            _apply_store_record(handle, db, handle->store->used - 1); // 쓰기 실패 시 삭제된 행으로 반영됨
+            if (status != SV_SUCCESS) {
+                LOG_E(TAG, "Failed to write speaker record");
+            } else {
+                _ivf_add_row(handle, db, handle->store->used - 1);
+            }
+        }
+    } else {
+        // 새 ID 할당 (단순 순차 증가, 행 번호와 무관하게 유지)
+        int row = _add_ram_speaker(handle, db, speaker_id, name, new_embedding);
+        if (row == -1) {
+            LOG_E(TAG, "Out of memory. Cannot register new speaker.");
+            status = SV_DB_FULL;
+        } else {
+            handle->next_speaker_id++;
+            _ivf_add_row(handle, db, row);
+        }
+    }
 
-    handle->num_speakers++;
-    LOG_I(TAG, "Registered new speaker: %s (ID: %d)", name, entry->speaker_id);
+    _db_publish(handle, db);
+    pthread_mutex_unlock(&handle->write_lock);
 
-    return SV_SUCCESS;
+    if (status == SV_SUCCESS) {
+        LOG_I(TAG, "Registered new speaker: %s (ID: %d)", name, speaker_id);
+    }
+    return status;
 }
 
-void sv_system_reset_state(sv_handle_t* handle) {
-    if (!handle) return;
-    
-    // sv_internal_state_t 구조체 전체를 0으로 초기화
-    memset(&handle->state, 0, sizeof(sv_internal_state_t));
+sv_status_t sv_system_unregister(sv_handle_t* handle, int speaker_id) {
+    if (!handle) return SV_ERROR;
 
-    // -1이 기본값이어야 하는 변수들만 다시 설정
-    handle->state.last_speaker_id = -1;
-    
-    for(int i=0; i < SV_VOTING_WINDOW_SIZE; ++i) {
-        handle->state.history_buffer[i] = -1; // -1 (unknown)으로 초기화
+    sv_db_t* db = _db_begin_write(handle);
+    if (!db) {
+        LOG_E(TAG, "Failed to allocate DB snapshot");
+        return SV_ERROR;
     }
-}
 
-sv_result_t sv_system_verify(sv_handle_t* handle, float* current_embedding) {
-    sv_result_t result;
-    memset(&result, 0, sizeof(sv_result_t));
-    result.raw_speaker_id = -1;
-    result.final_speaker_id = -1; // -1 = 판정 보류/결과 없음
-    result.best_score = 0.0f;
-
-    if (!handle || handle->num_speakers == 0) {
-        // (로그를 너무 자주 찍지 않도록 주석 처리)
-        // LOG_E(TAG, "Handle is null or no speakers are registered.");
-        return result;
+    int row = _find_row(db, speaker_id);
+    if (row == -1 && handle->store && speaker_id >= 0 && _enroll_find(handle, speaker_id)) {
+        // 다른 모델로 등록된 저장소 화자: record가 compaction에서 빠지도록 DEL record 기록
+        sv_status_t status = SV_ERROR;
+        if (_reserve_store_slots(handle, db, 1) != SV_SUCCESS) {
+            LOG_E(TAG, "Speaker store is full. Cannot unregister speaker.");
+        } else {
+            status = sv_store_append_del(handle->store, speaker_id);
+            _apply_store_record(handle, db, handle->store->used - 1); // stale 목록에서도 제거
+            if (status != SV_SUCCESS) {
+                LOG_E(TAG, "Failed to write delete record");
+            }
+        }
+        _db_publish(handle, db);
+        pthread_mutex_unlock(&handle->write_lock);
+        if (status == SV_SUCCESS) {
+            LOG_I(TAG, "Unregistered speaker (ID: %d)", speaker_id);
+        }
+        return status;
+    }
+    if (row == -1) {
+        _db_free(db);
+        // 재임베딩을 기다리는 화자는 DB 행 없이 등록 특징만 있음
+        bool queued = _enroll_remove(handle, speaker_id);
+        pthread_mutex_unlock(&handle->write_lock);
+        if (queued) {
+            LOG_I(TAG, "Unregistered speaker (ID: %d)", speaker_id);
+        }
+        return queued ? SV_SUCCESS : SV_NOT_FOUND;
     }
 
-    // --- 1. 원시(Raw) 판정: DB의 모든 화자와 유사도 비교 ---
-    float best_score = -1.0f;
-    int best_speaker_id = -1;
+    sv_status_t status = SV_SUCCESS;
+    if (handle->store) {
+        if (_reserve_store_slots(handle, db, 1) != SV_SUCCESS) {
+            LOG_E(TAG, "Speaker store is full. Cannot unregister speaker.");
+            status = SV_ERROR;
+        } else {
+            status = sv_store_append_del(handle->store, speaker_id);
+            _apply_store_record(handle, db, handle->store->used - 1);
+            if (status != SV_SUCCESS) {
+                LOG_E(TAG, "Failed to write delete record");
+            }
+        }
+    } else {
+        // 화자의 모든 template 행을 삭제 (DB 이미지는 template 정보 없음)
+        for (int r = row; r != -1; r = db->templates ? db->templates[r].next : -1) {
+            _kill_row(db, r);
+            if (r != row) {
+                db->num_templates--;
+            }
+        }
+        _enroll_remove(handle, speaker_id);
+    }
 
-    for (int i = 0; i < handle->num_speakers; ++i) {
-        // [Private 함수 호출]
-        float score = sv_cosine_similarity(current_embedding, handle->speakers_db[i].embedding, SV_EMBEDDING_DIM);
-        
-        if (score > best_score) {
-            best_score = score;
-            best_speaker_id = handle->speakers_db[i].speaker_id;
+    // 판정 task의 후처리 상태가 삭제된 행을 가리키지 않도록 (다음 판정에서 초기화)
+    db->layout_id++;
+    _db_publish(handle, db);
+    if (handle->pool) {
+        // 게시 이전 snapshot의 reader가 모두 나간 뒤 재사용
+        for (int r = row; r != -1; r = db->templates[r].next) {
+            _db_retire_row(handle, r);
         }
     }
 
-    result.best_score = best_score;
+    // 삭제된 행이 chunk 하나 이상 쌓이면 compaction (등록보다 삭제가 많은 경우)
+    if (handle->pool && db->num_dead >= SV_DB_CHUNK_ROWS) {
+        _compact_rows(handle);
+    }
+    pthread_mutex_unlock(&handle->write_lock);
 
-    // --- 2. 임계값(민감도) 체크 ---
-    if (best_score >= handle->settings.threshold) {
-        result.raw_speaker_id = best_speaker_id;
-    } else {
-        result.raw_speaker_id = -1; // "Unknown"
+    if (status == SV_SUCCESS) {
+        LOG_I(TAG, "Unregistered speaker (ID: %d)", speaker_id);
     }
+    return status;
+}
 
-    // --- 3. 후처리 판정 알고리즘 적용 ---
-    sv_internal_state_t* state = &handle->state;
+sv_status_t sv_system_add_template(sv_handle_t* handle, int speaker_id, const float* embedding) {
+    if (!handle || !embedding) return SV_ERROR;
+    if (!handle->pool) {
+        LOG_E(TAG, "Templates can be added to RAM DB only");
+        return SV_ERROR;
+    }
 
-    switch (handle->settings.algorithm) {
-        case POST_CONSECUTIVE:
-            if (result.raw_speaker_id != -1 && result.raw_speaker_id == state->last_speaker_id) {
-                state->consecutive_count++;
-            } else {
-                state->last_speaker_id = result.raw_speaker_id;
-                state->consecutive_count = 1;
-            }
+    // 등록 발화는 신뢰하므로 이상치 판정 없이 반영 (template이 가득 차면 가장 가까운 template에 합침)
+    return _template_update(handle, speaker_id, embedding, false);
+}
 
-            if (state->consecutive_count >= 2) {
-                result.final_speaker_id = state->last_speaker_id;
-                // 판정 후 상태 초기화
-                state->last_speaker_id = -1; 
-                state->consecutive_count = 0;
-            }
-            break;
+sv_status_t sv_system_add_features(sv_handle_t* handle, int speaker_id, const float* features,
+                                   int num_frames, int num_bins) {
+    if (!handle || !features) return SV_ERROR;
+    if (!handle->pool) {
+        LOG_E(TAG, "Enrollment features are kept for RAM DB only");
+        return SV_ERROR;
+    }
 
-        case POST_MAJORITY_VOTING:
-            // 1. 현재 판정 결과를 히스토리 버퍼(Ring Buffer)에 추가
-            state->history_buffer[state->history_index] = result.raw_speaker_id;
-            state->history_index = (state->history_index + 1) % SV_VOTING_WINDOW_SIZE;
-            
-            if (state->history_count < SV_VOTING_WINDOW_SIZE) {
-                state->history_count++;
-            }
-
-            // 2. 윈도우가 가득 찼을 때만 판정 수행
-            if (state->history_count == SV_VOTING_WINDOW_SIZE) {
-                // [Private 함수 호출]
-                int majority_id = sv_find_majority(handle);
-                
-                result.final_speaker_id = majority_id; // -1일 수도 있음
-                
-                // 판정 후 윈도우 초기화
-                sv_system_reset_state(handle); 
-            }
-            break;
+    // 인코딩은 잠금 밖에서 (등록/재임베딩을 막지 않도록)
+    sv_features_t* utt = sv_features_encode(features, num_frames, num_bins);
+    if (!utt) {
+        return SV_DB_FULL;
+    }
 
-        case POST_NONE:
-        default:
-            result.final_speaker_id = result.raw_speaker_id;
-            break;
+    pthread_mutex_lock(&handle->write_lock);
+    const sv_db_t* db = atomic_load(&handle->db); // 게시된 snapshot은 writer만 교체하므로 잠금 상태에서 직접 읽음
+    int row = _find_row(db, speaker_id);
+    sv_enroll_t* enroll = (row != -1) ? _enroll_find(handle, speaker_id) : NULL;
+    sv_status_t status = SV_SUCCESS;
+    if (row == -1) {
+        status = SV_NOT_FOUND;
+    } else if (enroll && enroll->num_utts >= SV_MAX_ENROLL_UTTS) {
+        LOG_E(TAG, "Speaker %d already has %d enrollment utterances", speaker_id, SV_MAX_ENROLL_UTTS);
+        status = SV_DB_FULL;
+    } else if (!enroll) {
+        enroll = (sv_enroll_t*)calloc(1, sizeof(sv_enroll_t));
+        if (!enroll) {
+            status = SV_DB_FULL;
+        } else {
+            enroll->speaker_id = speaker_id;
+            enroll->model_hash = db->speakers_db[row].model_hash;
+            enroll->next = handle->enrolls;
+            handle->enrolls = enroll;
+        }
     }
 
-    return result;
+    if (status == SV_SUCCESS) {
+        // 등록 순서 유지 (재임베딩 시 첫 발화로 화자를 다시 등록)
+        sv_features_t** tail = &enroll->utts;
+        while (*tail) {
+            tail = &(*tail)->next;
+        }
+        *tail = utt;
+        enroll->num_utts++;
+    }
+    pthread_mutex_unlock(&handle->write_lock);
+
+    if (status != SV_SUCCESS) {
+        sv_features_free(utt);
+    }
+    return status;
 }
 
+sv_status_t sv_system_set_model(sv_handle_t* handle, uint32_t model_hash) {
+    if (!handle || model_hash == 0) return SV_ERROR;
+    if (handle->image || handle->projection) {
+        LOG_E(TAG, "Model swap needs a RAM DB or store without projection (re-init the handle)");
+        return SV_ERROR;
+    }
+    if (handle->store) {
+        return _store_set_model(handle, model_hash);
+    }
+
+    sv_db_t* db = _db_begin_write(handle);
+    if (!db) {
+        LOG_E(TAG, "Failed to allocate DB snapshot");
+        return SV_ERROR;
+    }
+    if (model_hash == handle->settings.model_hash) {
+        _db_free(db);
+        pthread_mutex_unlock(&handle->write_lock);
+        return SV_SUCCESS;
+    }
+    int* killed = (int*)malloc(sizeof(int) * (db->num_speakers + 1));
+    if (!killed) {
+        _db_free(db);
+        pthread_mutex_unlock(&handle->write_lock);
+        return SV_ERROR;
+    }
+    handle->settings.model_hash = model_hash;
+    for (sv_enroll_t* e = handle->enrolls; e; e = e->next) {
+        e->failures = 0; // 새 모델로 다시 시도 (보류된 화자 포함)
+        e->backoff = 0;
+    }
 
-//=========================== tasks ===============================
-// (라이브러리 모듈이므로 Task를 직접 생성하지 않습니다.)
+    // 이전 모델의 행은 판정에서 제외 (등록 특징이 있는 화자는 이름을 보관하고 재임베딩 대기)
+    int num_killed = 0, queued = 0, removed = 0;
+    for (int r = 0; r < db->num_speakers; ++r) {
+        sv_speaker_entry_t* entry = &db->speakers_db[r];
+        if (entry->speaker_id == -1 || db->templates[r].lead != r || entry->model_hash == model_hash) {
+            continue;
+        }
+        sv_enroll_t* enroll = _enroll_find(handle, entry->speaker_id);
+        if (enroll) {
+            memcpy(enroll->speaker_name, entry->speaker_name, SV_MAX_NAME_LEN);
+            enroll->model_hash = 0; // DB 행 없음: 이후 어떤 모델로 바뀌어도 재임베딩 대기
+            queued++;
+        } else {
+            LOG_E(TAG, "Speaker %d has no enrollment features, re-enrollment required", entry->speaker_id);
+            removed++;
+        }
+        for (int t = r; t != -1; t = db->templates[t].next) {
+            _kill_row(db, t);
+            if (t != r) {
+                db->num_templates--;
+            }
+            killed[num_killed++] = t;
+        }
+    }
 
+    // cohort와 IVF 중심도 이전 모델의 임베딩 공간
+    if (db->num_cohort > 0) {
+        LOG_I(TAG, "AS-norm cohort cleared, set a cohort for the new model");
+        db->num_cohort = 0;
+    }
+    _ivf_rebuild(handle, db);
+    db->layout_id++;
+    _db_publish(handle, db);
+    for (int i = 0; i < num_killed; ++i) {
+        _db_retire_row(handle, killed[i]);
+    }
+    free(killed);
+    if (db->num_dead >= SV_DB_CHUNK_ROWS) {
+        _compact_rows(handle);
+    }
+    pthread_mutex_unlock(&handle->write_lock);
 
-//=========================== private ==============================
-// (이 C 파일 내부에서만 사용되는 'Private' 함수들의 실제 구현)
+    LOG_I(TAG, "Model changed (hash %08x): %d speakers queued for re-embedding, %d removed",
+          (unsigned)model_hash, queued, removed);
+    return SV_SUCCESS;
+}
 
-/**
- * @brief [Private] 두 임베딩 간의 코사인 유사도를 계산합니다.
- */
-static float sv_cosine_similarity(const float* emb1, const float* emb2, int dim) {
-    float dot_product = 0.0f;
-    float norm1 = 0.0f;
-    float norm2 = 0.0f;
+int sv_system_migrate_step(sv_handle_t* handle, sv_embed_fn_t embed, void* ctx) {
+    if (!handle || !embed) return 0;
+
+    pthread_mutex_lock(&handle->write_lock);
+    // backoff 중인 화자는 대기 횟수만 줄이고 건너뜀
+    sv_enroll_t* enroll = NULL;
+    for (sv_enroll_t* e = handle->enrolls; e && !enroll; e = e->next) {
+        if (!_enroll_pending(handle, e)) {
+            continue;
+        }
+        if (e->backoff > 0) {
+            e->backoff--;
+        } else {
+            enroll = e;
+        }
+    }
+    if (!enroll) {
+        int remaining = _count_stale(handle);
+        pthread_mutex_unlock(&handle->write_lock);
+        return remaining;
+    }
+    uint32_t model_hash = handle->settings.model_hash;
+    handle->migrating = enroll; // 그동안 삭제되어도 특징은 해제하지 않음
+    pthread_mutex_unlock(&handle->write_lock);
 
-    for (int i = 0; i < dim; ++i) {
-        dot_product += emb1[i] * emb2[i];
-        norm1 += emb1[i] * emb1[i];
-        norm2 += emb2[i] * emb2[i];
+    // 모델 추론(발화당 수백 ms)은 잠금 밖에서: 판정은 물론 등록/온라인 갱신도 기다리지 않음
+    int dim = handle->embedding_dim;
+    float* embeddings = (float*)malloc(sizeof(float) * dim * enroll->num_utts);
+    sv_status_t status = embeddings ? _migrate_embed(enroll, embed, ctx, dim, embeddings) : SV_DB_FULL;
+
+    pthread_mutex_lock(&handle->write_lock);
+    handle->migrating = NULL;
+    int speaker_id = enroll->speaker_id;
+    int num_utts = 0;
+    if (speaker_id == -1) {
+        _enroll_drop(handle, enroll); // 재임베딩 도중 삭제됨
+    } else if (model_hash == handle->settings.model_hash) { // 도중에 모델이 다시 바뀌었으면 다음 호출에서 다시 계산
+        // 같은 ID로 다시 등록 (첫 발화), 나머지 발화는 잠금을 놓은 뒤 template으로 추가
+        sv_db_t* db = (status == SV_SUCCESS) ? _db_copy(handle) : NULL;
+        int row = db ? _add_ram_speaker(handle, db, speaker_id, enroll->speaker_name, embeddings) : -1;
+        if (row == -1) {
+            // 일시적인 실패(메모리 부족, 추론 실패)일 수 있으므로 등록 특징은 보관하고 나중에 다시 시도
+            _db_free(db);
+            enroll->failures++;
+            if (enroll->failures >= SV_MIGRATE_MAX_RETRIES) {
+                LOG_E(TAG, "Re-embedding failed %d times, speaker %d on hold (sv_system_migrate_retry)",
+                      enroll->failures, speaker_id);
+            } else {
+                enroll->backoff = (uint16_t)((1u << enroll->failures) - 1);
+                LOG_E(TAG, "Re-embedding failed, speaker %d retried after %d steps", speaker_id, enroll->backoff);
+            }
+        } else {
+            _ivf_add_row(handle, db, row);
+            _db_publish(handle, db);
+            enroll->model_hash = model_hash;
+            enroll->failures = 0;
+            num_utts = enroll->num_utts;
+        }
     }
+    int remaining = _count_stale(handle);
+    pthread_mutex_unlock(&handle->write_lock);
 
-    // 0으로 나누기 방지
-    float denom = sqrtf(norm1) * sqrtf(norm2);
-    if (denom < 1e-6f) { // 1e-6 (float)
-        return 0.0f;
+    for (int u = 1; u < num_utts; ++u) {
+        _template_update(handle, speaker_id, &embeddings[(size_t)u * dim], false);
     }
+    free(embeddings);
 
-    return dot_product / denom;
+    if (num_utts > 0) {
+        LOG_I(TAG, "Re-embedded speaker %d (%d utterances), %d remaining", speaker_id, num_utts, remaining);
+    }
+    return remaining;
 }
 
-/**
- * @brief [Private] Majority Voting 윈도우에서 과반수 이상 등장한 화자를 찾습니다.
- */
-static int sv_find_majority(sv_handle_t* handle) {
-    // speaker_id가 0부터 SV_MAX_SPEAKERS-1 까지라고 가정
-    int speaker_counts[SV_MAX_SPEAKERS]; // 사용자가 설정한 40개 크기
-    memset(speaker_counts, 0, sizeof(speaker_counts));
-    
-    int unknown_count = 0;
+int sv_system_migrate_retry(sv_handle_t* handle) {
+    if (!handle) return 0;
 
-    for (int i = 0; i < handle->state.history_count; ++i) {
-        int id = handle->state.history_buffer[i];
-        if (id == -1) {
-            unknown_count++;
-        } else if (id < handle->num_speakers && id < SV_MAX_SPEAKERS) { // 유효한 ID인지 확인
-            speaker_counts[id]++;
+    pthread_mutex_lock(&handle->write_lock);
+    int count = 0;
+    for (sv_enroll_t* e = handle->enrolls; e; e = e->next) {
+        if (e->speaker_id != -1 && e->failures >= SV_MIGRATE_MAX_RETRIES) {
+            e->failures = 0;
+            e->backoff = 0;
+            count++;
         }
     }
+    pthread_mutex_unlock(&handle->write_lock);
+
+    if (count > 0) {
+        LOG_I(TAG, "%d speakers queued again for re-embedding", count);
+    }
+    return count;
+}
 
-    int majority_id = -1;
-    // 과반수 기준 (e.g., 9개 중 5개)
-    int majority_threshold = (handle->state.history_count / 2) + 1;
+sv_status_t sv_system_build_index(sv_handle_t* handle) {
+    if (!handle || handle->settings.ivf_lists <= 0) return SV_ERROR;
 
-    for (int i = 0; i < handle->num_speakers; ++i) {
-        if (speaker_counts[i] >= majority_threshold) {
-            majority_id = i; // i가 speaker_id와 동일
-            break;
-        }
+    sv_db_t* db = _db_begin_write(handle);
+    if (!db) {
+        LOG_E(TAG, "Failed to allocate DB snapshot");
+        return SV_ERROR;
     }
-    
-    return majority_id;
+    _ivf_rebuild(handle, db);
+    _db_publish(handle, db);
+    pthread_mutex_unlock(&handle->write_lock);
+    return SV_SUCCESS;
 }
 
-/**
- * @brief [Private] sv_database.h에 정의된 사전 등록 화자를 RAM DB로 복사합니다.
- */
-static void _load_preregistered_speakers(sv_handle_t* handle) {
-    // sv_database.h 에 정의된 전역 상수 배열을 사용
-    for (int i = 0; i < NUM_PRE_REGISTERED_SPEAKERS; ++i) {
-        if (handle->num_speakers >= handle->max_speakers) {
-            LOG_E(TAG, "Preregistered DB is larger than max_speakers (%d)", handle->max_speakers);
-            break;
+sv_status_t sv_system_set_cohort(sv_handle_t* handle, const float* cohort, int num_cohort) {
+    if (!handle || !cohort || handle->settings.score_norm != SV_NORM_ASNORM) return SV_ERROR;
+
+    if (num_cohort > handle->settings.cohort_size) {
+        LOG_E(TAG, "Cohort truncated to cohort_size (%d)", handle->settings.cohort_size);
+        num_cohort = handle->settings.cohort_size;
+    }
+
+    // 판정 중인 reader가 이전 cohort를 사용할 수 있으므로 새 버퍼에 기록한 뒤 교체
+    float* cohort_matrix = (float*)sv_aligned_alloc(sizeof(float) * handle->dim * handle->settings.cohort_size);
+    if (!cohort_matrix) {
+        LOG_E(TAG, "Failed to allocate cohort matrix");
+        return SV_ERROR;
+    }
+    for (int i = 0; i < num_cohort; ++i) {
+        handle->backend->enroll(handle, &cohort[(size_t)i * handle->embedding_dim], &cohort_matrix[i * handle->dim]);
+    }
+
+    sv_db_t* db = _db_begin_write(handle);
+    if (!db) {
+        sv_aligned_free(cohort_matrix);
+        return SV_ERROR;
+    }
+    float* old_cohort = db->cohort_matrix;
+    db->cohort_matrix = cohort_matrix;
+    db->num_cohort = num_cohort;
+
+    // 등록 화자 통계는 cohort가 바뀔 때만 다시 계산 (판정 시에는 쿼리 통계만 계산)
+    for (int i = 0; i < db->num_speakers; ++i) {
+        if (db->speakers_db[i].speaker_id != -1) {
+            _update_enroll_stats(handle, db, i);
         }
-        
-        const sv_preregistered_speaker_t* src = &PRE_REGISTERED_SPEAKERS[i];
-        sv_speaker_entry_t* dst = &handle->speakers_db[handle->num_speakers];
+    }
 
-        // ID가 중복되지 않도록 .h의 ID를 그대로 사용
-        dst->speaker_id = src->speaker_id; 
-        strncpy(dst->speaker_name, src->name, SV_MAX_NAME_LEN - 1);
-        dst->speaker_name[SV_MAX_NAME_LEN - 1] = '\0'; // 널 종료 보장
-        
-        memcpy(dst->embedding, src->embedding, sizeof(float) * SV_EMBEDDING_DIM);
+    _db_publish(handle, db);
+    _db_retire(handle, old_cohort, sv_aligned_free);
+    pthread_mutex_unlock(&handle->write_lock);
 
-        handle->num_speakers++;
+    LOG_I(TAG, "AS-norm cohort set: %d embeddings, top-%d", num_cohort, handle->settings.cohort_top_n);
+    return SV_SUCCESS;
+}
+
+sv_status_t sv_system_get_speaker_name(sv_handle_t* handle, int speaker_id, char* name) {
+    if (!handle || !name) return SV_ERROR;
+
+    const sv_db_t* db;
+    int slot = _reader_enter(handle, &db);
+    int row = _find_row(db, speaker_id);
+    if (row != -1) {
+        memcpy(name, db->speakers_db[row].speaker_name, SV_MAX_NAME_LEN);
+    }
+    _reader_exit(handle, slot);
+
+    return (row != -1) ? SV_SUCCESS : SV_NOT_FOUND;
+}
+
+sv_status_t sv_system_check_model(const sv_handle_t* handle, int output_size) {
+    if (!handle) return SV_ERROR;
+
+    if (output_size != handle->embedding_dim) {
+        LOG_E(TAG, "Model output size %d != embedding dim %d (set config.embedding_dim)",
+              output_size, handle->embedding_dim);
+        return SV_ERROR;
+    }
+    return SV_SUCCESS;
+}
+
+uint32_t sv_model_hash(const void* data, size_t size) {
+    const uint8_t* p = (const uint8_t*)data;
+    uint32_t hash = 2166136261u; // FNV-1a offset basis
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= p[i];
+        hash *= 16777619u;
     }
-}
\ No newline at end of file
+    return hash ? hash : 1;
+}
+
+void sv_system_reset_state(sv_handle_t* handle) {
+    if (!handle) return;
+    sv_session_reset(handle->session);
+}
+
+sv_result_t sv_system_verify(sv_handle_t* handle, float* current_embedding) {
+    return sv_system_verify_topk(handle, current_embedding, NULL, 0);
+}
+
+sv_result_t sv_system_verify_topk(sv_handle_t* handle, float* current_embedding,
+                                  sv_candidate_t* topk, int k) {
+    // 기본 세션으로 판정
+    return sv_session_verify(handle ? handle->session : NULL, current_embedding, topk, k);
+}
+
+sv_session_t* sv_session_create(sv_handle_t* handle) {
+    if (!handle) return NULL;
+
+    sv_session_t* session = (sv_session_t*)calloc(1, sizeof(sv_session_t));
+    if (!session) {
+        LOG_E(TAG, "Failed to allocate memory for session");
+        return NULL;
+    }
+    session->handle = handle;
+
+    // 작업 버퍼와 후처리 상태만 할당 (DB는 handle의 snapshot을 공유)
+    // 행별 버퍼는 chunk 하나 크기로 시작하여 DB가 커지면 판정 시 늘림
+    session->query = (float*)sv_aligned_alloc(sizeof(float) * handle->embedding_dim);
+    session->state.history_buffer = (int*)malloc(sizeof(int) * handle->settings.voting_window);
+    bool alloc_ok = session->query && session->state.history_buffer &&
+                    _session_reserve(session, SV_DB_CHUNK_ROWS) == SV_SUCCESS;
+    if (handle->settings.db_format == SV_DB_INT8) {
+        session->q_query = (int8_t*)sv_aligned_alloc(sizeof(int8_t) * handle->embedding_dim);
+        alloc_ok = alloc_ok && session->q_query;
+    }
+    if (handle->settings.score_norm == SV_NORM_ASNORM) {
+        session->cohort_scores = (float*)sv_aligned_alloc(sizeof(float) * handle->settings.cohort_size);
+        alloc_ok = alloc_ok && session->cohort_scores;
+    }
+    if (handle->settings.ivf_lists > 0) {
+        session->centroid_scores = (float*)sv_aligned_alloc(sizeof(float) * handle->settings.ivf_lists);
+        alloc_ok = alloc_ok && session->centroid_scores;
+    }
+    session->num_cand = -1;
+    if (!alloc_ok) {
+        LOG_E(TAG, "Failed to allocate memory for session");
+        sv_session_destroy(session);
+        return NULL;
+    }
+
+    sv_session_reset(session);
+    return session;
+}
+
+void sv_session_destroy(sv_session_t* session) {
+    if (session) {
+        sv_aligned_free(session->query);
+        sv_aligned_free(session->scores);
+        sv_aligned_free(session->q_query);
+        sv_aligned_free(session->q_acc);
+        sv_aligned_free(session->cohort_scores);
+        sv_aligned_free(session->centroid_scores);
+        free(session->cand_rows);
+        free(session->cand_scores);
+        free(session->cand_mark);
+        free(session->state.history_buffer);
+        free(session->state.vote_counts);
+        free(session->state.smoothed_scores);
+        free(session);
+    }
+}
+
+void sv_session_reset(sv_session_t* session) {
+    if (!session) return;
+    sv_handle_t* handle = session->handle;
+    sv_internal_state_t* state = &session->state;
+
+    // 카운터 초기화 (버퍼 포인터는 유지)
+    state->last_speaker_id = -1;
+    state->consecutive_count = 0;
+    state->history_index = 0;
+    state->history_count = 0;
+    state->majority_row = -1;
+    state->smoothed_rows = 0;
+    state->locked_row = -1;
+    state->leading_row = -1;
+    state->pending_id = -1;
+    state->decided_id = -1;
+    state->updated_id = -1;
+
+    for(int i=0; i < handle->settings.voting_window; ++i) {
+        state->history_buffer[i] = -1; // -1 (unknown)으로 초기화
+    }
+    memset(state->vote_counts, 0, sizeof(int) * session->capacity);
+}
+
+sv_result_t sv_session_verify(sv_session_t* session, float* current_embedding,
+                              sv_candidate_t* topk, int k) {
+    sv_result_t result;
+    k = _result_init(&result, topk, k);
+
+    if (!session) {
+        return result;
+    }
+#if SV_ENABLE_STATS
+    uint32_t t0 = _stats_now();
+#endif
+
+    // 현재 snapshot을 pin (판정 도중 등록/삭제가 게시되어도 이 snapshot은 해제되지 않음)
+    const sv_db_t* db;
+    int slot = _reader_enter(session->handle, &db);
+    bool scored = false;
+
+    // 행별 버퍼가 DB보다 작으면 늘림 (실패 시 이번 프레임은 판정 보류)
+    if (db->num_speakers > 0 && _session_reserve(session, db->num_speakers) == SV_SUCCESS) {
+        _session_sync_layout(session, db);
+
+        // --- 1. 원시(Raw) 판정: DB의 모든 화자와 유사도 비교 ---
+        // [Private 함수 호출] 쿼리 정규화 1회 + 행렬-벡터 곱 1회 (IVF 색인이 있으면 가까운 목록만,
+        // early-abandon은 topk 요청이 없고 최근 구간에서 충분히 포기했을 때만: topk는 모든 후보의 정확한 점수가 필요)
+        if (db->ivf) {
+            sv_score_ivf(session, db, current_embedding);
+        } else if (db->suffix_norms && k == 0 && _abandon_enabled(session)) {
+            sv_score_abandon(session, db, current_embedding);
+        } else {
+            sv_score_all(session, db, current_embedding);
+        }
+
+        // --- 2~3. 임계값/margin 체크 및 후처리 ---
+        sv_decide(session, db, topk, k, &result);
+        scored = (db->num_speakers > db->num_dead);
+    }
+    // else: (로그를 너무 자주 찍지 않도록 생략) 등록된 화자 없음
+
+    _reader_exit(session->handle, slot);
+#if SV_ENABLE_STATS
+    _stats_record(session, &result, scored, _stats_now() - t0);
+#else
+    (void)scored;
+#endif
+
+    // 온라인 template 갱신 (snapshot을 놓은 뒤 writer로 수행, 판정 구간마다 최대 한 번)
+    _template_feedback(session, &result, current_embedding);
+    return result;
+}
+
+sv_status_t sv_verify_sessions(sv_session_t* const* sessions, float* const* embeddings, int count,
+                               sv_result_t* results) {
+    if (!sessions || !embeddings || !results || count <= 0 || !sessions[0]) return SV_ERROR;
+
+    // 모든 세션이 같은 DB를 공유해야 한 번의 행렬-행렬 곱으로 계산 가능
+    sv_handle_t* handle = sessions[0]->handle;
+    for (int i = 0; i < count; ++i) {
+        if (!sessions[i] || sessions[i]->handle != handle) {
+            LOG_E(TAG, "Batched sessions must share one handle");
+            return SV_ERROR;
+        }
+        _result_init(&results[i], NULL, 0);
+    }
+
+#if SV_ENABLE_STATS
+    uint32_t t0 = _stats_now();
+#endif
+
+    // 배치 전체가 같은 snapshot으로 판정되도록 한 번만 pin
+    const sv_db_t* db;
+    int slot = _reader_enter(handle, &db);
+
+    sv_status_t status = SV_SUCCESS;
+    for (int i = 0; i < count && status == SV_SUCCESS; ++i) {
+        status = _session_reserve(sessions[i], db->num_speakers);
+    }
+
+    if (status == SV_SUCCESS && db->num_speakers > 0) {
+        for (int base = 0; base < count; base += SV_MAX_BATCH) {
+            int m = (count - base < SV_MAX_BATCH) ? count - base : SV_MAX_BATCH;
+            sv_verify_batch(handle, db, &sessions[base], &embeddings[base], m, &results[base]);
+        }
+    }
+    bool scored = (status == SV_SUCCESS && db->num_speakers > db->num_dead);
+
+    _reader_exit(handle, slot);
+#if SV_ENABLE_STATS
+    // 배치 소요 시간은 세션 수로 나누어 세션마다 기록
+    uint32_t per_session = (_stats_now() - t0) / (uint32_t)count;
+    for (int i = 0; i < count; ++i) {
+        _stats_record(sessions[i], &results[i], scored, per_session);
+    }
+#else
+    (void)scored;
+#endif
+
+    for (int i = 0; i < count; ++i) {
+        _template_feedback(sessions[i], &results[i], embeddings[i]);
+    }
+    return status;
+}
+
+sv_status_t sv_get_stats(sv_stats_t* out) {
+    if (!out) return SV_ERROR;
+#if SV_ENABLE_STATS
+    pthread_mutex_lock(&stats_lock);
+    *out = stats;
+    pthread_mutex_unlock(&stats_lock);
+    return SV_SUCCESS;
+#else
+    memset(out, 0, sizeof(sv_stats_t));
+    return SV_ERROR;
+#endif
+}
+
+void sv_reset_stats(void) {
+#if SV_ENABLE_STATS
+    pthread_mutex_lock(&stats_lock);
+    memset(&stats, 0, sizeof(sv_stats_t));
+    pthread_mutex_unlock(&stats_lock);
+#endif
+}
+
+
+//=========================== tasks ===============================
+// (라이브러리 모듈이므로 Task를 직접 생성하지 않습니다.)
+
+
+//=========================== private ==============================
+// (이 C 파일 내부에서만 사용되는 'Private' 함수들의 실제 구현)
+
+#if SV_ENABLE_STATS
+static uint32_t _stats_now(void) {
+#ifdef ESP_PLATFORM
+    return esp_cpu_get_cycle_count();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec);
+#endif
+}
+
+/**
+ * @brief [Private] 판정 1회를 통계에 반영합니다.
+ * 판정 지연은 세션별로 추적합니다: 최종 판정되지 않은 화자가 raw 판정되면 그 frame을 기록하고,
+ * 그 화자가 최종 판정되면 경과 hop 수를 알고리즘별 히스토그램에 더합니다. (POST_NONE은 항상 0 hop)
+ * 최종 판정 전에 다른 화자가 raw 판정되면 이전 화자는 dropped로 셉니다.
+ * 같은 화자가 계속 판정되는 동안은 다시 세지 않으며, raw/최종 판정이 모두 없는 frame에서 초기화합니다.
+ */
+static void _stats_record(sv_session_t* session, const sv_result_t* result, bool scored, uint32_t cycles) {
+    sv_internal_state_t* state = &session->state;
+    int algo = (int)session->handle->settings.algorithm;
+    int raw = result->raw_speaker_id;
+    int final = result->final_speaker_id;
+    uint32_t frame = state->frame++;
+
+    // 세션 상태는 해당 세션의 판정 task만 접근하므로 잠금 밖에서 갱신
+    bool dropped = false;
+    int hops = -1;
+    if (raw != -1 && raw != state->pending_id && raw != state->decided_id) {
+        dropped = (state->pending_id != -1);
+        state->pending_id = raw;
+        state->pending_frame = frame;
+    }
+    if (final != -1) {
+        if (final == state->pending_id) {
+            hops = (int)(frame - state->pending_frame);
+            state->pending_id = -1;
+        }
+        state->decided_id = final;
+    } else if (raw == -1) {
+        state->decided_id = -1;
+    }
+
+    pthread_mutex_lock(&stats_lock);
+    if (stats.num_verify == 0 || cycles < stats.min_cycles) {
+        stats.min_cycles = cycles;
+    }
+    if (cycles > stats.max_cycles) {
+        stats.max_cycles = cycles;
+    }
+    stats.num_verify++;
+    stats.total_cycles += cycles;
+
+    if (scored) {
+        float pos = (result->best_score - SV_STATS_SCORE_MIN) * SV_STATS_SCORE_BINS /
+                    (SV_STATS_SCORE_MAX - SV_STATS_SCORE_MIN);
+        if (pos < 0.0f) {
+            stats.score_below++;
+        } else if (pos >= SV_STATS_SCORE_BINS) {
+            stats.score_above++;
+        } else {
+            stats.score_hist[(int)pos]++;
+        }
+    }
+
+    if (algo >= 0 && algo < SV_NUM_POST_ALGOS) {
+        if (dropped) {
+            stats.dropped[algo]++;
+        }
+        if (hops >= 0) {
+            stats.decisions[algo]++;
+            stats.total_hops[algo] += (uint64_t)hops;
+            stats.hop_hist[algo][(hops < SV_STATS_MAX_HOPS) ? hops : SV_STATS_MAX_HOPS - 1]++;
+        }
+    }
+    pthread_mutex_unlock(&stats_lock);
+}
+#endif
+
+static int _result_init(sv_result_t* result, sv_candidate_t* topk, int k) {
+    memset(result, 0, sizeof(sv_result_t));
+    result->raw_speaker_id = -1;
+    result->final_speaker_id = -1; // -1 = 판정 보류/결과 없음
+    result->best_score = 0.0f;
+    result->second_speaker_id = -1;
+    result->second_score = 0.0f;
+
+    if (k > SV_MAX_TOPK) {
+        k = SV_MAX_TOPK;
+    }
+    for (int i = 0; i < k; ++i) {
+        topk[i].speaker_id = -1;
+        topk[i].score = -1.0f;
+    }
+    return k;
+}
+
+static void _session_sync_layout(sv_session_t* session, const sv_db_t* db) {
+    if (session->state.layout_id != db->layout_id) {
+        sv_session_reset(session);
+        session->state.layout_id = db->layout_id;
+    }
+}
+
+/**
+ * @brief [Private] 세션의 행별 버퍼를 rows 행 이상으로 늘립니다. (chunk 단위, 줄이지 않음)
+ * 점수 버퍼는 매 판정마다 다시 채워지므로 복사하지 않고, 후처리 상태는 기존 행의 값을 유지합니다.
+ */
+static sv_status_t _session_reserve(sv_session_t* session, int rows) {
+    if (rows <= session->capacity) {
+        return SV_SUCCESS;
+    }
+    int capacity = (rows + SV_DB_CHUNK_ROWS - 1) & ~(SV_DB_CHUNK_ROWS - 1);
+    sv_internal_state_t* state = &session->state;
+
+    float* scores = (float*)sv_aligned_alloc(sizeof(float) * capacity);
+    int32_t* q_acc = NULL;
+    if (session->handle->settings.db_format == SV_DB_INT8) {
+        q_acc = (int32_t*)sv_aligned_alloc(sizeof(int32_t) * capacity);
+    }
+    int* vote_counts = (int*)realloc(state->vote_counts, sizeof(int) * capacity);
+    if (vote_counts) {
+        state->vote_counts = vote_counts;
+    }
+    float* smoothed = (float*)realloc(state->smoothed_scores, sizeof(float) * capacity);
+    if (smoothed) {
+        state->smoothed_scores = smoothed;
+    }
+    bool cand_ok = true;
+    if (session->handle->settings.ivf_lists > 0) {
+        int* cand_rows = (int*)realloc(session->cand_rows, sizeof(int) * capacity);
+        if (cand_rows) session->cand_rows = cand_rows;
+        float* cand_scores = (float*)realloc(session->cand_scores, sizeof(float) * capacity);
+        if (cand_scores) session->cand_scores = cand_scores;
+        uint32_t* cand_mark = (uint32_t*)realloc(session->cand_mark, sizeof(uint32_t) * capacity);
+        if (cand_mark) {
+            session->cand_mark = cand_mark;
+            memset(cand_mark + session->capacity, 0, sizeof(uint32_t) * (capacity - session->capacity));
+        }
+        cand_ok = cand_rows && cand_scores && cand_mark;
+    }
+    if (!scores || !vote_counts || !smoothed || !cand_ok ||
+        (session->handle->settings.db_format == SV_DB_INT8 && !q_acc)) {
+        LOG_E(TAG, "Failed to grow session buffers to %d rows", capacity);
+        sv_aligned_free(scores);
+        sv_aligned_free(q_acc);
+        return SV_ERROR;
+    }
+
+    memset(vote_counts + session->capacity, 0, sizeof(int) * (capacity - session->capacity));
+    sv_aligned_free(session->scores);
+    sv_aligned_free(session->q_acc);
+    session->scores = scores;
+    session->q_acc = q_acc;
+    session->capacity = capacity;
+    return SV_SUCCESS;
+}
+
+/**
+ * @brief [Private] 세션 점수로 raw 판정을 내리고 후처리 알고리즘을 적용합니다.
+ * (session->scores는 pin된 snapshot db로 계산되어 있어야 함)
+ */
+static void sv_decide(sv_session_t* session, const sv_db_t* db,
+                      sv_candidate_t* topk, int k, sv_result_t* result) {
+    sv_handle_t* handle = session->handle;
+    const float* scores = session->scores;
+
+    // 다중 template: 이후 판정과 후처리는 화자당 한 행(lead)의 합친 점수만 사용
+    if (db->num_templates > 0) {
+        _merge_template_scores(session, db);
+    }
+
+    // 상위 후보 부분 선택 (최소 2개: 1위와 2위의 margin 판정용, IVF는 점수를 계산한 후보 중에서)
+    int idx[SV_MAX_TOPK];
+    int num_sel;
+    if (session->num_cand >= 0) {
+        num_sel = sv_select_topk(session->cand_scores, session->num_cand, (k > 2) ? k : 2, idx);
+        for (int i = 0; i < num_sel; ++i) {
+            idx[i] = session->cand_rows[idx[i]];
+        }
+    } else {
+        num_sel = sv_select_topk(scores, db->num_speakers, (k > 2) ? k : 2, idx);
+    }
+
+    // 삭제된 행은 후보에서 제외 (점수가 가장 낮으므로 뒤쪽에만 위치)
+    while (num_sel > 0 && scores[idx[num_sel - 1]] <= SV_SCORE_INVALID) {
+        num_sel--;
+    }
+    if (num_sel == 0) {
+        return;
+    }
+
+    for (int i = 0; i < k && i < num_sel; ++i) {
+        topk[i].speaker_id = db->speakers_db[idx[i]].speaker_id;
+        topk[i].score = scores[idx[i]];
+    }
+
+    float best_score = scores[idx[0]];
+    int best_speaker_id = db->speakers_db[idx[0]].speaker_id;
+
+    result->best_score = best_score;
+    if (num_sel > 1) {
+        result->second_speaker_id = db->speakers_db[idx[1]].speaker_id;
+        result->second_score = scores[idx[1]];
+    }
+
+    // --- 2. 임계값(민감도) 및 margin 체크 ---
+    bool margin_ok = (num_sel < 2) ||
+                     (best_score - result->second_score >= handle->settings.margin);
+
+    int raw_row = -1; // raw 판정된 화자의 DB 행 (-1: Unknown)
+    if (best_score >= handle->settings.threshold && margin_ok) {
+        result->raw_speaker_id = best_speaker_id;
+        raw_row = idx[0];
+    } else {
+        result->raw_speaker_id = -1; // "Unknown"
+    }
+
+    // --- 3. 후처리 판정 알고리즘 적용 ---
+    sv_internal_state_t* state = &session->state;
+
+    switch (handle->settings.algorithm) {
+        case POST_CONSECUTIVE:
+            if (result->raw_speaker_id != -1 && result->raw_speaker_id == state->last_speaker_id) {
+                state->consecutive_count++;
+            } else {
+                state->last_speaker_id = result->raw_speaker_id;
+                state->consecutive_count = 1;
+            }
+
+            if (state->consecutive_count >= 2) {
+                result->final_speaker_id = state->last_speaker_id;
+                // 판정 후 상태 초기화
+                state->last_speaker_id = -1; 
+                state->consecutive_count = 0;
+            }
+            break;
+
+        case POST_MAJORITY_VOTING: {
+            // 1. 현재 판정 결과(DB 행)를 윈도우에 넣고 가장 오래된 항목을 제거 (증분 갱신)
+            int majority_row = sv_vote_push(session, raw_row);
+
+            // 2. 윈도우가 찬 뒤에는 매 프레임 판정 (윈도우를 비우지 않고 sliding)
+            if (state->history_count == handle->settings.voting_window && majority_row != -1) {
+                result->final_speaker_id = db->speakers_db[majority_row].speaker_id;
+            }
+            break;
+        }
+
+        case POST_SCORE_SMOOTHING: {
+            // 판정 유지 중인 화자가 있으면 매 프레임 그 화자를 반환
+            int locked_row = sv_smooth_update(session, db);
+            if (locked_row != -1) {
+                result->final_speaker_id = db->speakers_db[locked_row].speaker_id;
+            }
+            break;
+        }
+
+        case POST_NONE:
+        default:
+            result->final_speaker_id = result->raw_speaker_id;
+            break;
+    }
+}
+
+/**
+ * @brief [Private] 여러 세션의 쿼리를 한 번에 판정합니다.
+ * 쿼리를 모두 정규화한 뒤 DB 행렬을 행 블록 단위로 한 번만 읽으며 모든 쿼리의 점수를 계산하고,
+ * 이후 점수 보정과 후처리는 세션별로 수행합니다.
+ */
+static void sv_verify_batch(sv_handle_t* handle, const sv_db_t* db, sv_session_t* const* sessions,
+                            float* const* embeddings, int count, sv_result_t* results) {
+    const float* queries[SV_MAX_BATCH];
+    float* outs[SV_MAX_BATCH];
+    const int8_t* q_queries[SV_MAX_BATCH];
+    int32_t* q_outs[SV_MAX_BATCH];
+
+    // IVF: 세션마다 탐색하는 목록이 다르므로 세션별로 판정
+    if (db->ivf) {
+        for (int i = 0; i < count; ++i) {
+            _session_sync_layout(sessions[i], db);
+            sv_score_ivf(sessions[i], db, embeddings[i]);
+            sv_decide(sessions[i], db, NULL, 0, &results[i]);
+        }
+        return;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        sv_session_t* session = sessions[i];
+        _session_sync_layout(session, db);
+        handle->backend->query(handle, embeddings[i], session->query, &session->q_bias);
+        queries[i] = session->query;
+        session->num_cand = -1;
+    }
+    if (handle->settings.db_format == SV_DB_INT8) {
+        for (int i = 0; i < count; ++i) {
+            sv_session_t* session = sessions[i];
+            sv_quantize_s8(session->query, session->q_query, handle->dim, &session->q_scale);
+            q_queries[i] = session->q_query;
+        }
+    }
+
+    // chunk마다 모든 쿼리의 점수를 계산 (chunk 안의 행은 연속)
+    for (int r0 = 0; r0 < db->num_speakers; r0 += SV_DB_CHUNK_ROWS) {
+        int rows = db->num_speakers - r0;
+        if (rows > SV_DB_CHUNK_ROWS) rows = SV_DB_CHUNK_ROWS;
+        const void* chunk = db->chunks[r0 >> SV_DB_CHUNK_SHIFT];
+
+        if (handle->settings.db_format == SV_DB_INT8) {
+            for (int i = 0; i < count; ++i) {
+                q_outs[i] = sessions[i]->q_acc + r0;
+            }
+            sv_matmat_s8((const int8_t*)chunk, db->emb_stride, q_queries, count,
+                         handle->dim, rows, q_outs);
+        } else {
+            for (int i = 0; i < count; ++i) {
+                outs[i] = sessions[i]->scores + r0;
+            }
+            if (handle->settings.db_format == SV_DB_FP16) {
+                sv_matmat_f16((const uint16_t*)chunk, db->emb_stride, queries, count,
+                              handle->dim, rows, outs);
+            } else {
+                sv_matmat_f32((const float*)chunk, db->emb_stride, queries, count,
+                              handle->dim, rows, outs);
+            }
+        }
+    }
+
+    for (int i = 0; i < count; ++i) {
+        _finish_scores(sessions[i], db);
+        sv_decide(sessions[i], db, NULL, 0, &results[i]);
+    }
+}
+
+/**
+ * @brief [Private] 현재 임베딩과 DB의 모든 화자 간 점수를 계산합니다.
+ * DB 행렬은 등록 시 backend로 변환되어 있으므로, 쿼리만 한 번 변환한 뒤
+ * chunk마다 행렬-벡터 곱으로 session->scores[0..num_speakers-1]을 채웁니다. (O(N·D))
+ * (cosine: 정규화된 행과 쿼리의 코사인 유사도, PLDA: 내적 + 상수 항 = 로그 우도비)
+ */
+static void sv_score_all(sv_session_t* session, const sv_db_t* db, const float* current_embedding) {
+    sv_handle_t* handle = session->handle;
+    handle->backend->query(handle, current_embedding, session->query, &session->q_bias);
+    session->num_cand = -1;
+
+    if (handle->settings.db_format == SV_DB_INT8) {
+        sv_quantize_s8(session->query, session->q_query, handle->dim, &session->q_scale);
+    }
+
+    for (int r0 = 0; r0 < db->num_speakers; r0 += SV_DB_CHUNK_ROWS) {
+        int rows = db->num_speakers - r0;
+        if (rows > SV_DB_CHUNK_ROWS) rows = SV_DB_CHUNK_ROWS;
+        const void* chunk = db->chunks[r0 >> SV_DB_CHUNK_SHIFT];
+
+        if (handle->settings.db_format == SV_DB_INT8) {
+            sv_matvec_s8((const int8_t*)chunk, db->emb_stride, session->q_query,
+                         handle->dim, rows, session->q_acc + r0);
+        } else if (handle->settings.db_format == SV_DB_FP16) {
+            sv_matvec_f16((const uint16_t*)chunk, db->emb_stride, session->query,
+                          handle->dim, rows, session->scores + r0);
+        } else {
+            sv_matvec_f32((const float*)chunk, db->emb_stride, session->query,
+                          handle->dim, rows, session->scores + r0);
+        }
+    }
+
+    _finish_scores(session, db);
+}
+
+/**
+ * @brief [Private] IVF 색인으로 후보 행만 점수를 계산합니다.
+ * 쿼리와 가장 가까운 중심 ivf_probe개의 목록, 색인 이후 추가된 행, 판정 유지 중인 행(score smoothing)을
+ * 후보로 모은 뒤, 각 후보를 원래 DB 행으로 정확히 계산합니다. (int8도 float 쿼리로 계산)
+ * 점수는 session->cand_scores와 session->scores[행]에 기록되며, 후보가 아닌 행의 scores는 사용하지 않습니다.
+ */
+static void sv_score_ivf(sv_session_t* session, const sv_db_t* db, const float* current_embedding) {
+    sv_handle_t* handle = session->handle;
+    const sv_ivf_t* ivf = db->ivf;
+    handle->backend->query(handle, current_embedding, session->query, &session->q_bias);
+
+    // 중복 제거 표시 (번호가 한 바퀴 돌면 초기화)
+    if (++session->cand_stamp == 0) {
+        memset(session->cand_mark, 0, sizeof(uint32_t) * session->capacity);
+        session->cand_stamp = 1;
+    }
+    session->num_cand = 0;
+
+    int lists[SV_MAX_IVF_PROBE];
+    int num_lists = sv_ivf_probe(ivf, session->query, handle->settings.ivf_probe,
+                                 session->centroid_scores, lists);
+    for (int l = 0; l < num_lists; ++l) {
+        for (int j = ivf->offsets[lists[l]]; j < ivf->offsets[lists[l] + 1]; ++j) {
+            _add_candidate(session, db, ivf->rows[j]);
+        }
+    }
+    for (int j = 0; j < db->num_pending; ++j) {
+        _add_candidate(session, db, db->ivf_pending[j]);
+    }
+    if (handle->settings.algorithm == POST_SCORE_SMOOTHING) {
+        // hysteresis 해제 판단과 다음 판정 후보 (선형 탐색처럼 평활 점수가 높은 행이 계속 감쇠되도록)
+        if (session->state.locked_row != -1) {
+            _add_candidate(session, db, session->state.locked_row);
+        }
+        if (session->state.leading_row != -1) {
+            _add_candidate(session, db, session->state.leading_row);
+        }
+    }
+
+    float q_mean = 0.0f, q_std = 1.0f;
+    bool asnorm = (handle->settings.score_norm == SV_NORM_ASNORM && db->num_cohort > 0);
+    if (asnorm) {
+        sv_cohort_stats(handle, db, session->query, session->cohort_scores, &q_mean, &q_std);
+    }
+
+    for (int j = 0; j < session->num_cand; ++j) {
+        int r = session->cand_rows[j];
+        const void* row = sv_db_row(db, r);
+        float s;
+        if (handle->settings.db_format == SV_DB_INT8) {
+            s = sv_dot_f32_s8(session->query, (const int8_t*)row, handle->dim) * db->q_scales[r];
+        } else if (handle->settings.db_format == SV_DB_FP16) {
+            sv_matvec_f16((const uint16_t*)row, db->emb_stride, session->query, handle->dim, 1, &s);
+        } else {
+            sv_matvec_f32((const float*)row, db->emb_stride, session->query, handle->dim, 1, &s);
+        }
+        if (db->row_scales) {
+            s *= db->row_scales[r];
+        }
+        s = _row_score(session, db, r, s, q_mean, q_std, asnorm);
+        session->cand_scores[j] = s;
+        session->scores[r] = s;
+    }
+}
+
+static void _add_candidate(sv_session_t* session, const sv_db_t* db, int row) {
+    if (session->cand_mark[row] == session->cand_stamp || db->speakers_db[row].speaker_id == -1) {
+        return;
+    }
+    if (db->num_templates > 0) {
+        // 다중 template: 화자 점수는 모든 template으로 계산하므로 화자의 template을 함께 추가
+        for (int r = db->templates[row].lead; r != -1; r = db->templates[r].next) {
+            session->cand_mark[r] = session->cand_stamp;
+            session->cand_rows[session->num_cand++] = r;
+        }
+        return;
+    }
+    session->cand_mark[row] = session->cand_stamp;
+    session->cand_rows[session->num_cand++] = row;
+}
+
+/**
+ * @brief [Private] 블록 단위로 내적을 누적하며 각 블록 뒤에 남은 블록의 Cauchy-Schwarz 상한
+ * dot + |row[b..]| * |q[b..]|을 최종 점수로 바꿔 cutoff = max(threshold, 현재 최고 점수) - margin과 비교하고,
+ * 상한이 cutoff 미만인 행은 남은 블록을 계산하지 않습니다. (행 suffix norm은 등록 시 계산한 suffix_norms)
+ * cutoff 미만인 행은 1위가 될 수도, 판정된 1위의 margin 판정을 바꿀 수도 없으므로 raw 판정은 sv_score_all과 같습니다.
+ * 포기한 행의 점수는 포기 시점의 상한입니다.
+ * chunk마다 첫 블록은 모든 행을 한 번에 계산하고, 이후 블록은 남은 행만 계산합니다.
+ * 실제로 계산한 원소 비율을 session->abandon_work에 누적합니다. (_abandon_enabled)
+ */
+static void sv_score_abandon(sv_session_t* session, const sv_db_t* db, const float* current_embedding) {
+    sv_handle_t* handle = session->handle;
+    handle->backend->query(handle, current_embedding, session->query, &session->q_bias);
+    session->num_cand = -1;
+
+    float q_mean = 0.0f, q_std = 1.0f;
+    bool asnorm = (handle->settings.score_norm == SV_NORM_ASNORM && db->num_cohort > 0);
+    if (asnorm) {
+        sv_cohort_stats(handle, db, session->query, session->cohort_scores, &q_mean, &q_std);
+    }
+
+    int dim = handle->dim;
+    int block = handle->abandon_block;
+    float q_suffix[SV_ABANDON_BLOCKS];
+    _suffix_norms(session->query, dim, block, q_suffix);
+
+    float threshold = handle->settings.threshold;
+    float margin = (handle->settings.margin > 0.0f) ? handle->settings.margin : 0.0f;
+    bool fp16 = (handle->settings.db_format == SV_DB_FP16);
+    float best = SV_SCORE_INVALID;
+    size_t work = 0, total = 0; // 계산한 원소 수 / 살아 있는 행을 모두 계산했을 때의 원소 수
+
+    for (int r0 = 0; r0 < db->num_speakers; r0 += SV_DB_CHUNK_ROWS) {
+        int rows = db->num_speakers - r0;
+        if (rows > SV_DB_CHUNK_ROWS) rows = SV_DB_CHUNK_ROWS;
+        const void* chunk = db->chunks[r0 >> SV_DB_CHUNK_SHIFT];
+        float* dots = session->scores + r0; // 누적 내적 (행 scale 반영), 끝나면 최종 점수로 덮어씀
+
+        // 첫 블록: chunk의 모든 행을 한 번에
+        int len = (dim < block) ? dim : block;
+        if (fp16) {
+            sv_matvec_f16((const uint16_t*)chunk, db->emb_stride, session->query, len, rows, dots);
+        } else {
+            sv_matvec_f32((const float*)chunk, db->emb_stride, session->query, len, rows, dots);
+        }
+        int alive[SV_DB_CHUNK_ROWS];
+        int num_alive = 0;
+        for (int i = 0; i < rows; ++i) {
+            if (db->speakers_db[r0 + i].speaker_id == -1) {
+                dots[i] = SV_SCORE_INVALID;
+                continue;
+            }
+            if (db->row_scales) {
+                dots[i] *= db->row_scales[r0 + i];
+            }
+            alive[num_alive++] = i;
+        }
+        work += (size_t)len * num_alive;
+        total += (size_t)dim * num_alive;
+
+        for (int off = len; num_alive > 0; off += block) {
+            if (off >= dim) {
+                // 마지막 블록까지 계산된 행: 정확한 점수
+                for (int j = 0; j < num_alive; ++j) {
+                    int r = r0 + alive[j];
+                    dots[alive[j]] = _row_score(session, db, r, dots[alive[j]], q_mean, q_std, asnorm);
+                    if (dots[alive[j]] > best) {
+                        best = dots[alive[j]];
+                    }
+                }
+                break;
+            }
+
+            // 남은 블록의 상한으로도 cutoff를 넘지 못하는 행은 상한을 점수로 기록하고 제외
+            int b = off / block;
+            float cutoff = ((best > threshold) ? best : threshold) - margin;
+            int kept = 0;
+            for (int j = 0; j < num_alive; ++j) {
+                int i = alive[j];
+                int r = r0 + i;
+                float bound = dots[i] + db->suffix_norms[(size_t)r * SV_ABANDON_BLOCKS + b] * q_suffix[b];
+                float ub = _row_score(session, db, r, bound, q_mean, q_std, asnorm);
+                if (ub < cutoff) {
+                    dots[i] = ub;
+                } else {
+                    alive[kept++] = i;
+                }
+            }
+            num_alive = kept;
+
+            // 다음 블록은 남은 행만
+            len = (dim - off < block) ? dim - off : block;
+            work += (size_t)len * num_alive;
+            for (int j = 0; j < num_alive; ++j) {
+                int i = alive[j];
+                float partial;
+                if (fp16) {
+                    sv_matvec_f16((const uint16_t*)chunk + (size_t)i * db->emb_stride + off, len,
+                                  session->query + off, len, 1, &partial);
+                } else {
+                    sv_matvec_f32((const float*)chunk + (size_t)i * db->emb_stride + off, len,
+                                  session->query + off, len, 1, &partial);
+                }
+                dots[i] += partial * (db->row_scales ? db->row_scales[r0 + i] : 1.0f);
+            }
+        }
+    }
+
+    if (total > 0) {
+        session->abandon_work += (float)work / (float)total;
+        session->abandon_frames++;
+    }
+}
+
+/**
+ * @brief [Private] 이번 판정에 early-abandon을 쓸지 결정합니다.
+ * 포기가 적으면 블록별 상한 계산과 행 단위 커널 호출이 전체 계산보다 비싸므로 (차원별 분산이 고른 임베딩),
+ * SV_ABANDON_PROBE_FRAMES 판정의 평균 계산량이 SV_ABANDON_MAX_WORK를 넘으면
+ * SV_ABANDON_BACKOFF_FRAMES 판정 동안 sv_score_all을 사용하고, 그 뒤 다시 평가합니다.
+ */
+static bool _abandon_enabled(sv_session_t* session) {
+    if (session->abandon_skip > 0) {
+        session->abandon_skip--;
+        return false;
+    }
+    if (session->abandon_frames >= SV_ABANDON_PROBE_FRAMES) {
+        if (session->abandon_work > SV_ABANDON_MAX_WORK * session->abandon_frames) {
+            session->abandon_skip = SV_ABANDON_BACKOFF_FRAMES - 1; // 이번 판정 포함
+            session->abandon_work = 0.0f;
+            session->abandon_frames = 0;
+            return false;
+        }
+        session->abandon_work = 0.0f;
+        session->abandon_frames = 0;
+    }
+    return true;
+}
+
+static float _row_score(const sv_session_t* session, const sv_db_t* db, int row, float dot,
+                        float q_mean, float q_std, bool asnorm) {
+    float s = dot;
+    if (db->row_bias) {
+        s += db->row_bias[row] + session->q_bias;
+    }
+    if (asnorm) {
+        s = 0.5f * ((s - db->enroll_mean[row]) / db->enroll_std[row] + (s - q_mean) / q_std);
+    }
+    return s;
+}
+
+static void _suffix_norms(const float* vec, int dim, int block, float* out) {
+    // 뒤쪽 블록부터 제곱합을 누적
+    double acc = 0.0;
+    for (int b = SV_ABANDON_BLOCKS - 1; b >= 0; --b) {
+        for (int d = b * block; d < dim && d < (b + 1) * block; ++d) {
+            acc += (double)vec[d] * vec[d];
+        }
+        out[b] = sqrtf((float)acc);
+    }
+}
+
+/**
+ * @brief [Private] 커널 출력을 최종 점수로 보정합니다. (단일/배치 판정 공통)
+ */
+static void _finish_scores(sv_session_t* session, const sv_db_t* db) {
+    sv_handle_t* handle = session->handle;
+
+    if (handle->settings.db_format == SV_DB_INT8) {
+        sv_score_all_q8(session, db); // 상수 항은 재순위화 후보 선택 전에 반영
+    } else {
+        if (db->row_scales) {
+            // 정규화되지 않은 이미지: 행 norm을 점수에 반영
+            for (int i = 0; i < db->num_speakers; ++i) {
+                session->scores[i] *= db->row_scales[i];
+            }
+        }
+        _add_bias(session, db);
+    }
+
+    if (handle->settings.score_norm == SV_NORM_ASNORM && db->num_cohort > 0) {
+        sv_asnorm_apply(session, db);
+    }
+    _mask_dead_rows(session, db);
+}
+
+/**
+ * @brief [Private] 화자별 상수 항(등록 시 계산)과 쿼리 상수 항(판정마다 한 번)을 점수에 더합니다.
+ */
+static void _add_bias(sv_session_t* session, const sv_db_t* db) {
+    if (!db->row_bias) {
+        return;
+    }
+    float q_bias = session->q_bias;
+    for (int i = 0; i < db->num_speakers; ++i) {
+        session->scores[i] += db->row_bias[i] + q_bias;
+    }
+}
+
+/**
+ * @brief [Private] 삭제된 행(speaker_id = -1)의 점수를 SV_SCORE_INVALID로 덮어씁니다.
+ * 행렬은 조밀하게 유지한 채 점수 계산 후에만 제외하므로 커널은 그대로 사용합니다.
+ */
+static void _mask_dead_rows(sv_session_t* session, const sv_db_t* db) {
+    if (db->num_dead == 0) {
+        return;
+    }
+    for (int i = 0; i < db->num_speakers; ++i) {
+        if (db->speakers_db[i].speaker_id == -1) {
+            session->scores[i] = SV_SCORE_INVALID;
+        }
+    }
+}
+
+/**
+ * @brief [Private] 다중 template 화자의 template 점수를 lead 행의 점수로 합칩니다.
+ * SV_TEMPLATE_MAX는 최대값, SV_TEMPLATE_MEAN은 평균이며, 나머지 template 행은 SV_SCORE_INVALID로 덮어써
+ * 이후 top-k 선택과 후처리가 화자당 한 행만 보도록 합니다. (margin도 다른 화자와의 차이로 판정)
+ * IVF 후보는 화자의 template이 모두 후보에 포함되어 있으므로 후보만 확인합니다.
+ */
+static void _merge_template_scores(sv_session_t* session, const sv_db_t* db) {
+    const sv_template_t* t = db->templates;
+    float* scores = session->scores;
+    bool mean = (session->handle->settings.template_score == SV_TEMPLATE_MEAN);
+    const int* rows = (session->num_cand >= 0) ? session->cand_rows : NULL;
+    int count = rows ? session->num_cand : db->num_speakers;
+
+    for (int j = 0; j < count; ++j) {
+        int lead = rows ? rows[j] : j;
+        // 삭제된 행의 template 정보는 갱신되지 않으므로 살아 있는 lead만 확인
+        if (db->speakers_db[lead].speaker_id == -1 || t[lead].lead != lead || t[lead].rows < 2) {
+            continue;
+        }
+        float s = scores[lead];
+        for (int r = t[lead].next; r != -1; r = t[r].next) {
+            if (mean) {
+                s += scores[r];
+            } else if (scores[r] > s) {
+                s = scores[r];
+            }
+            scores[r] = SV_SCORE_INVALID;
+        }
+        scores[lead] = mean ? s / t[lead].rows : s;
+    }
+
+    if (rows) {
+        for (int j = 0; j < count; ++j) {
+            session->cand_scores[j] = scores[rows[j]];
+        }
+    }
+}
+
+/**
+ * @brief [Private] AS-norm으로 session->scores를 정규화합니다.
+ * 등록 화자 쪽 통계(enroll_mean/std)는 등록 시 미리 계산되어 있으므로,
+ * 판정 시에는 쿼리-cohort 점수(같은 행렬-벡터 커널) 한 번과 상위 N 통계만 계산합니다.
+ * s' = 0.5 * ((s - mean_e) / std_e + (s - mean_q) / std_q)
+ */
+static void sv_asnorm_apply(sv_session_t* session, const sv_db_t* db) {
+    float q_mean, q_std;
+    sv_cohort_stats(session->handle, db, session->query, session->cohort_scores, &q_mean, &q_std);
+
+    for (int i = 0; i < db->num_speakers; ++i) {
+        float s = session->scores[i];
+        session->scores[i] = 0.5f * ((s - db->enroll_mean[i]) / db->enroll_std[i] +
+                                     (s - q_mean) / q_std);
+    }
+}
+
+/**
+ * @brief [Private] 단위 벡터와 cohort 간 점수 중 상위 N개의 평균/표준편차를 계산합니다.
+ * 상위 N개는 quickselect로 배열 앞쪽에 모은 뒤 계산합니다. (평균 O(C))
+ */
+static void sv_cohort_stats(const sv_handle_t* handle, const sv_db_t* db, const float* unit_vec,
+                            float* work, float* mean, float* std) {
+    float* v = work;
+    int n = db->num_cohort;
+    int top_n = (handle->settings.cohort_top_n < n) ? handle->settings.cohort_top_n : n;
+
+    sv_matvec_f32(db->cohort_matrix, handle->dim, unit_vec, handle->dim, n, v);
+
+    // 내림차순 기준 quickselect: v[0..top_n-1]이 상위 top_n개가 되도록 분할
+    int lo = 0, hi = n - 1;
+    while (lo < hi) {
+        float pivot = v[(lo + hi) / 2];
+        int i = lo, j = hi;
+        while (i <= j) {
+            while (v[i] > pivot) i++;
+            while (v[j] < pivot) j--;
+            if (i <= j) {
+                float t = v[i]; v[i] = v[j]; v[j] = t;
+                i++; j--;
+            }
+        }
+        if (top_n - 1 <= j) {
+            hi = j;
+        } else if (top_n - 1 >= i) {
+            lo = i;
+        } else {
+            break;
+        }
+    }
+
+    float sum = 0.0f, sum_sq = 0.0f;
+    for (int i = 0; i < top_n; ++i) {
+        sum += v[i];
+        sum_sq += v[i] * v[i];
+    }
+    *mean = sum / top_n;
+    float var = sum_sq / top_n - (*mean) * (*mean);
+    *std = sqrtf(var > 1e-8f ? var : 1e-8f);
+}
+
+/**
+ * @brief [Private] DB의 idx번째 행(정규화된 등록 임베딩)의 cohort 통계를 갱신합니다.
+ */
+static void _update_enroll_stats(sv_handle_t* handle, sv_db_t* db, int idx) {
+    if (db->num_cohort == 0) {
+        db->enroll_mean[idx] = 0.0f;
+        db->enroll_std[idx] = 1.0f;
+        return;
+    }
+
+    const float* row;
+    float dequant[SV_MAX_EMBEDDING_DIM];
+    if (handle->image) {
+        _image_row_f32(handle->image, idx, dequant);
+        sv_l2_normalize(dequant, dequant, handle->dim);
+        row = dequant;
+    } else if (handle->settings.db_format == SV_DB_INT8) {
+        const int8_t* q_row = (const int8_t*)sv_db_row(db, idx);
+        for (int i = 0; i < handle->dim; ++i) {
+            dequant[i] = (float)q_row[i] * db->q_scales[idx];
+        }
+        row = dequant;
+    } else {
+        row = (const float*)sv_db_row(db, idx);
+    }
+
+    sv_cohort_stats(handle, db, row, handle->enroll_work, &db->enroll_mean[idx], &db->enroll_std[idx]);
+}
+
+/**
+ * @brief [Private] int8 DB 모드의 점수 계산.
+ * 1) int8 x int8 -> int32 커널의 누산 결과(session->q_acc)로 전체 점수를 근사
+ * 2) 상위 rerank_k개 후보만 float 쿼리와 int8 행(행 scale 적용)의 내적으로 재계산
+ * (쿼리 양자화 오차가 제거되어 최고 점수와 순위가 float 경로에 가까워짐)
+ */
+static void sv_score_all_q8(sv_session_t* session, const sv_db_t* db) {
+    int n = db->num_speakers;
+    float* scores = session->scores;
+
+    for (int i = 0; i < n; ++i) {
+        scores[i] = (float)session->q_acc[i] * db->q_scales[i] * session->q_scale;
+    }
+    _add_bias(session, db);
+    _mask_dead_rows(session, db); // 삭제된 행이 재순위화 후보를 차지하지 않도록
+
+    int cand[SV_MAX_RERANK_K];
+    int num_cand = sv_select_topk(scores, n, session->handle->settings.rerank_k, cand);
+    for (int c = 0; c < num_cand; ++c) {
+        int i = cand[c];
+        scores[i] = sv_dot_f32_s8(session->query, (const int8_t*)sv_db_row(db, i),
+                                  session->handle->dim) * db->q_scales[i];
+        if (db->row_bias) {
+            scores[i] += db->row_bias[i] + session->q_bias;
+        }
+    }
+}
+
+/**
+ * @brief [Private] 점수 배열에서 상위 k개를 부분 선택합니다.
+ * 크기 k의 정렬 배열에 삽입하는 방식 (O(N·k), k가 작을 때 전체 정렬보다 빠름)
+ *
+ * @return 선택된 개수 (min(n, k))
+ */
+static int sv_select_topk(const float* scores, int n, int k, int* out_idx) {
+    int count = 0;
+    if (k > n) {
+        k = n;
+    }
+
+    for (int i = 0; i < n; ++i) {
+        float s = scores[i];
+        if (count == k && s <= scores[out_idx[k - 1]]) {
+            continue;
+        }
+
+        // 삽입 위치를 뒤에서부터 찾으며 한 칸씩 밀기
+        int pos = (count < k) ? count++ : k - 1;
+        while (pos > 0 && scores[out_idx[pos - 1]] < s) {
+            out_idx[pos] = out_idx[pos - 1];
+            pos--;
+        }
+        out_idx[pos] = i;
+    }
+    return count;
+}
+
+/**
+ * @brief [Private] 임베딩을 backend로 변환(cosine: 정규화)하여 DB의 idx번째 행에 저장합니다.
+ * int8 모드에서는 변환 후 행별 scale로 양자화하여 저장합니다.
+ * 행별 상수 항(PLDA)과 AS-norm cohort 통계도 여기서 한 번만 계산합니다.
+ */
+static void _store_embedding(sv_handle_t* handle, sv_db_t* db, int idx, const float* embedding) {
+    float normalized[SV_MAX_EMBEDDING_DIM];
+    handle->backend->enroll(handle, embedding, normalized);
+    _write_row(handle, db, idx, normalized);
+}
+
+static void _write_row(sv_handle_t* handle, sv_db_t* db, int idx, const float* vec) {
+    // RAM DB 행만 기록 대상 (pool 소유이므로 쓰기 가능)
+    void* row = sv_pool_row(handle->pool, idx);
+    if (db->row_bias) {
+        db->row_bias[idx] = handle->backend->row_bias(handle, vec);
+    }
+    if (handle->settings.db_format == SV_DB_INT8) {
+        sv_quantize_s8(vec, (int8_t*)row, handle->dim, &db->q_scales[idx]);
+    } else {
+        memcpy(row, vec, sizeof(float) * handle->dim);
+    }
+    if (db->suffix_norms) {
+        _update_suffix_norms(handle, db, idx);
+    }
+
+    if (handle->settings.score_norm == SV_NORM_ASNORM) {
+        _update_enroll_stats(handle, db, idx);
+    }
+}
+
+/**
+ * @brief [Private] 임베딩을 화자의 template에 반영합니다. (쓰기 잠금을 잡고 새 snapshot으로 게시)
+ * 가장 가까운 template과의 코사인 유사도가 template_merge_sim 이상이면 그 template에 합치고,
+ * 아니면 max_templates까지 새 template 행을 lead 뒤에 연결합니다.
+ * template이 가득 찬 경우 등록(online = false)은 가장 가까운 template에 합치고, 온라인 갱신은 반영하지 않습니다.
+ * 온라인 갱신은 합칠 template의 유사도 분포에서 벗어난 임베딩(이상치)도 반영하지 않으며,
+ * 판정 thread에서 호출되므로 다른 writer가 쓰기 잠금을 잡고 있으면 기다리지 않고 SV_BUSY를 반환합니다.
+ *
+ * @return SV_SUCCESS, SV_NOT_FOUND, SV_DB_FULL(메모리 부족), SV_BUSY(온라인, 다른 쓰기 작업 중), SV_ERROR(반영하지 않음)
+ */
+static sv_status_t _template_update(sv_handle_t* handle, int speaker_id, const float* embedding, bool online) {
+    int dim = handle->dim;
+    float vec[SV_MAX_EMBEDDING_DIM];
+    float unit[SV_MAX_EMBEDDING_DIM] __attribute__((aligned(SV_KERNEL_ALIGN)));
+    float row[SV_MAX_EMBEDDING_DIM] __attribute__((aligned(SV_KERNEL_ALIGN)));
+    handle->backend->enroll(handle, embedding, vec);
+    sv_l2_normalize(vec, unit, dim);
+
+    sv_db_t* db = NULL;
+    if (online) {
+        sv_status_t begin = _db_try_begin_write(handle, &db);
+        if (begin == SV_BUSY) {
+            return SV_BUSY;
+        }
+    } else {
+        db = _db_begin_write(handle);
+    }
+    if (!db) {
+        LOG_E(TAG, "Failed to allocate DB snapshot");
+        return SV_ERROR;
+    }
+    int lead = _find_row(db, speaker_id);
+    if (lead == -1) {
+        _db_free(db);
+        pthread_mutex_unlock(&handle->write_lock);
+        return SV_NOT_FOUND;
+    }
+
+    // 가장 가까운 template (화자당 최대 SV_MAX_TEMPLATES 행)
+    int best = lead;
+    float best_sim = -2.0f;
+    for (int r = lead; r != -1; r = db->templates[r].next) {
+        float sim;
+        _db_row_f32(handle, db, r, row);
+        sv_l2_normalize(row, row, dim);
+        sv_matvec_f32(row, dim, unit, dim, 1, &sim);
+        if (sim > best_sim) {
+            best_sim = sim;
+            best = r;
+        }
+    }
+
+    sv_status_t status = SV_SUCCESS;
+    uint8_t* old_chunk = NULL;
+    bool merge = (best_sim >= handle->settings.template_merge_sim);
+    if (!merge && db->templates[lead].rows < handle->settings.max_templates) {
+        // 새 조건(채널, 거리, 감기 등)의 음성: 새 template (이름은 행 배열이 늘어나기 전에 복사)
+        char name[SV_MAX_NAME_LEN];
+        memcpy(name, db->speakers_db[lead].speaker_name, SV_MAX_NAME_LEN);
+        int r = _alloc_ram_row(handle, db, speaker_id, name);
+        if (r == -1) {
+            status = SV_DB_FULL;
+        } else {
+            _write_row(handle, db, r, vec);
+            sv_template_t* t = db->templates;
+            t[r].lead = lead;
+            t[r].next = t[lead].next;
+            t[lead].next = r;
+            t[lead].rows++;
+            db->num_templates++;
+            _ivf_add_row(handle, db, r);
+        }
+    } else if ((merge || !online) && !(online && _template_outlier(&db->templates[best], best_sim))) {
+        old_chunk = _template_merge(handle, db, best, vec, best_sim);
+        status = old_chunk ? SV_SUCCESS : SV_DB_FULL;
+    } else {
+        status = SV_ERROR;
+    }
+
+    if (status != SV_SUCCESS) {
+        _db_free(db); // 게시된 snapshot과 같음 (늘어난 행 배열만 버림)
+        pthread_mutex_unlock(&handle->write_lock);
+        return status;
+    }
+    _db_publish(handle, db);
+    if (old_chunk) {
+        _db_retire(handle, old_chunk, sv_aligned_free); // 이전 snapshot의 reader가 모두 나간 뒤 해제
+    }
+    pthread_mutex_unlock(&handle->write_lock);
+    return SV_SUCCESS;
+}
+
+/**
+ * @brief [Private] template 행에 임베딩을 running mean으로 합칩니다. (t <- t + (x - t) / (w + 1))
+ * 가중치 w는 SV_TEMPLATE_MAX_WEIGHT에서 멈추므로 이후에는 지수 평균으로 최근 음성을 따라가며,
+ * 결과는 기존 행의 norm(backend 기대 norm)으로 맞춥니다.
+ * 게시된 snapshot이 이 행을 읽고 있으므로 행이 있는 chunk를 복사하여 새 snapshot에만 기록합니다.
+ */
+static uint8_t* _template_merge(sv_handle_t* handle, sv_db_t* db, int row, const float* vec, float sim) {
+    int dim = handle->dim;
+    int c = row >> SV_DB_CHUNK_SHIFT;
+    uint8_t* old_chunk = sv_pool_clone_chunk(handle->pool, c);
+    if (!old_chunk) {
+        return NULL;
+    }
+    db->chunks[c] = handle->pool->chunks[c];
+
+    sv_template_t* t = &db->templates[row];
+    int w = (t->count < SV_TEMPLATE_MAX_WEIGHT) ? t->count : SV_TEMPLATE_MAX_WEIGHT;
+    float cur[SV_MAX_EMBEDDING_DIM];
+    _db_row_f32(handle, db, row, cur);
+    float norm = 0.0f;
+    for (int d = 0; d < dim; ++d) {
+        norm += cur[d] * cur[d];
+    }
+    norm = sqrtf(norm);
+    for (int d = 0; d < dim; ++d) {
+        cur[d] += (vec[d] - cur[d]) / (float)(w + 1);
+    }
+    sv_l2_normalize(cur, cur, dim);
+    for (int d = 0; d < dim; ++d) {
+        cur[d] *= norm;
+    }
+    _write_row(handle, db, row, cur);
+
+    // 합친 임베딩의 유사도 평균/분산 (가중치 상한 이후에는 지수 평균)
+    if (t->count < UINT16_MAX) {
+        t->count++;
+    }
+    int n = (t->count - 1 < SV_TEMPLATE_MAX_WEIGHT) ? t->count - 1 : SV_TEMPLATE_MAX_WEIGHT;
+    float delta = sim - t->sim_mean;
+    t->sim_mean += delta / n;
+    t->sim_var = (1.0f - 1.0f / n) * (t->sim_var + delta * delta / n);
+    return old_chunk;
+}
+
+static bool _template_outlier(const sv_template_t* t, float sim) {
+    if (t->count <= SV_TEMPLATE_MIN_STATS) {
+        return false; // 합친 임베딩이 적으면 분포를 믿을 수 없음
+    }
+    float std = sqrtf(t->sim_var);
+    if (std < SV_TEMPLATE_MIN_STD) {
+        std = SV_TEMPLATE_MIN_STD;
+    }
+    return sim < t->sim_mean - SV_TEMPLATE_OUTLIER_K * std;
+}
+
+/**
+ * @brief [Private] 온라인 template 갱신
+ * raw와 최종 판정이 같은 화자이고 best_score가 update_threshold 이상일 때, 판정 구간(unknown 프레임 사이)마다
+ * 한 번만 현재 임베딩을 반영합니다. (같은 발화의 연속 프레임이 template을 한쪽으로 끌지 않도록)
+ * 다른 writer가 쓰기 중이면 판정을 막지 않도록 건너뛰고, 같은 구간의 다음 조건 충족 프레임에서 다시 시도합니다.
+ */
+static void _template_feedback(sv_session_t* session, const sv_result_t* result, const float* embedding) {
+    sv_handle_t* handle = session->handle;
+    sv_internal_state_t* state = &session->state;
+    if (handle->settings.update_threshold <= 0.0f) {
+        return;
+    }
+
+    if (result->raw_speaker_id == -1 && result->final_speaker_id == -1) {
+        state->updated_id = -1;
+        return;
+    }
+    if (result->final_speaker_id == -1 || result->final_speaker_id != result->raw_speaker_id ||
+        result->final_speaker_id == state->updated_id || result->best_score < handle->settings.update_threshold) {
+        return;
+    }
+    if (_template_update(handle, result->final_speaker_id, embedding, true) != SV_BUSY) {
+        state->updated_id = result->final_speaker_id;
+    }
+}
+
+static sv_enroll_t* _enroll_find(sv_handle_t* handle, int speaker_id) {
+    for (sv_enroll_t* e = handle->enrolls; e; e = e->next) {
+        if (e->speaker_id == speaker_id) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief [Private] 화자의 등록 특징을 해제합니다. 재임베딩 중인 화자는 ID만 지우고 migrate_step이 해제합니다.
+ * @return 등록 특징이 있었으면 true
+ */
+static bool _enroll_remove(sv_handle_t* handle, int speaker_id) {
+    sv_enroll_t* enroll = (speaker_id >= 0) ? _enroll_find(handle, speaker_id) : NULL;
+    if (!enroll) {
+        return false;
+    }
+    if (enroll == handle->migrating) {
+        enroll->speaker_id = -1;
+    } else {
+        _enroll_drop(handle, enroll);
+    }
+    return true;
+}
+
+static void _enroll_drop(sv_handle_t* handle, sv_enroll_t* enroll) {
+    sv_enroll_t** link = &handle->enrolls;
+    while (*link != enroll) {
+        link = &(*link)->next;
+    }
+    *link = enroll->next;
+
+    while (enroll->utts) {
+        sv_features_t* next = enroll->utts->next;
+        sv_features_free(enroll->utts);
+        enroll->utts = next;
+    }
+    free(enroll);
+}
+
+/**
+ * @brief [Private] 재임베딩 대기 중인지 확인합니다. (삭제되었거나 현재 모델로 등록되었거나 보류된 화자 제외)
+ */
+static bool _enroll_pending(const sv_handle_t* handle, const sv_enroll_t* enroll) {
+    return enroll->speaker_id != -1 && enroll->model_hash != handle->settings.model_hash &&
+           enroll->num_utts > 0 && enroll->failures < SV_MIGRATE_MAX_RETRIES;
+}
+
+/**
+ * @brief [Private] 다른 모델로 등록된 저장소 화자를 등록 특징 없이 대기 목록에 올립니다. (DB 행 없음, 이름만 보관)
+ */
+static void _enroll_add_stale(sv_handle_t* handle, int speaker_id, const char name[SV_MAX_NAME_LEN]) {
+    sv_enroll_t* enroll = (sv_enroll_t*)calloc(1, sizeof(sv_enroll_t));
+    if (!enroll) {
+        LOG_E(TAG, "Out of memory, stale speaker %d not listed", speaker_id);
+        return;
+    }
+    enroll->speaker_id = speaker_id;
+    memcpy(enroll->speaker_name, name, SV_MAX_NAME_LEN - 1); // record 이름 (calloc으로 널 종료)
+    enroll->next = handle->enrolls;
+    handle->enrolls = enroll;
+}
+
+static int _count_stale(const sv_handle_t* handle) {
+    int count = 0;
+    for (const sv_enroll_t* e = handle->enrolls; e; e = e->next) {
+        if (_enroll_pending(handle, e)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+static sv_status_t _migrate_embed(const sv_enroll_t* enroll, sv_embed_fn_t embed, void* ctx,
+                                  int embedding_dim, float* embeddings) {
+    size_t max_size = 0;
+    for (const sv_features_t* f = enroll->utts; f; f = f->next) {
+        size_t size = (size_t)f->num_frames * f->num_bins;
+        if (size > max_size) {
+            max_size = size;
+        }
+    }
+    float* features = (float*)malloc(sizeof(float) * max_size);
+    if (!features) {
+        return SV_DB_FULL;
+    }
+
+    sv_status_t status = SV_SUCCESS;
+    int u = 0;
+    for (const sv_features_t* f = enroll->utts; f && status == SV_SUCCESS; f = f->next, ++u) {
+        sv_features_decode(f, features);
+        status = embed(ctx, features, f->num_frames, f->num_bins, &embeddings[(size_t)u * embedding_dim]);
+    }
+    free(features);
+    return status;
+}
+
+/**
+ * @brief [Private] Majority Voting 윈도우(ring buffer)에 현재 판정을 추가합니다.
+ * 윈도우가 차 있으면 가장 오래된 항목을 빼고, 행별 카운트를 증분 갱신합니다.
+ * 과반수(window/2 + 1)는 유일하므로, 새로 들어온 행이 과반이 되었는지와
+ * 기존 과반 행이 여전히 과반인지만 확인하면 됩니다. (O(1))
+ *
+ * @param row 현재 판정된 DB 행 (-1: unknown)
+ * @return 현재 과반수 DB 행 (-1: 없음)
+ */
+static int sv_vote_push(sv_session_t* session, int row) {
+    sv_internal_state_t* state = &session->state;
+    int window = session->handle->settings.voting_window;
+
+    if (state->history_count == window) {
+        int old = state->history_buffer[state->history_index];
+        if (old != -1) {
+            state->vote_counts[old]--;
+        }
+    } else {
+        state->history_count++;
+    }
+
+    state->history_buffer[state->history_index] = row;
+    state->history_index = (state->history_index + 1) % window;
+    if (row != -1) {
+        state->vote_counts[row]++;
+    }
+
+    int majority_threshold = (window / 2) + 1;
+    if (row != -1 && state->vote_counts[row] >= majority_threshold) {
+        state->majority_row = row;
+    } else if (state->majority_row != -1 &&
+               state->vote_counts[state->majority_row] < majority_threshold) {
+        state->majority_row = -1;
+    }
+
+    return state->majority_row;
+}
+
+/**
+ * @brief [Private] 현재 프레임의 화자별 점수(session->scores)를 지수 평활합니다.
+ * s[i] <- s[i] + alpha * (score[i] - s[i]), 새로 추가된 행은 첫 점수로 초기화합니다.
+ * 판정 유지 중인 화자는 평활 점수가 exit_threshold 이상인 동안 유지되고,
+ * 그렇지 않으면 평활 점수 최고 화자가 enter_threshold 이상일 때 새로 판정됩니다.
+ *
+ * @return 판정 유지 중인 DB 행 (-1: 없음)
+ */
+static int sv_smooth_update(sv_session_t* session, const sv_db_t* db) {
+    sv_handle_t* handle = session->handle;
+    sv_internal_state_t* state = &session->state;
+    const float* scores = session->scores;
+    float* smoothed = state->smoothed_scores;
+    float alpha = handle->settings.smoothing_alpha;
+    int n = db->num_speakers;
+
+    // IVF: 점수를 계산한 후보만 갱신 (나머지 행은 이전 평활 값 유지)
+    // 후보에 처음 들어온 기존 행은 그동안 후보 밖(최저 후보 점수 이하)이었으므로
+    // 이번 프레임의 최저 후보 점수에서 평활을 시작 (선형 탐색의 평활 지연과 맞춤)
+    const int* rows = (session->num_cand >= 0) ? session->cand_rows : NULL;
+    int count = rows ? session->num_cand : n;
+    int first_new = state->smoothed_rows;
+    float floor = SV_SCORE_INVALID;
+    if (rows) {
+        for (int i = state->smoothed_rows; i < n; ++i) {
+            smoothed[i] = SV_SCORE_INVALID;
+        }
+        for (int j = 0; j < count; ++j) {
+            float s = scores[rows[j]];
+            if (s > SV_SCORE_INVALID && (floor == SV_SCORE_INVALID || s < floor)) {
+                floor = s;
+            }
+        }
+    }
+
+    int best_row = -1;
+    float best = SV_SCORE_INVALID; // 점수 범위는 backend마다 다름 (PLDA: 로그 우도비)
+    for (int j = 0; j < count; ++j) {
+        int i = rows ? rows[j] : j;
+        if (i >= first_new) {
+            smoothed[i] = scores[i];
+        } else if (smoothed[i] > SV_SCORE_INVALID) {
+            smoothed[i] += alpha * (scores[i] - smoothed[i]);
+        } else {
+            smoothed[i] = floor + alpha * (scores[i] - floor);
+        }
+        if (smoothed[i] > best) {
+            best = smoothed[i];
+            best_row = i;
+        }
+    }
+    state->smoothed_rows = n;
+    state->leading_row = best_row;
+
+    // hysteresis: 유지 중인 화자는 exit 임계값 기준으로 해제
+    if (state->locked_row != -1 && smoothed[state->locked_row] < handle->settings.exit_threshold) {
+        state->locked_row = -1;
+    }
+    if (state->locked_row == -1 && best_row != -1 && best >= handle->settings.enter_threshold) {
+        state->locked_row = best_row;
+    }
+
+    return state->locked_row;
+}
+
+/**
+ * @brief [Private] sv_database.h에 정의된 사전 등록 화자를 RAM DB로 복사합니다.
+ * 임베딩은 정규화하여 pool 행에 저장합니다.
+ */
+static void _load_preregistered_speakers(sv_handle_t* handle, sv_db_t* db) {
+    if (!_database_dim_ok(handle)) {
+        return;
+    }
+
+    // sv_database.h 에 정의된 전역 상수 배열을 사용
+    for (int i = 0; i < NUM_REGISTERED_SPEAKERS; ++i) {
+        const sv_registered_spk_t* src = &REGISTERED_SPEAKERS[i];
+
+        // ID가 중복되지 않도록 .h의 ID를 그대로 사용
+        if (_add_ram_speaker(handle, db, src->speaker_id, src->name, src->embedding) == -1) {
+            LOG_E(TAG, "Out of memory while loading preregistered speakers (%d loaded)", db->num_speakers);
+            break;
+        }
+
+        if (src->speaker_id >= handle->next_speaker_id) {
+            handle->next_speaker_id = src->speaker_id + 1;
+        }
+    }
+}
+
+/**
+ * @brief [Private] sv_database.h(SV_DATABASE_DIM)가 다른 모델로 생성되었으면 사전 등록 화자를 쓰지 않습니다.
+ * 차원이 다른 임베딩을 그대로 읽으면 오류 없이 잘못된 점수가 나오므로 여기서 막습니다.
+ */
+static bool _database_dim_ok(const sv_handle_t* handle) {
+    if (SV_DATABASE_DIM != handle->embedding_dim) {
+        LOG_E(TAG, "sv_database.h dim %d != embedding dim %d, preregistered speakers skipped",
+              SV_DATABASE_DIM, handle->embedding_dim);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief [Private] RAM DB에 화자를 추가합니다.
+ * 삭제되어 pool로 반환된 행이 있으면 그 행을 재사용하고, 없으면 끝에 추가합니다.
+ * 재사용되는 행은 어떤 snapshot에서도 삭제된 행(점수 mask)이므로 판정 중에 기록해도 결과에 영향이 없습니다.
+ *
+ * @return 기록된 행, 메모리 부족 시 -1
+ */
+static int _add_ram_speaker(sv_handle_t* handle, sv_db_t* db, int speaker_id, const char* name,
+                            const float* embedding) {
+    int row = _alloc_ram_row(handle, db, speaker_id, name);
+    if (row != -1) {
+        // 등록 시 한 번만 정규화하여 행에 저장 (판정 시 norm 재계산 불필요)
+        _store_embedding(handle, db, row, embedding);
+    }
+    return row;
+}
+
+static int _alloc_ram_row(sv_handle_t* handle, sv_db_t* db, int speaker_id, const char* name) {
+    sv_pool_t* pool = handle->pool;
+
+    // 끝에 추가될 행이 snapshot 용량을 넘으면 행별 배열을 chunk 하나만큼 늘림
+    if (pool->num_free == 0 && pool->num_rows == db->capacity &&
+        _db_reserve(handle, db, db->capacity + SV_DB_CHUNK_ROWS) != SV_SUCCESS) {
+        return -1;
+    }
+    int row = sv_pool_alloc(pool);
+    if (row < 0) {
+        return -1;
+    }
+    db->chunks[row >> SV_DB_CHUNK_SHIFT] = pool->chunks[row >> SV_DB_CHUNK_SHIFT];
+
+    sv_speaker_entry_t* entry = &db->speakers_db[row];
+    entry->speaker_id = speaker_id;
+    strncpy(entry->speaker_name, name, SV_MAX_NAME_LEN - 1);
+    entry->speaker_name[SV_MAX_NAME_LEN - 1] = '\0'; // 널 종료 보장
+    entry->model_hash = handle->settings.model_hash;
+    db->templates[row] = (sv_template_t){ .lead = row, .next = -1, .rows = 1, .count = 1 };
+
+    if (row < db->num_speakers) {
+        // 삭제된 행 재사용: 판정 task가 이전 화자의 후처리 상태를 새 화자에 이어 쓰지 않도록
+        db->num_dead--;
+        db->layout_id++;
+    } else {
+        db->num_speakers = row + 1;
+    }
+    return row;
+}
+
+/**
+ * @brief [Private] RAM DB의 삭제된 행을 채워 행렬을 조밀하게 만듭니다. (쓰기 잠금 상태에서 호출)
+ * 뒤쪽의 살아 있는 행을 앞쪽의 삭제된 행으로 옮긴 snapshot을 게시하고,
+ * 이전 snapshot의 reader가 모두 나간 뒤 남는 chunk를 pool에 반환합니다.
+ * 옮겨지는 대상 행은 모든 snapshot에서 삭제된 행이므로 판정 중에 기록해도 됩니다.
+ */
+static void _compact_rows(sv_handle_t* handle) {
+    sv_pool_t* pool = handle->pool;
+
+    // 삭제 대기 중인 행을 pool로 돌려받아 대상 행에 reader가 없음을 보장
+    _db_synchronize(handle);
+    sv_db_t* db = _db_copy(handle);
+    if (!db) {
+        return; // 다음 삭제에서 재시도
+    }
+
+    int lo = 0;
+    int hi = db->num_speakers - 1;
+    while (true) {
+        while (lo < hi && db->speakers_db[lo].speaker_id != -1) lo++;
+        while (hi > lo && db->speakers_db[hi].speaker_id == -1) hi--;
+        if (lo >= hi) {
+            break;
+        }
+        memcpy(sv_pool_row(pool, lo), sv_pool_row(pool, hi), pool->row_bytes);
+        db->speakers_db[lo] = db->speakers_db[hi];
+        if (db->q_scales) {
+            db->q_scales[lo] = db->q_scales[hi];
+        }
+        if (db->row_bias) {
+            db->row_bias[lo] = db->row_bias[hi];
+        }
+        if (db->suffix_norms) {
+            memcpy(&db->suffix_norms[(size_t)lo * SV_ABANDON_BLOCKS],
+                   &db->suffix_norms[(size_t)hi * SV_ABANDON_BLOCKS], sizeof(float) * SV_ABANDON_BLOCKS);
+        }
+        if (db->enroll_mean) {
+            db->enroll_mean[lo] = db->enroll_mean[hi];
+            db->enroll_std[lo] = db->enroll_std[hi];
+        }
+        _template_move(db, hi, lo);
+        db->speakers_db[hi].speaker_id = -1;
+    }
+
+    int old_rows = db->num_speakers;
+    db->num_speakers = old_rows - db->num_dead; // 살아 있는 행이 모두 앞쪽으로 모임
+    db->num_dead = 0;
+    db->layout_id++;
+    _ivf_rebuild(handle, db); // 행 번호가 바뀌었으므로 색인도 다시 생성
+    _db_publish(handle, db);
+
+    // 이전 snapshot이 잘리는 chunk를 더 이상 보지 않을 때 반환
+    _db_synchronize(handle);
+    sv_pool_trim(pool, db->num_speakers);
+    LOG_I(TAG, "Compacted speaker DB: %d -> %d rows", old_rows, db->num_speakers);
+}
+
+/**
+ * @brief [Private] DB 이미지로 DB를 구성합니다.
+ * 화자 ID와 이름만 speakers_db로 복사하고, 임베딩 행렬은 이미지의 행을 직접 가리킵니다.
+ * 미리 정규화되지 않은 이미지는 행별 1/norm만 계산해 둡니다. (int8은 scale과 합쳐 q_scales에 저장)
+ * 단위 벡터 행을 쓰지 않는 backend(PLDA)는 행을 그대로 사용하고 행별 상수 항만 계산합니다.
+ */
+static void _load_image(sv_handle_t* handle, sv_db_t* db) {
+    const sv_image_header_t* image = handle->image;
+    const uint8_t* base = (const uint8_t*)image;
+    const int32_t* ids = (const int32_t*)(base + image->ids_offset);
+    const char* names = (const char*)(base + image->names_offset);
+    bool normalized = (image->flags & SV_IMAGE_FLAG_NORMALIZED) != 0;
+
+    size_t elem = (image->encoding == SV_IMAGE_INT8) ? sizeof(int8_t) :
+                  (image->encoding == SV_IMAGE_FP16) ? sizeof(uint16_t) : sizeof(float);
+    _map_chunks(db, base + image->rows_offset, image->row_stride, (int)image->num_speakers);
+    db->emb_stride = (int)(image->row_stride / elem);
+
+    for (int i = 0; i < (int)image->num_speakers; ++i) {
+        sv_speaker_entry_t* dst = &db->speakers_db[i];
+        dst->speaker_id = ids[i];
+        int len = (image->name_len < SV_MAX_NAME_LEN) ? image->name_len : SV_MAX_NAME_LEN - 1;
+        strncpy(dst->speaker_name, names + (size_t)i * image->name_len, len);
+        dst->speaker_name[len] = '\0'; // 널 종료 보장
+        dst->model_hash = handle->settings.model_hash; // 이미지는 현재 모델로 생성되었다고 간주
+
+        // 행 norm은 정규화되지 않은 이미지에서만 계산 (int8은 scale과 합침)
+        float inv = 1.0f;
+        if ((!normalized && handle->backend->unit_rows) || db->row_bias) {
+            float row[SV_MAX_EMBEDDING_DIM];
+            _image_row_f32(image, i, row);
+            if (db->row_bias) {
+                db->row_bias[i] = handle->backend->row_bias(handle, row);
+            } else {
+                float norm = sv_l2_normalize(row, row, image->dim);
+                inv = (norm < 1e-6f) ? 0.0f : 1.0f / norm;
+            }
+        }
+        if (image->encoding == SV_IMAGE_INT8) {
+            db->q_scales[i] = ((const float*)(base + image->scales_offset))[i] * inv;
+        } else if (db->row_scales) {
+            db->row_scales[i] = inv;
+        }
+        if (db->suffix_norms) {
+            _update_suffix_norms(handle, db, i);
+        }
+
+        if (dst->speaker_id >= handle->next_speaker_id) {
+            handle->next_speaker_id = dst->speaker_id + 1;
+        }
+        db->num_speakers++;
+        if (handle->settings.score_norm == SV_NORM_ASNORM) {
+            _update_enroll_stats(handle, db, i);
+        }
+    }
+}
+
+/**
+ * @brief [Private] DB 이미지 header를 검증합니다. (magic, version, 차원, 인코딩)
+ */
+static const sv_image_header_t* _image_check(const void* data, int dim) {
+    const sv_image_header_t* image = (const sv_image_header_t*)data;
+
+    if (image->magic != SV_IMAGE_MAGIC || image->version != SV_IMAGE_VERSION) {
+        LOG_E(TAG, "DB image: bad magic/version");
+        return NULL;
+    }
+    // 이미지 행은 점수 계산 공간에 저장됨 (projection 사용 시 투영된 차원)
+    if (image->dim != dim) {
+        LOG_E(TAG, "DB image: dim %d, expected %d", image->dim, dim);
+        return NULL;
+    }
+    if (image->encoding > SV_IMAGE_FP16 || image->num_speakers == 0 || image->name_len == 0 ||
+        (image->rows_offset % SV_IMAGE_ALIGN) != 0 || (image->row_stride % SV_IMAGE_ALIGN) != 0) {
+        LOG_E(TAG, "DB image: bad layout");
+        return NULL;
+    }
+    return image;
+}
+
+static void _image_row_f32(const sv_image_header_t* image, int i, float* out) {
+    const uint8_t* row = (const uint8_t*)image + image->rows_offset + (size_t)i * image->row_stride;
+
+    switch (image->encoding) {
+        case SV_IMAGE_INT8: {
+            float scale = ((const float*)((const uint8_t*)image + image->scales_offset))[i];
+            for (int d = 0; d < image->dim; ++d) {
+                out[d] = (float)((const int8_t*)row)[d] * scale;
+            }
+            break;
+        }
+        case SV_IMAGE_FP16:
+            for (int d = 0; d < image->dim; ++d) {
+                out[d] = sv_f16_to_f32(((const uint16_t*)row)[d]);
+            }
+            break;
+        default:
+            memcpy(out, row, sizeof(float) * image->dim);
+            break;
+    }
+}
+
+/**
+ * @brief [Private] projection header를 검증합니다. (magic, version, 차원, 정렬)
+ */
+static const sv_projection_header_t* _projection_check(const void* data, int embedding_dim) {
+    const sv_projection_header_t* proj = (const sv_projection_header_t*)data;
+
+    if (proj->magic != SV_PROJ_MAGIC || proj->version != SV_PROJ_VERSION) {
+        LOG_E(TAG, "Projection: bad magic/version");
+        return NULL;
+    }
+    if (proj->in_dim != embedding_dim || proj->out_dim == 0 || proj->out_dim > embedding_dim) {
+        LOG_E(TAG, "Projection: %d -> %d, expected input dim %d", proj->in_dim, proj->out_dim, embedding_dim);
+        return NULL;
+    }
+    if ((proj->mean_offset % SV_PROJ_ALIGN) != 0 || (proj->matrix_offset % SV_PROJ_ALIGN) != 0 ||
+        proj->matrix_offset + sizeof(float) * proj->out_dim * proj->in_dim > proj->total_size) {
+        LOG_E(TAG, "Projection: bad layout");
+        return NULL;
+    }
+    return proj;
+}
+
+/**
+ * @brief [Private] 영구 저장소의 record로 DB를 구성합니다.
+ * 처음 포맷된 저장소에는 sv_database.h의 사전 등록 화자(또는 DB 이미지의 화자)를 정규화하여 기록합니다.
+ * 임베딩은 복사하지 않으므로 부팅 시에는 record header만 훑습니다.
+ */
+static void _load_store(sv_handle_t* handle, sv_db_t* db, const sv_image_header_t* seed_image) {
+    sv_store_t* store = handle->store;
+
+    if (store->used == 0 && store->generation == 1 && seed_image) {
+        float normalized[SV_MAX_EMBEDDING_DIM];
+        const uint8_t* base = (const uint8_t*)seed_image;
+        const int32_t* ids = (const int32_t*)(base + seed_image->ids_offset);
+        for (int i = 0; i < (int)seed_image->num_speakers && store->used < store->capacity; ++i) {
+            char name[SV_MAX_NAME_LEN] = {0};
+            int len = (seed_image->name_len < SV_MAX_NAME_LEN) ? seed_image->name_len : SV_MAX_NAME_LEN - 1;
+            strncpy(name, (const char*)(base + seed_image->names_offset) + (size_t)i * seed_image->name_len, len);
+
+            _image_row_f32(seed_image, i, normalized);
+            if (handle->backend->unit_rows) {
+                sv_l2_normalize(normalized, normalized, seed_image->dim);
+            }
+            sv_store_append_add(store, ids[i], name, normalized, handle->settings.model_hash);
+        }
+        LOG_I(TAG, "Store seeded with %d speakers from DB image", store->used);
+    } else if (store->used == 0 && store->generation == 1 && _database_dim_ok(handle)) {
+        float normalized[SV_MAX_EMBEDDING_DIM];
+        for (int i = 0; i < NUM_REGISTERED_SPEAKERS && store->used < store->capacity; ++i) {
+            const sv_registered_spk_t* src = &REGISTERED_SPEAKERS[i];
+            handle->backend->enroll(handle, src->embedding, normalized);
+            sv_store_append_add(store, src->speaker_id, src->name, normalized, handle->settings.model_hash);
+        }
+        LOG_I(TAG, "Store seeded with %d preregistered speakers", store->used);
+    }
+
+    _sync_store_view(handle, db);
+
+    int stale = 0;
+    for (const sv_enroll_t* e = handle->enrolls; e; e = e->next) {
+        stale++;
+    }
+    if (stale > 0) {
+        LOG_E(TAG, "%d stored speakers were embedded by another model, kept out of scoring "
+              "(re-enroll, unregister, or restore that model)", stale);
+    }
+}
+
+/**
+ * @brief [Private] 활성 bank의 record 전체로 DB view를 다시 구성합니다.
+ * DB 행 i는 journal slot i와 같으며, chunk는 매핑된 record의 임베딩을 가리킵니다.
+ */
+static void _sync_store_view(sv_handle_t* handle, sv_db_t* db) {
+    sv_store_t* store = handle->store;
+
+    _map_chunks(db, (const uint8_t*)sv_store_embedding(store, 0), store->stride, store->capacity);
+    db->emb_stride = (int)(store->stride / sizeof(float));
+    db->num_speakers = 0;
+    db->num_dead = 0;
+
+    // 다른 모델의 화자 목록도 journal에서 다시 만듦 (저장소 모드의 대기 목록은 모두 특징 없는 화자)
+    while (handle->enrolls) {
+        _enroll_drop(handle, handle->enrolls);
+    }
+
+    // ID -> 마지막 ADD slot 임시 hash table (record마다 _find_row로 훑으면 O(record 수 x 화자 수))
+    int size = 16;
+    while (size < 2 * store->used) {
+        size <<= 1;
+    }
+    int* table = (int*)malloc(sizeof(int) * 2 * size);
+    if (!table) {
+        for (int slot = 0; slot < store->used; ++slot) {
+            _apply_store_record(handle, db, slot);
+        }
+        return;
+    }
+    memset(table, 0xFF, sizeof(int) * 2 * size); // 빈 칸: ID -1
+
+    for (int slot = 0; slot < store->used; ++slot) {
+        const sv_store_record_t* rec = sv_store_record(store, slot);
+        int* last = NULL;
+        if ((rec->op == SV_STORE_OP_ADD || rec->op == SV_STORE_OP_DEL) && rec->speaker_id >= 0) {
+            last = _id_slot(table, size, rec->speaker_id);
+        }
+        int prev_row = (last && *last != -1 && db->speakers_db[*last].speaker_id != -1) ? *last : -1;
+        _apply_store_row(handle, db, slot, prev_row);
+        if (last) {
+            *last = (rec->op == SV_STORE_OP_ADD) ? slot : -1;
+        }
+    }
+
+    // 마지막 ADD가 판정에서 제외된 ID는 다른 모델로 등록된 화자
+    for (int i = 0; i < size; ++i) {
+        int slot = table[2 * i + 1];
+        if (table[2 * i] != -1 && slot != -1 && db->speakers_db[slot].speaker_id == -1) {
+            _enroll_add_stale(handle, table[2 * i], sv_store_record(store, slot)->name);
+        }
+    }
+    free(table);
+}
+
+/**
+ * @brief [Private] open addressing table에서 speaker_id의 값 칸을 찾습니다. (없으면 값 -1로 추가)
+ * table은 [size][2] (ID, 값), size는 2의 거듭제곱이며 항목 수의 두 배 이상
+ */
+static int* _id_slot(int* table, int size, int speaker_id) {
+    uint32_t i = ((uint32_t)speaker_id * 2654435761u) & (uint32_t)(size - 1); // Knuth 곱셈 hash
+    while (table[2 * i] != -1 && table[2 * i] != speaker_id) {
+        i = (i + 1) & (uint32_t)(size - 1);
+    }
+    table[2 * i] = speaker_id;
+    return &table[2 * i + 1];
+}
+
+/**
+ * @brief [Private] record를 만든 모델의 hash (hash 없이 기록된 record와 추적하지 않는 handle은 현재 모델로 간주)
+ */
+static uint32_t _store_record_hash(const sv_handle_t* handle, const sv_store_record_t* rec) {
+    if (rec->model_hash == 0 || rec->model_hash == SV_STORE_HASH_NONE || handle->settings.model_hash == 0) {
+        return handle->settings.model_hash;
+    }
+    return rec->model_hash;
+}
+
+/**
+ * @brief [Private] slot번째 record를 DB 행 slot에 반영합니다. (record 하나를 추가할 때)
+ * ADD는 같은 ID의 이전 행을 대체하고, DEL은 해당 ID의 행을 삭제합니다.
+ * DEL record 자신과 끊긴 쓰기(op가 지워진 record)는 삭제된 행으로 남습니다.
+ */
+static void _apply_store_record(sv_handle_t* handle, sv_db_t* db, int slot) {
+    const sv_store_record_t* rec = sv_store_record(handle->store, slot);
+    bool has_id = (rec->op == SV_STORE_OP_ADD || rec->op == SV_STORE_OP_DEL);
+
+    int prev_row = has_id ? _find_row(db, rec->speaker_id) : -1;
+    if (prev_row == -1 && has_id && handle->enrolls) {
+        _enroll_remove(handle, rec->speaker_id); // 다른 모델로 등록되었던 같은 ID
+    }
+    if (!_apply_store_row(handle, db, slot, prev_row) && rec->op == SV_STORE_OP_ADD) {
+        _enroll_add_stale(handle, rec->speaker_id, rec->name);
+    }
+}
+
+/**
+ * @brief [Private] record를 DB 행 slot에 반영하고 같은 ID의 이전 행(prev_row, -1: 없음)을 삭제합니다.
+ * @return 판정에 쓰이는 행이 되었으면 true (DEL, 끊긴 쓰기, 다른 모델의 ADD는 false)
+ */
+static bool _apply_store_row(sv_handle_t* handle, sv_db_t* db, int slot, int prev_row) {
+    const sv_store_record_t* rec = sv_store_record(handle->store, slot);
+    sv_speaker_entry_t* entry = &db->speakers_db[slot];
+
+    if (prev_row != -1) {
+        _kill_row(db, prev_row);
+    }
+    db->num_speakers = slot + 1;
+
+    if (rec->op != SV_STORE_OP_ADD) {
+        _kill_row(db, slot);
+        return false;
+    }
+    if (rec->speaker_id >= handle->next_speaker_id) {
+        handle->next_speaker_id = rec->speaker_id + 1;
+    }
+
+    // 다른 모델의 임베딩은 판정에서 제외 (record는 남으므로 그 모델로 되돌리면 다시 로드됨)
+    // 화자는 ID와 이름만 대기 목록에 남겨 삭제할 수 있게 함 (호출자)
+    uint32_t hash = _store_record_hash(handle, rec);
+    if (hash != handle->settings.model_hash) {
+        _kill_row(db, slot);
+        return false;
+    }
+
+    entry->speaker_id = rec->speaker_id;
+    strncpy(entry->speaker_name, rec->name, SV_MAX_NAME_LEN - 1);
+    entry->speaker_name[SV_MAX_NAME_LEN - 1] = '\0'; // 널 종료 보장
+    entry->model_hash = hash;
+    if (db->row_bias) {
+        db->row_bias[slot] = handle->backend->row_bias(handle, (const float*)sv_db_row(db, slot));
+    }
+    if (db->suffix_norms) {
+        _update_suffix_norms(handle, db, slot);
+    }
+    if (handle->settings.score_norm == SV_NORM_ASNORM) {
+        _update_enroll_stats(handle, db, slot);
+    }
+    return true;
+}
+
+/**
+ * @brief [Private] 저장소 모드의 모델 교체
+ * 저장소는 등록 특징을 보관하지 않아 재임베딩할 수 없으므로, 현재 모델로 등록된 화자가 남아 있으면 거부합니다.
+ * 받아들이면 journal을 새 모델 기준으로 다시 반영합니다. (이전에 그 모델로 등록된 화자는 다시 판정됨)
+ */
+static sv_status_t _store_set_model(sv_handle_t* handle, uint32_t model_hash) {
+    sv_db_t* db = _db_begin_write(handle);
+    if (!db) {
+        LOG_E(TAG, "Failed to allocate DB snapshot");
+        return SV_ERROR;
+    }
+    int live = 0;
+    for (int r = 0; r < db->num_speakers; ++r) {
+        if (db->speakers_db[r].speaker_id != -1) {
+            live++;
+        }
+    }
+    if (model_hash == handle->settings.model_hash || live > 0) {
+        _db_free(db);
+        pthread_mutex_unlock(&handle->write_lock);
+        if (live > 0 && model_hash != handle->settings.model_hash) {
+            LOG_E(TAG, "Model swap refused: %d stored speakers cannot be re-embedded (unregister them first)", live);
+            return SV_ERROR;
+        }
+        return SV_SUCCESS;
+    }
+
+    handle->settings.model_hash = model_hash;
+    db->num_cohort = 0; // 이전 모델의 임베딩 공간
+    _sync_store_view(handle, db);
+    _ivf_rebuild(handle, db);
+    db->layout_id++;
+    int restored = db->num_speakers - db->num_dead;
+    _db_publish(handle, db);
+    pthread_mutex_unlock(&handle->write_lock);
+
+    LOG_I(TAG, "Model changed (hash %08x): %d stored speakers restored", (unsigned)model_hash, restored);
+    return SV_SUCCESS;
+}
+
+/**
+ * @brief [Private] journal에 record slots개를 쓸 자리를 확보합니다.
+ * 자리가 부족하면 compaction을 수행하며, 이때 DB 행 번호가 바뀌므로 view를 다시 구성하고 layout_id를 올립니다.
+ */
+static sv_status_t _reserve_store_slots(sv_handle_t* handle, sv_db_t* db, int slots) {
+    sv_store_t* store = handle->store;
+    if (store->used + slots <= store->capacity) {
+        return SV_SUCCESS;
+    }
+
+    // compaction은 이전 bank를 지우고 다시 쓰므로, 그 bank를 가리키던 snapshot이 모두 해제될 때까지 대기
+    _db_synchronize(handle);
+    if (sv_store_compact(store) != SV_SUCCESS) {
+        return SV_ERROR;
+    }
+    _sync_store_view(handle, db);
+    _ivf_rebuild(handle, db);
+    db->layout_id++; // 판정 task가 다음 판정에서 후처리 상태를 초기화
+
+    return (store->used + slots <= store->capacity) ? SV_SUCCESS : SV_ERROR;
+}
+
+static int _find_row(const sv_db_t* db, int speaker_id) {
+    if (speaker_id < 0) {
+        return -1;
+    }
+    for (int i = 0; i < db->num_speakers; ++i) {
+        if (db->speakers_db[i].speaker_id == speaker_id) {
+            return db->templates ? db->templates[i].lead : i;
+        }
+    }
+    return -1;
+}
+
+static void _kill_row(sv_db_t* db, int row) {
+    db->speakers_db[row].speaker_id = -1;
+    db->speakers_db[row].speaker_name[0] = '\0';
+    db->num_dead++;
+}
+
+/**
+ * @brief [Private] template 정보를 옮기고, 옮겨진 행을 가리키던 연결(lead의 next 목록 또는 template들의 lead)을 고칩니다.
+ */
+static void _template_move(sv_db_t* db, int from, int to) {
+    sv_template_t* t = db->templates;
+    t[to] = t[from];
+    if (t[to].lead == from) {
+        for (int r = to; r != -1; r = t[r].next) {
+            t[r].lead = to;
+        }
+    } else {
+        int prev = t[to].lead;
+        while (t[prev].next != from) {
+            prev = t[prev].next;
+        }
+        t[prev].next = to;
+    }
+}
+
+static void _db_row_f32(const sv_handle_t* handle, const sv_db_t* db, int row, float* out) {
+    const void* v = sv_db_row(db, row);
+    float scale = db->row_scales ? db->row_scales[row] : 1.0f;
+
+    switch (handle->settings.db_format) {
+        case SV_DB_INT8:
+            scale *= db->q_scales[row];
+            for (int d = 0; d < handle->dim; ++d) {
+                out[d] = (float)((const int8_t*)v)[d] * scale;
+            }
+            break;
+        case SV_DB_FP16:
+            for (int d = 0; d < handle->dim; ++d) {
+                out[d] = sv_f16_to_f32(((const uint16_t*)v)[d]) * scale;
+            }
+            break;
+        default:
+            for (int d = 0; d < handle->dim; ++d) {
+                out[d] = ((const float*)v)[d] * scale;
+            }
+            break;
+    }
+}
+
+static void _update_suffix_norms(const sv_handle_t* handle, sv_db_t* db, int row) {
+    float v[SV_MAX_EMBEDDING_DIM];
+    _db_row_f32(handle, db, row, v);
+    _suffix_norms(v, handle->dim, handle->abandon_block, &db->suffix_norms[(size_t)row * SV_ABANDON_BLOCKS]);
+}
+
+/**
+ * @brief [Private] 살아 있는 모든 행으로 IVF 색인을 다시 만듭니다. (쓰기 잠금 상태, 게시 전 snapshot에 호출)
+ * 행이 적거나 메모리가 부족하면 색인 없이 선형 탐색합니다. (행 번호가 바뀐 뒤에도 항상 올바름)
+ */
+static void _ivf_rebuild(sv_handle_t* handle, sv_db_t* db) {
+    if (handle->settings.ivf_lists <= 0) {
+        return;
+    }
+    db->ivf = NULL;
+    db->num_pending = 0;
+    int live = db->num_speakers - db->num_dead;
+    if (live < 2 * SV_IVF_MIN_LIST_SIZE) {
+        return;
+    }
+
+    float* vecs = (float*)sv_aligned_alloc(sizeof(float) * live * handle->dim);
+    int* rows = (int*)malloc(sizeof(int) * live);
+    if (!vecs || !rows) {
+        LOG_E(TAG, "Failed to allocate index build buffers (%d rows)", live);
+        sv_aligned_free(vecs);
+        free(rows);
+        return;
+    }
+    int n = 0;
+    for (int r = 0; r < db->num_speakers; ++r) {
+        if (db->speakers_db[r].speaker_id != -1) {
+            _db_row_f32(handle, db, r, &vecs[(size_t)n * handle->dim]);
+            rows[n++] = r;
+        }
+    }
+
+    db->ivf = sv_ivf_build(vecs, rows, n, handle->dim, handle->settings.ivf_lists);
+    sv_aligned_free(vecs);
+    free(rows);
+}
+
+static void _ivf_add_row(sv_handle_t* handle, sv_db_t* db, int row) {
+    if (handle->settings.ivf_lists <= 0) {
+        return;
+    }
+    // 색인이 없으면 (행이 적음) 다시 시도, 있으면 대기 목록이 색인 행 수의 1/SV_IVF_REBUILD_DIV를 넘을 때만
+    if (!db->ivf || db->num_pending == db->capacity ||
+        db->num_pending >= db->ivf->num_rows / SV_IVF_REBUILD_DIV) {
+        _ivf_rebuild(handle, db); // 새 색인(또는 선형 탐색)에 이 행도 포함됨
+        return;
+    }
+    db->ivf_pending[db->num_pending++] = row;
+}
+
+/**
+ * @brief [Private] 연속으로 매핑된 행렬(행 간격 row_bytes)을 chunk 테이블로 나눕니다.
+ */
+static void _map_chunks(sv_db_t* db, const uint8_t* base, size_t row_bytes, int rows) {
+    db->row_bytes = row_bytes;
+    for (int c = 0; c * SV_DB_CHUNK_ROWS < rows; ++c) {
+        db->chunks[c] = base + (size_t)c * SV_DB_CHUNK_ROWS * row_bytes;
+    }
+}
+
+/**
+ * @brief [Private] 빈 DB snapshot을 할당합니다. (임베딩 chunk는 snapshot 사이에 공유되므로 포함하지 않음)
+ * capacity는 SV_DB_CHUNK_ROWS의 배수로 올림 (최소 chunk 하나)
+ */
+static sv_db_t* _db_alloc(const sv_handle_t* handle, int capacity) {
+    sv_db_t* db = (sv_db_t*)calloc(1, sizeof(sv_db_t));
+    if (!db) {
+        return NULL;
+    }
+    if (_db_reserve(handle, db, capacity) != SV_SUCCESS) {
+        _db_free(db);
+        return NULL;
+    }
+    return db;
+}
+
+static void _db_free(void* ptr) {
+    sv_db_t* db = (sv_db_t*)ptr;
+    if (db) {
+        free(db->speakers_db);
+        free(db->chunks);
+        free(db->q_scales);
+        free(db->row_bias);
+        free(db->suffix_norms);
+        free(db->ivf_pending);
+        free(db->enroll_mean);
+        free(db->enroll_std);
+        free(db->templates);
+        free(db);
+    }
+}
+
+/**
+ * @brief [Private] snapshot의 행별 배열을 capacity 행까지 늘립니다. (기존 내용 유지)
+ * 일부 배열만 늘어난 채 실패해도 capacity는 그대로이므로 snapshot은 일관됩니다.
+ */
+static sv_status_t _db_reserve(const sv_handle_t* handle, sv_db_t* db, int capacity) {
+    if (capacity < SV_DB_CHUNK_ROWS) {
+        capacity = SV_DB_CHUNK_ROWS;
+    }
+    capacity = (capacity + SV_DB_CHUNK_ROWS - 1) & ~(SV_DB_CHUNK_ROWS - 1);
+    if (capacity <= db->capacity) {
+        return SV_SUCCESS;
+    }
+
+    void* p = realloc(db->speakers_db, sizeof(sv_speaker_entry_t) * capacity);
+    if (!p) return SV_ERROR;
+    db->speakers_db = (sv_speaker_entry_t*)p;
+
+    int num_chunks = capacity >> SV_DB_CHUNK_SHIFT;
+    p = realloc(db->chunks, sizeof(uint8_t*) * num_chunks);
+    if (!p) return SV_ERROR;
+    db->chunks = (const uint8_t**)p;
+    for (int c = db->capacity >> SV_DB_CHUNK_SHIFT; c < num_chunks; ++c) {
+        db->chunks[c] = NULL;
+    }
+
+    if (handle->settings.db_format == SV_DB_INT8) {
+        p = realloc(db->q_scales, sizeof(float) * capacity);
+        if (!p) return SV_ERROR;
+        db->q_scales = (float*)p;
+    }
+    if (handle->backend->row_bias) {
+        p = realloc(db->row_bias, sizeof(float) * capacity);
+        if (!p) return SV_ERROR;
+        db->row_bias = (float*)p;
+    }
+    if (handle->settings.scan == SV_SCAN_EARLY_ABANDON) {
+        p = realloc(db->suffix_norms, sizeof(float) * SV_ABANDON_BLOCKS * capacity);
+        if (!p) return SV_ERROR;
+        db->suffix_norms = (float*)p;
+    }
+    if (handle->settings.ivf_lists > 0) {
+        p = realloc(db->ivf_pending, sizeof(int) * capacity);
+        if (!p) return SV_ERROR;
+        db->ivf_pending = (int*)p;
+    }
+    if (handle->settings.score_norm == SV_NORM_ASNORM) {
+        p = realloc(db->enroll_mean, sizeof(float) * capacity);
+        if (!p) return SV_ERROR;
+        db->enroll_mean = (float*)p;
+        p = realloc(db->enroll_std, sizeof(float) * capacity);
+        if (!p) return SV_ERROR;
+        db->enroll_std = (float*)p;
+    }
+    if (!handle->store && !handle->image) {
+        p = realloc(db->templates, sizeof(sv_template_t) * capacity);
+        if (!p) return SV_ERROR;
+        db->templates = (sv_template_t*)p;
+    }
+
+    db->capacity = capacity;
+    return SV_SUCCESS;
+}
+
+/**
+ * @brief [Private] 현재 snapshot의 사본을 만듭니다. (쓰기 잠금 상태에서 호출)
+ * 행별 배열은 살아 있는 행(num_speakers)까지만 복사하며, 공유 포인터(chunk, cohort)는 그대로 가져갑니다.
+ */
+static sv_db_t* _db_copy(sv_handle_t* handle) {
+    const sv_db_t* cur = atomic_load(&handle->db);
+    sv_db_t* next = _db_alloc(handle, cur->capacity);
+    if (!next) {
+        return NULL;
+    }
+
+    sv_speaker_entry_t* speakers_db = next->speakers_db;
+    const uint8_t** chunks = next->chunks;
+    float* q_scales = next->q_scales;
+    float* row_bias = next->row_bias;
+    float* suffix_norms = next->suffix_norms;
+    int* ivf_pending = next->ivf_pending;
+    float* enroll_mean = next->enroll_mean;
+    float* enroll_std = next->enroll_std;
+    sv_template_t* templates = next->templates;
+    *next = *cur;
+    next->speakers_db = speakers_db;
+    next->chunks = chunks;
+    next->q_scales = q_scales;
+    next->row_bias = row_bias;
+    next->suffix_norms = suffix_norms;
+    next->ivf_pending = ivf_pending;
+    next->enroll_mean = enroll_mean;
+    next->enroll_std = enroll_std;
+    next->templates = templates;
+
+    int n = cur->num_speakers;
+    memcpy(next->speakers_db, cur->speakers_db, sizeof(sv_speaker_entry_t) * n);
+    memcpy(next->chunks, cur->chunks, sizeof(uint8_t*) * (cur->capacity >> SV_DB_CHUNK_SHIFT));
+    if (q_scales) {
+        memcpy(next->q_scales, cur->q_scales, sizeof(float) * n);
+    }
+    if (row_bias) {
+        memcpy(next->row_bias, cur->row_bias, sizeof(float) * n);
+    }
+    if (suffix_norms) {
+        memcpy(next->suffix_norms, cur->suffix_norms, sizeof(float) * SV_ABANDON_BLOCKS * n);
+    }
+    if (ivf_pending) {
+        memcpy(next->ivf_pending, cur->ivf_pending, sizeof(int) * cur->num_pending);
+    }
+    if (enroll_mean) {
+        memcpy(next->enroll_mean, cur->enroll_mean, sizeof(float) * n);
+        memcpy(next->enroll_std, cur->enroll_std, sizeof(float) * n);
+    }
+    if (templates) {
+        memcpy(next->templates, cur->templates, sizeof(sv_template_t) * n);
+    }
+    return next;
+}
+
+/**
+ * @brief [Private] 쓰기 잠금을 잡고 현재 snapshot의 사본을 만듭니다.
+ */
+static sv_db_t* _db_begin_write(sv_handle_t* handle) {
+    pthread_mutex_lock(&handle->write_lock);
+
+    sv_db_t* next = _db_copy(handle);
+    if (!next) {
+        pthread_mutex_unlock(&handle->write_lock);
+        return NULL;
+    }
+    return next;
+}
+
+/**
+ * @brief [Private] 쓰기 잠금을 기다리지 않고 잡아 현재 snapshot의 사본을 만듭니다. (판정 thread용)
+ * 다른 writer(등록/삭제, 저장소 compaction 등)가 잠금을 잡고 있으면 바로 SV_BUSY를 반환합니다.
+ *
+ * @return SV_SUCCESS(*out에 사본, 잠금 유지), SV_BUSY, SV_ERROR(메모리 부족)
+ */
+static sv_status_t _db_try_begin_write(sv_handle_t* handle, sv_db_t** out) {
+    if (pthread_mutex_trylock(&handle->write_lock) != 0) {
+        return SV_BUSY;
+    }
+    *out = _db_copy(handle);
+    if (!*out) {
+        pthread_mutex_unlock(&handle->write_lock);
+        return SV_ERROR;
+    }
+    return SV_SUCCESS;
+}
+
+/**
+ * @brief [Private] 사본을 현재 snapshot으로 교체합니다.
+ * 교체 후 epoch를 올리므로, 이전 snapshot은 그 epoch 이전에 들어온 reader가 모두 나가면 해제됩니다.
+ */
+static void _db_publish(sv_handle_t* handle, sv_db_t* next) {
+    sv_db_t* prev = atomic_exchange(&handle->db, next);
+    atomic_fetch_add(&handle->epoch, 1);
+    if (prev->ivf != next->ivf) {
+        _db_retire(handle, prev->ivf, sv_ivf_destroy); // 색인은 snapshot 간 공유, 교체될 때만 해제
+    }
+    _db_retire(handle, prev, _db_free);
+    _db_reclaim(handle, false);
+}
+
+static void _db_retire(sv_handle_t* handle, void* ptr, void (*free_fn)(void*)) {
+    if (!ptr) {
+        return;
+    }
+    sv_retired_t* node = (sv_retired_t*)malloc(sizeof(sv_retired_t));
+    if (!node) {
+        // 해제 대기 목록에 넣을 수 없으면 이전 reader가 모두 나갈 때까지 기다렸다가 바로 해제
+        uint32_t epoch = atomic_load(&handle->epoch);
+        while (_reader_min_epoch(handle) < epoch) {
+            usleep(1000);
+        }
+        free_fn(ptr);
+        return;
+    }
+    node->ptr = ptr;
+    node->free_fn = free_fn;
+    node->row = -1;
+    node->epoch = atomic_load(&handle->epoch);
+    node->next = handle->retired;
+    handle->retired = node;
+}
+
+static void _db_retire_row(sv_handle_t* handle, int row) {
+    sv_retired_t* node = (sv_retired_t*)malloc(sizeof(sv_retired_t));
+    if (!node) {
+        return; // 재사용하지 않고 다음 compaction에서 정리
+    }
+    node->ptr = NULL;
+    node->free_fn = NULL;
+    node->row = row;
+    node->epoch = atomic_load(&handle->epoch);
+    node->next = handle->retired;
+    handle->retired = node;
+}
+
+static void _db_reclaim(sv_handle_t* handle, bool force) {
+    uint32_t min_epoch = force ? UINT32_MAX : _reader_min_epoch(handle);
+
+    sv_retired_t** link = &handle->retired;
+    while (*link) {
+        sv_retired_t* node = *link;
+        if (node->epoch <= min_epoch) {
+            *link = node->next;
+            if (node->row >= 0) {
+                sv_pool_free(handle->pool, node->row);
+            } else {
+                node->free_fn(node->ptr);
+            }
+            free(node);
+        } else {
+            link = &node->next;
+        }
+    }
+}
+
+static void _db_synchronize(sv_handle_t* handle) {
+    _db_reclaim(handle, false);
+    while (handle->retired) {
+        usleep(1000); // 판정 1회보다 짧은 간격으로 재확인
+        _db_reclaim(handle, false);
+    }
+}
+
+static uint32_t _reader_min_epoch(sv_handle_t* handle) {
+    uint32_t min_epoch = UINT32_MAX;
+    for (int i = 0; i < SV_MAX_READERS; ++i) {
+        uint32_t e = atomic_load(&handle->reader_epoch[i]);
+        if (e != 0 && e < min_epoch) {
+            min_epoch = e;
+        }
+    }
+    return min_epoch;
+}
+
+/**
+ * @brief [Private] reader slot에 현재 epoch를 기록한 뒤 snapshot을 읽습니다.
+ * slot 기록이 snapshot 읽기보다 먼저이므로, writer는 이 reader가 볼 수 있는 snapshot을 해제하지 않습니다.
+ * slot이 모두 사용 중이면 (SV_MAX_READERS 초과) 빌 때까지 양보합니다.
+ */
+static int _reader_enter(sv_handle_t* handle, const sv_db_t** db) {
+    for (;;) {
+        for (int i = 0; i < SV_MAX_READERS; ++i) {
+            uint32_t idle = 0;
+            uint32_t epoch = atomic_load(&handle->epoch);
+            if (atomic_compare_exchange_strong(&handle->reader_epoch[i], &idle, epoch)) {
+                *db = atomic_load(&handle->db);
+                return i;
+            }
+        }
+        sched_yield();
+    }
+}
+
+static void _reader_exit(sv_handle_t* handle, int slot) {
+    atomic_store(&handle->reader_epoch[slot], 0);
+}
+
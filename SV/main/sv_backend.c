@@ -0,0 +1,203 @@
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h> // malloc, free
+#include <math.h>   // log, sqrt
+
+#include "sv_backend.h"
+#include "sv_kernels.h"        // sv_l2_normalize, sv_matvec_f32, sv_aligned_alloc
+#include "sv_projection.h"     // psi_offset, SV_PROJ_FLAG_PLDA
+
+#define LOG_I(tag, format, ...) printf("[%s] " format "\n", tag, ##__VA_ARGS__)
+#define LOG_E(tag, format, ...) printf("[ERROR %s] " format "\n", tag, ##__VA_ARGS__)
+
+
+//=========================== typedef ===========================
+// PLDA 점수 계수 (handle->backend_ctx, 모두 [handle->dim])
+// 변환된 공간에서 화자 간 분산 psi, 화자 내 분산 1인 two-covariance 모델의 로그 우도비:
+//   llr(e, t) = sum_i cross_i * e_i * t_i + square_i * (e_i^2 + t_i^2) + constant
+//   cross_i  = psi / (2 psi + 1)
+//   square_i = -0.5 psi^2 / ((psi + 1)(2 psi + 1))
+//   constant = sum_i 0.5 * ln((psi + 1)^2 / (2 psi + 1))
+// 변환된 벡터는 길이를 모델의 기대 norm sqrt(sum_i (psi_i + 1))로 맞춥니다.
+// (여러 녹음의 평균 임베딩도 단일 발화와 같은 분포로 점수 계산)
+typedef struct {
+    float* cross;
+    float* square;
+    float constant;
+    float norm;
+} sv_plda_t;
+
+
+//=========================== variables ===========================
+static const char* TAG = SV_LOG_TAG;
+
+
+//=========================== prototypes ==========================
+// y = matrix * (x - mean) (projection이 있을 때만 호출)
+static void _project(const sv_handle_t* handle, const float* in, float* out);
+
+static sv_status_t _cosine_create(sv_handle_t* handle);
+static void _cosine_destroy(sv_handle_t* handle);
+static void _cosine_enroll(const sv_handle_t* handle, const float* in, float* out);
+static void _cosine_query(const sv_handle_t* handle, const float* in, float* out, float* query_bias);
+
+static sv_status_t _plda_create(sv_handle_t* handle);
+static void _plda_destroy(sv_handle_t* handle);
+static void _plda_enroll(const sv_handle_t* handle, const float* in, float* out);
+static float _plda_row_bias(const sv_handle_t* handle, const float* row);
+static void _plda_query(const sv_handle_t* handle, const float* in, float* out, float* query_bias);
+
+
+//=========================== public ==============================
+const sv_backend_ops_t sv_backend_cosine = {
+    .name = "cosine",
+    .unit_rows = true,
+    .create = _cosine_create,
+    .destroy = _cosine_destroy,
+    .enroll = _cosine_enroll,
+    .row_bias = NULL,
+    .query = _cosine_query,
+};
+
+const sv_backend_ops_t sv_backend_plda = {
+    .name = "plda",
+    .unit_rows = false,
+    .create = _plda_create,
+    .destroy = _plda_destroy,
+    .enroll = _plda_enroll,
+    .row_bias = _plda_row_bias,
+    .query = _plda_query,
+};
+
+
+//=========================== private ==============================
+static void _project(const sv_handle_t* handle, const float* in, float* out) {
+    int in_dim = handle->embedding_dim;
+    float centered[SV_MAX_EMBEDDING_DIM] __attribute__((aligned(SV_KERNEL_ALIGN)));
+    for (int i = 0; i < in_dim; ++i) {
+        centered[i] = in[i] - handle->proj_mean[i];
+    }
+    sv_matvec_f32(handle->proj_matrix, in_dim, centered, in_dim, handle->dim, out);
+}
+
+static sv_status_t _cosine_create(sv_handle_t* handle) {
+    (void)handle;
+    return SV_SUCCESS;
+}
+
+static void _cosine_destroy(sv_handle_t* handle) {
+    (void)handle;
+}
+
+/**
+ * @brief [Private] 입력 임베딩을 점수 계산 공간의 단위 벡터로 만듭니다.
+ * projection이 있으면 y = matrix * (x - mean)으로 handle->dim 차원으로 줄인 뒤 정규화합니다. (O(dim·D))
+ */
+static void _cosine_enroll(const sv_handle_t* handle, const float* in, float* out) {
+    if (!handle->projection) {
+        sv_l2_normalize(in, out, handle->embedding_dim);
+        return;
+    }
+    _project(handle, in, out);
+    sv_l2_normalize(out, out, handle->dim);
+}
+
+static void _cosine_query(const sv_handle_t* handle, const float* in, float* out, float* query_bias) {
+    _cosine_enroll(handle, in, out);
+    *query_bias = 0.0f;
+}
+
+/**
+ * @brief [Private] PLDA 모델(psi)로 점수 계수를 미리 계산합니다.
+ * PLDA 모델이 아닌 projection이면 SV_ERROR (호출자가 cosine으로 대체)
+ */
+static sv_status_t _plda_create(sv_handle_t* handle) {
+    const sv_projection_header_t* proj = handle->projection;
+    if (!proj || !(proj->flags & SV_PROJ_FLAG_PLDA) || proj->psi_offset == 0 ||
+        proj->psi_offset + sizeof(float) * proj->out_dim > proj->total_size) {
+        LOG_E(TAG, "PLDA backend requires a PLDA projection (sv_fit_projection ... plda)");
+        return SV_ERROR;
+    }
+
+    sv_plda_t* plda = (sv_plda_t*)calloc(1, sizeof(sv_plda_t));
+    if (!plda) {
+        return SV_ERROR;
+    }
+    plda->cross = (float*)sv_aligned_alloc(sizeof(float) * handle->dim);
+    plda->square = (float*)sv_aligned_alloc(sizeof(float) * handle->dim);
+    if (!plda->cross || !plda->square) {
+        sv_aligned_free(plda->cross);
+        sv_aligned_free(plda->square);
+        free(plda);
+        return SV_ERROR;
+    }
+
+    const float* psi = (const float*)((const uint8_t*)proj + proj->psi_offset);
+    double constant = 0.0, norm_sq = 0.0;
+    for (int i = 0; i < handle->dim; ++i) {
+        double p = (psi[i] > 0.0f) ? psi[i] : 0.0;
+        norm_sq += p + 1.0;
+        plda->cross[i] = (float)(p / (2.0 * p + 1.0));
+        plda->square[i] = (float)(-0.5 * p * p / ((p + 1.0) * (2.0 * p + 1.0)));
+        constant += 0.5 * log((p + 1.0) * (p + 1.0) / (2.0 * p + 1.0));
+    }
+    plda->constant = (float)constant;
+    plda->norm = (float)sqrt(norm_sq);
+    handle->backend_ctx = plda;
+
+    LOG_I(TAG, "PLDA backend: %d dims, psi[0] = %.2f", handle->dim, psi[0]);
+    return SV_SUCCESS;
+}
+
+static void _plda_destroy(sv_handle_t* handle) {
+    sv_plda_t* plda = (sv_plda_t*)handle->backend_ctx;
+    if (plda) {
+        sv_aligned_free(plda->cross);
+        sv_aligned_free(plda->square);
+        free(plda);
+        handle->backend_ctx = NULL;
+    }
+}
+
+/**
+ * @brief [Private] 입력 임베딩을 PLDA 공간으로 변환합니다.
+ * 길이 정규화 -> 투영 -> 모델의 기대 norm으로 길이 조정 (O(dim·D))
+ */
+static void _plda_enroll(const sv_handle_t* handle, const float* in, float* out) {
+    const sv_plda_t* plda = (const sv_plda_t*)handle->backend_ctx;
+    float unit[SV_MAX_EMBEDDING_DIM] __attribute__((aligned(SV_KERNEL_ALIGN)));
+    sv_l2_normalize(in, unit, handle->embedding_dim);
+    _project(handle, unit, out);
+
+    sv_l2_normalize(out, out, handle->dim);
+    for (int i = 0; i < handle->dim; ++i) {
+        out[i] *= plda->norm;
+    }
+}
+
+/**
+ * @brief [Private] 등록 화자 쪽 상수 항: sum_i square_i * e_i^2 + constant (등록/로드 시 한 번)
+ */
+static float _plda_row_bias(const sv_handle_t* handle, const float* row) {
+    const sv_plda_t* plda = (const sv_plda_t*)handle->backend_ctx;
+    float bias = plda->constant;
+    for (int i = 0; i < handle->dim; ++i) {
+        bias += plda->square[i] * row[i] * row[i];
+    }
+    return bias;
+}
+
+/**
+ * @brief [Private] 쿼리 벡터 cross ∘ t와 쿼리 쪽 상수 항 sum_i square_i * t_i^2 (판정마다 한 번)
+ */
+static void _plda_query(const sv_handle_t* handle, const float* in, float* out, float* query_bias) {
+    const sv_plda_t* plda = (const sv_plda_t*)handle->backend_ctx;
+    _plda_enroll(handle, in, out);
+
+    float bias = 0.0f;
+    for (int i = 0; i < handle->dim; ++i) {
+        bias += plda->square[i] * out[i] * out[i];
+        out[i] *= plda->cross[i];
+    }
+    *query_bias = bias;
+}
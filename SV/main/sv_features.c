@@ -0,0 +1,106 @@
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h> // malloc, free
+#include <string.h> // memset
+
+#include "sv_features.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#endif
+
+#define LOG_I(tag, format, ...) printf("[%s] " format "\n", tag, ##__VA_ARGS__)
+#define LOG_E(tag, format, ...) printf("[ERROR %s] " format "\n", tag, ##__VA_ARGS__)
+
+
+//=========================== variables ===========================
+static const char* TAG = SV_FEATURES_TAG;
+
+
+//=========================== prototypes ==========================
+// 블록 메모리 할당 (target: PSRAM 우선)
+static void* _block_alloc(size_t size);
+
+
+//=========================== public ==============================
+sv_features_t* sv_features_encode(const float* features, int num_frames, int num_bins) {
+    if (!features || num_frames <= 0 || num_bins <= 0 || num_frames > UINT16_MAX || num_bins > UINT16_MAX) {
+        return NULL;
+    }
+
+    size_t size = sizeof(sv_features_t) + sizeof(float) * 2 * num_bins + (size_t)num_frames * num_bins;
+    uint8_t* block = (uint8_t*)_block_alloc(size);
+    if (!block) {
+        LOG_E(TAG, "Failed to allocate features (%u bytes)", (unsigned)size);
+        return NULL;
+    }
+    sv_features_t* f = (sv_features_t*)block;
+    float* offset = (float*)(block + sizeof(sv_features_t));
+    float* step = offset + num_bins;
+    uint8_t* q = (uint8_t*)(step + num_bins);
+    f->next = NULL;
+    f->num_frames = (uint16_t)num_frames;
+    f->num_bins = (uint16_t)num_bins;
+    f->offset = offset;
+    f->step = step;
+    f->q = q;
+
+    // bin별 범위 (log-mel은 bin마다 수준이 달라 bin별 scale이 오차가 작음)
+    for (int b = 0; b < num_bins; ++b) {
+        offset[b] = features[b];
+        step[b] = features[b];
+    }
+    for (int t = 1; t < num_frames; ++t) {
+        const float* row = &features[(size_t)t * num_bins];
+        for (int b = 0; b < num_bins; ++b) {
+            if (row[b] < offset[b]) offset[b] = row[b];
+            if (row[b] > step[b]) step[b] = row[b];
+        }
+    }
+    for (int b = 0; b < num_bins; ++b) {
+        step[b] = (step[b] - offset[b]) / 255.0f;
+    }
+
+    for (int t = 0; t < num_frames; ++t) {
+        const float* row = &features[(size_t)t * num_bins];
+        uint8_t* out = &q[(size_t)t * num_bins];
+        for (int b = 0; b < num_bins; ++b) {
+            out[b] = (step[b] > 0.0f) ? (uint8_t)((row[b] - offset[b]) / step[b] + 0.5f) : 0;
+        }
+    }
+    return f;
+}
+
+void sv_features_decode(const sv_features_t* features, float* out) {
+    int num_bins = features->num_bins;
+    for (int t = 0; t < features->num_frames; ++t) {
+        const uint8_t* q = &features->q[(size_t)t * num_bins];
+        float* row = &out[(size_t)t * num_bins];
+        for (int b = 0; b < num_bins; ++b) {
+            row[b] = features->offset[b] + (float)q[b] * features->step[b];
+        }
+    }
+}
+
+void sv_features_free(sv_features_t* features) {
+#ifdef ESP_PLATFORM
+    heap_caps_free(features);
+#else
+    free(features);
+#endif
+}
+
+
+//=========================== private ==============================
+static void* _block_alloc(size_t size) {
+#ifdef ESP_PLATFORM
+    // 재임베딩 때만 읽으므로 PSRAM에 두고 내부 RAM은 남겨 둠
+    void* block = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (block) {
+        return block;
+    }
+    return heap_caps_malloc(size, MALLOC_CAP_8BIT);
+#else
+    return malloc(size);
+#endif
+}
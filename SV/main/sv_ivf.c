@@ -0,0 +1,164 @@
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h> // malloc, calloc, free
+#include <string.h> // memcpy, memset
+
+#include "sv_ivf.h"
+#include "sv_kernels.h"        // sv_matvec_f32, sv_l2_normalize, sv_aligned_alloc
+
+#define LOG_I(tag, format, ...) printf("[%s] " format "\n", tag, ##__VA_ARGS__)
+#define LOG_E(tag, format, ...) printf("[ERROR %s] " format "\n", tag, ##__VA_ARGS__)
+
+
+//=========================== variables ===========================
+static const char* TAG = SV_IVF_TAG;
+
+
+//=========================== prototypes ==========================
+// 각 벡터를 내적이 가장 큰 중심에 배정 (best: 배정된 중심과의 내적, NULL 허용)
+static void _assign(const sv_ivf_t* ivf, const float* vecs, int n, float* work, int* assign, float* best);
+
+// 배정 결과로 중심을 다시 계산 (빈 목록은 현재 중심과 가장 먼 벡터로 다시 시작)
+static void _update_centroids(sv_ivf_t* ivf, const float* vecs, int n, const int* assign, float* best);
+
+
+//=========================== public ==============================
+sv_ivf_t* sv_ivf_build(const float* vecs, const int* rows, int n, int dim, int nlist) {
+    if (nlist > n / SV_IVF_MIN_LIST_SIZE) {
+        nlist = n / SV_IVF_MIN_LIST_SIZE;
+    }
+    if (nlist < 2) {
+        return NULL; // 선형 탐색이 더 빠름
+    }
+
+    sv_ivf_t* ivf = (sv_ivf_t*)calloc(1, sizeof(sv_ivf_t));
+    int* assign = (int*)malloc(sizeof(int) * n);
+    float* best = (float*)malloc(sizeof(float) * n);
+    float* work = (float*)sv_aligned_alloc(sizeof(float) * nlist);
+    if (ivf) {
+        ivf->nlist = nlist;
+        ivf->dim = dim;
+        ivf->num_rows = n;
+        ivf->centroids = (float*)sv_aligned_alloc(sizeof(float) * nlist * dim);
+        ivf->offsets = (int*)calloc(nlist + 1, sizeof(int));
+        ivf->rows = (int*)malloc(sizeof(int) * n);
+    }
+    if (!ivf || !assign || !best || !work || !ivf->centroids || !ivf->offsets || !ivf->rows) {
+        LOG_E(TAG, "Failed to allocate index (%d rows, %d lists)", n, nlist);
+        sv_ivf_destroy(ivf);
+        free(assign);
+        free(best);
+        sv_aligned_free(work);
+        return NULL;
+    }
+
+    // 초기 중심: 등록 순서(사이트별로 몰려 있음)에 치우치지 않도록 전체에서 일정 간격으로 선택
+    for (int l = 0; l < nlist; ++l) {
+        sv_l2_normalize(&vecs[(size_t)(l * (n / nlist)) * dim], &ivf->centroids[(size_t)l * dim], dim);
+    }
+    for (int it = 0; it < SV_IVF_ITERATIONS; ++it) {
+        _assign(ivf, vecs, n, work, assign, best);
+        _update_centroids(ivf, vecs, n, assign, best);
+    }
+    _assign(ivf, vecs, n, work, assign, NULL);
+
+    // 목록 순서로 연속 배치 (counting sort, 목록 안에서는 행 번호 순서 유지)
+    memset(ivf->offsets, 0, sizeof(int) * (nlist + 1));
+    for (int i = 0; i < n; ++i) {
+        ivf->offsets[assign[i] + 1]++;
+    }
+    for (int l = 0; l < nlist; ++l) {
+        ivf->offsets[l + 1] += ivf->offsets[l];
+    }
+    for (int i = 0; i < n; ++i) {
+        ivf->rows[ivf->offsets[assign[i]]++] = rows[i]; // offsets[l]이 목록 l의 끝으로 이동
+    }
+    for (int l = nlist; l > 0; --l) {
+        ivf->offsets[l] = ivf->offsets[l - 1];
+    }
+    ivf->offsets[0] = 0;
+
+    free(assign);
+    free(best);
+    sv_aligned_free(work);
+    LOG_I(TAG, "Index built: %d rows, %d lists", n, nlist);
+    return ivf;
+}
+
+void sv_ivf_destroy(void* ptr) {
+    sv_ivf_t* ivf = (sv_ivf_t*)ptr;
+    if (ivf) {
+        sv_aligned_free(ivf->centroids);
+        free(ivf->offsets);
+        free(ivf->rows);
+        free(ivf);
+    }
+}
+
+int sv_ivf_probe(const sv_ivf_t* ivf, const float* query, int nprobe, float* work, int* lists) {
+    sv_matvec_f32(ivf->centroids, ivf->dim, query, ivf->dim, ivf->nlist, work);
+
+    // 상위 nprobe개 삽입 선택 (nprobe는 작음)
+    int count = 0;
+    if (nprobe > ivf->nlist) {
+        nprobe = ivf->nlist;
+    }
+    for (int l = 0; l < ivf->nlist; ++l) {
+        float s = work[l];
+        if (count == nprobe && s <= work[lists[nprobe - 1]]) {
+            continue;
+        }
+        int pos = (count < nprobe) ? count++ : nprobe - 1;
+        while (pos > 0 && work[lists[pos - 1]] < s) {
+            lists[pos] = lists[pos - 1];
+            pos--;
+        }
+        lists[pos] = l;
+    }
+    return count;
+}
+
+
+//=========================== private ==============================
+static void _assign(const sv_ivf_t* ivf, const float* vecs, int n, float* work, int* assign, float* best) {
+    for (int i = 0; i < n; ++i) {
+        sv_matvec_f32(ivf->centroids, ivf->dim, &vecs[(size_t)i * ivf->dim], ivf->dim, ivf->nlist, work);
+        int arg = 0;
+        for (int l = 1; l < ivf->nlist; ++l) {
+            if (work[l] > work[arg]) arg = l;
+        }
+        assign[i] = arg;
+        if (best) {
+            best[i] = work[arg];
+        }
+    }
+}
+
+static void _update_centroids(sv_ivf_t* ivf, const float* vecs, int n, const int* assign, float* best) {
+    int dim = ivf->dim;
+    memset(ivf->centroids, 0, sizeof(float) * ivf->nlist * dim);
+    memset(ivf->offsets, 0, sizeof(int) * (ivf->nlist + 1)); // 목록별 개수 (임시)
+
+    for (int i = 0; i < n; ++i) {
+        float* c = &ivf->centroids[(size_t)assign[i] * dim];
+        const float* v = &vecs[(size_t)i * dim];
+        for (int d = 0; d < dim; ++d) {
+            c[d] += v[d];
+        }
+        ivf->offsets[assign[i]]++;
+    }
+
+    for (int l = 0; l < ivf->nlist; ++l) {
+        float* c = &ivf->centroids[(size_t)l * dim];
+        if (ivf->offsets[l] == 0) {
+            // 빈 목록: 배정된 중심과 가장 먼 벡터로 다시 시작 (한 번 사용한 벡터는 제외)
+            int far = 0;
+            for (int i = 1; i < n; ++i) {
+                if (best[i] < best[far]) far = i;
+            }
+            memcpy(c, &vecs[(size_t)far * dim], sizeof(float) * dim);
+            best[far] = 1e30f;
+        }
+        sv_l2_normalize(c, c, dim);
+    }
+}
@@ -0,0 +1,291 @@
+//=========================== header ==========================
+#include <stdlib.h> // aligned_alloc, free
+#include <string.h> // memset
+#include <math.h>   // sqrtf, fabsf, lrintf
+
+#include "sv_kernels.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#include "esp_dsp.h"       // dsps_dotprod_f32
+#endif
+
+
+//=========================== define ===========================
+#define SV_F16_BLOCK 64   // sv_matvec_f16의 float 변환 블록 크기
+#define SV_MATMAT_ROW_BLOCK 32  // 행렬-행렬 곱에서 캐시에 올려 둔 채 모든 쿼리에 재사용할 행 수 (DB chunk 하나, 192차원 f32 24KB)
+
+// 상수 길이로 특수화할 벡터 차원 (자주 쓰는 임베딩/projection 차원)
+// X(N)마다 아래 템플릿에서 길이 N 전용 행렬-벡터 곱이 생성되고 dispatch switch에 case가 추가됨
+// 목록에 없는 차원(early-abandon 블록 등)은 일반 커널 사용
+#define SV_KERNEL_DIMS(X) X(128) X(192) X(256) X(512)
+
+
+//=========================== prototypes ==========================
+#ifndef ESP_PLATFORM
+// host용 행렬-벡터 곱 (dim이 SV_KERNEL_DIMS 중 하나이면 특수화된 커널로 dispatch)
+static void _matvec_f32(const float* mat, int stride, const float* vec, int dim, int rows, float* out);
+#endif
+// int8 행렬-벡터 곱 (target/host 공용, dim 특수화 dispatch)
+static void _matvec_s8(const int8_t* mat, int stride, const int8_t* vec, int dim, int rows, int32_t* out);
+
+
+//=========================== public ==============================
+void* sv_aligned_alloc(size_t size) {
+    // aligned_alloc은 size가 정렬 단위의 배수여야 함
+    size = (size + SV_KERNEL_ALIGN - 1) & ~((size_t)SV_KERNEL_ALIGN - 1);
+    if (size == 0) {
+        size = SV_KERNEL_ALIGN;
+    }
+#ifdef ESP_PLATFORM
+    return heap_caps_aligned_alloc(SV_KERNEL_ALIGN, size, MALLOC_CAP_8BIT);
+#else
+    return aligned_alloc(SV_KERNEL_ALIGN, size);
+#endif
+}
+
+void sv_aligned_free(void* ptr) {
+#ifdef ESP_PLATFORM
+    heap_caps_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+float sv_l2_normalize(const float* in, float* out, int dim) {
+    float norm = 0.0f;
+    for (int i = 0; i < dim; ++i) {
+        norm += in[i] * in[i];
+    }
+    norm = sqrtf(norm);
+
+    // 0으로 나누기 방지 (기존 sv_cosine_similarity와 동일한 기준)
+    float inv = (norm < 1e-6f) ? 0.0f : 1.0f / norm;
+    for (int i = 0; i < dim; ++i) {
+        out[i] = in[i] * inv;
+    }
+    return norm;
+}
+
+void sv_matvec_f32(const float* mat, int stride, const float* vec, int dim, int rows, float* out) {
+#ifdef ESP_PLATFORM
+    // esp-dsp의 어셈블리 내적이 이미 길이별로 최적화되어 있으므로 특수화하지 않음
+    for (int r = 0; r < rows; ++r) {
+        dsps_dotprod_f32(mat + (size_t)r * stride, vec, &out[r], dim);
+    }
+#else
+    _matvec_f32(mat, stride, vec, dim, rows, out);
+#endif
+}
+
+void sv_quantize_s8(const float* in, int8_t* out, int dim, float* scale) {
+    float max_abs = 0.0f;
+    for (int i = 0; i < dim; ++i) {
+        float a = fabsf(in[i]);
+        if (a > max_abs) {
+            max_abs = a;
+        }
+    }
+
+    if (max_abs < 1e-12f) {
+        memset(out, 0, dim);
+        *scale = 0.0f;
+        return;
+    }
+
+    float inv = 127.0f / max_abs;
+    for (int i = 0; i < dim; ++i) {
+        int32_t q = (int32_t)lrintf(in[i] * inv);
+        out[i] = (int8_t)(q > 127 ? 127 : (q < -127 ? -127 : q));
+    }
+    *scale = max_abs / 127.0f;
+}
+
+void sv_matvec_s8(const int8_t* mat, int stride, const int8_t* vec, int dim, int rows, int32_t* out) {
+    _matvec_s8(mat, stride, vec, dim, rows, out);
+}
+
+float sv_dot_f32_s8(const float* a, const int8_t* b, int dim) {
+    float sum = 0.0f;
+    for (int i = 0; i < dim; ++i) {
+        sum += a[i] * (float)b[i];
+    }
+    return sum;
+}
+
+float sv_f16_to_f32(uint16_t h) {
+    uint32_t sign = (uint32_t)(h & 0x8000u) << 16;
+    uint32_t exp = (h >> 10) & 0x1Fu;
+    uint32_t mant = h & 0x3FFu;
+    uint32_t bits;
+
+    if (exp == 0x1Fu) {
+        bits = sign | 0x7F800000u | (mant << 13);          // inf / NaN
+    } else if (exp != 0) {
+        bits = sign | ((exp + 112u) << 23) | (mant << 13); // 정규수 (bias 15 -> 127)
+    } else if (mant != 0) {
+        // subnormal: 최상위 1이 나올 때까지 정규화
+        exp = 113u;
+        while (!(mant & 0x400u)) {
+            mant <<= 1;
+            exp--;
+        }
+        bits = sign | (exp << 23) | ((mant & 0x3FFu) << 13);
+    } else {
+        bits = sign;                                        // +-0
+    }
+
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+void sv_matvec_f16(const uint16_t* mat, int stride, const float* vec, int dim, int rows, float* out) {
+    // 행을 작은 블록씩 float로 풀어 float 커널에 넘김 (스택 사용량 고정)
+    float block[SV_F16_BLOCK] __attribute__((aligned(SV_KERNEL_ALIGN)));
+
+    for (int r = 0; r < rows; ++r) {
+        const uint16_t* row = mat + (size_t)r * stride;
+        float sum = 0.0f;
+        for (int base = 0; base < dim; base += SV_F16_BLOCK) {
+            int n = (dim - base < SV_F16_BLOCK) ? dim - base : SV_F16_BLOCK;
+            for (int i = 0; i < n; ++i) {
+                block[i] = sv_f16_to_f32(row[base + i]);
+            }
+            float partial;
+            sv_matvec_f32(block, n, vec + base, n, 1, &partial);
+            sum += partial;
+        }
+        out[r] = sum;
+    }
+}
+
+
+void sv_matmat_f32(const float* mat, int stride, const float* const* vecs, int num_vecs,
+                   int dim, int rows, float* const* outs) {
+    // 행 블록 하나를 모든 쿼리에 대해 계산한 뒤 다음 블록으로 이동 (행렬은 한 번만 읽음)
+    for (int r0 = 0; r0 < rows; r0 += SV_MATMAT_ROW_BLOCK) {
+        int n = (rows - r0 < SV_MATMAT_ROW_BLOCK) ? rows - r0 : SV_MATMAT_ROW_BLOCK;
+        const float* block = mat + (size_t)r0 * stride;
+        for (int q = 0; q < num_vecs; ++q) {
+            sv_matvec_f32(block, stride, vecs[q], dim, n, outs[q] + r0);
+        }
+    }
+}
+
+void sv_matmat_s8(const int8_t* mat, int stride, const int8_t* const* vecs, int num_vecs,
+                  int dim, int rows, int32_t* const* outs) {
+    for (int r0 = 0; r0 < rows; r0 += SV_MATMAT_ROW_BLOCK) {
+        int n = (rows - r0 < SV_MATMAT_ROW_BLOCK) ? rows - r0 : SV_MATMAT_ROW_BLOCK;
+        const int8_t* block = mat + (size_t)r0 * stride;
+        for (int q = 0; q < num_vecs; ++q) {
+            sv_matvec_s8(block, stride, vecs[q], dim, n, outs[q] + r0);
+        }
+    }
+}
+
+void sv_matmat_f16(const uint16_t* mat, int stride, const float* const* vecs, int num_vecs,
+                   int dim, int rows, float* const* outs) {
+    float block[SV_F16_BLOCK] __attribute__((aligned(SV_KERNEL_ALIGN)));
+
+    // 행 조각을 한 번 float로 변환한 뒤 모든 쿼리의 부분 내적에 재사용
+    for (int r = 0; r < rows; ++r) {
+        const uint16_t* row = mat + (size_t)r * stride;
+        for (int q = 0; q < num_vecs; ++q) {
+            outs[q][r] = 0.0f;
+        }
+        for (int base = 0; base < dim; base += SV_F16_BLOCK) {
+            int n = (dim - base < SV_F16_BLOCK) ? dim - base : SV_F16_BLOCK;
+            for (int i = 0; i < n; ++i) {
+                block[i] = sv_f16_to_f32(row[base + i]);
+            }
+            for (int q = 0; q < num_vecs; ++q) {
+                float partial;
+                sv_matvec_f32(block, n, vecs[q] + base, n, 1, &partial);
+                outs[q][r] += partial;
+            }
+        }
+    }
+}
+
+//=========================== private ==============================
+/*
+ * 커널 템플릿: 행 루프와 내적을 always_inline 함수 하나로 작성하고,
+ * SV_KERNEL_DIMS의 각 N에 대해 dim 자리에 상수 N을 넘긴 wrapper를 생성합니다.
+ * 상수 길이에서는 컴파일러가 나머지 루프를 없애고 완전히 unroll/벡터화하며,
+ * 일반 커널도 같은 템플릿에서 생성되므로 모든 경로의 결과가 bit 단위로 같습니다.
+ */
+#define SV_KERNEL_INLINE static inline __attribute__((always_inline))
+
+#ifndef ESP_PLATFORM
+// host용 내적 템플릿 (8개 누산기로 분리하여 컴파일러 자동 벡터화 유도)
+SV_KERNEL_INLINE void _matvec_f32_tmpl(const float* restrict mat, int stride, const float* restrict vec,
+                                       int dim, int rows, float* restrict out) {
+    for (int r = 0; r < rows; ++r) {
+        const float* restrict a = mat + (size_t)r * stride;
+        float acc[8] = {0};
+        int i = 0;
+
+        for (; i + 8 <= dim; i += 8) {
+            for (int j = 0; j < 8; ++j) {
+                acc[j] += a[i + j] * vec[i + j];
+            }
+        }
+
+        float sum = ((acc[0] + acc[1]) + (acc[2] + acc[3])) + ((acc[4] + acc[5]) + (acc[6] + acc[7]));
+        for (; i < dim; ++i) {
+            sum += a[i] * vec[i];
+        }
+        out[r] = sum;
+    }
+}
+
+#define SV_DEFINE_MATVEC_F32(N) \
+    static void _matvec_f32_##N(const float* mat, int stride, const float* vec, int rows, float* out) { \
+        _matvec_f32_tmpl(mat, stride, vec, N, rows, out); \
+    }
+SV_KERNEL_DIMS(SV_DEFINE_MATVEC_F32)
+
+static void _matvec_f32(const float* mat, int stride, const float* vec, int dim, int rows, float* out) {
+    switch (dim) {
+#define SV_CASE_MATVEC_F32(N) case N: _matvec_f32_##N(mat, stride, vec, rows, out); return;
+        SV_KERNEL_DIMS(SV_CASE_MATVEC_F32)
+        default: _matvec_f32_tmpl(mat, stride, vec, dim, rows, out); return;
+    }
+}
+#endif
+
+// int8 내적 템플릿 (4개씩 unroll, int16 곱 -> int32 누산)
+SV_KERNEL_INLINE void _matvec_s8_tmpl(const int8_t* restrict mat, int stride, const int8_t* restrict vec,
+                                      int dim, int rows, int32_t* restrict out) {
+    for (int r = 0; r < rows; ++r) {
+        const int8_t* restrict row = mat + (size_t)r * stride;
+        int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        int i = 0;
+
+        for (; i + 4 <= dim; i += 4) {
+            acc0 += (int16_t)row[i]     * (int16_t)vec[i];
+            acc1 += (int16_t)row[i + 1] * (int16_t)vec[i + 1];
+            acc2 += (int16_t)row[i + 2] * (int16_t)vec[i + 2];
+            acc3 += (int16_t)row[i + 3] * (int16_t)vec[i + 3];
+        }
+        for (; i < dim; ++i) {
+            acc0 += (int16_t)row[i] * (int16_t)vec[i];
+        }
+        out[r] = acc0 + acc1 + acc2 + acc3;
+    }
+}
+
+#define SV_DEFINE_MATVEC_S8(N) \
+    static void _matvec_s8_##N(const int8_t* mat, int stride, const int8_t* vec, int rows, int32_t* out) { \
+        _matvec_s8_tmpl(mat, stride, vec, N, rows, out); \
+    }
+SV_KERNEL_DIMS(SV_DEFINE_MATVEC_S8)
+
+static void _matvec_s8(const int8_t* mat, int stride, const int8_t* vec, int dim, int rows, int32_t* out) {
+    switch (dim) {
+#define SV_CASE_MATVEC_S8(N) case N: _matvec_s8_##N(mat, stride, vec, rows, out); return;
+        SV_KERNEL_DIMS(SV_CASE_MATVEC_S8)
+        default: _matvec_s8_tmpl(mat, stride, vec, dim, rows, out); return;
+    }
+}
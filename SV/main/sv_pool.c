@@ -0,0 +1,139 @@
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h> // malloc, realloc, free
+#include <string.h> // memset, memcpy
+
+#include "sv_pool.h"
+#include "sv_kernels.h"        // sv_aligned_alloc, SV_KERNEL_ALIGN
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#endif
+
+#define LOG_I(tag, format, ...) printf("[%s] " format "\n", tag, ##__VA_ARGS__)
+#define LOG_E(tag, format, ...) printf("[ERROR %s] " format "\n", tag, ##__VA_ARGS__)
+
+
+//=========================== define ===========================
+#define SV_POOL_INITIAL_TABLE 4   // chunk 테이블 초기 크기 (가득 차면 2배)
+
+
+//=========================== variables ===========================
+static const char* TAG = SV_POOL_TAG;
+
+
+//=========================== prototypes ==========================
+// chunk 메모리 할당 (target: PSRAM 우선)
+static uint8_t* _chunk_alloc(size_t size);
+
+// 새 chunk를 추가하고 테이블/free-list 용량을 늘림
+static bool _pool_grow(sv_pool_t* pool);
+
+
+//=========================== public ==============================
+sv_pool_t* sv_pool_create(size_t row_bytes) {
+    sv_pool_t* pool = (sv_pool_t*)calloc(1, sizeof(sv_pool_t));
+    if (!pool) {
+        LOG_E(TAG, "Failed to allocate memory for pool");
+        return NULL;
+    }
+    pool->row_bytes = (row_bytes + SV_KERNEL_ALIGN - 1) & ~((size_t)SV_KERNEL_ALIGN - 1);
+    return pool;
+}
+
+void sv_pool_destroy(sv_pool_t* pool) {
+    if (pool) {
+        for (int c = 0; c < pool->num_chunks; ++c) {
+            sv_aligned_free(pool->chunks[c]);
+        }
+        free(pool->chunks);
+        free(pool->free_rows);
+        free(pool);
+    }
+}
+
+int sv_pool_alloc(sv_pool_t* pool) {
+    if (pool->num_free > 0) {
+        return pool->free_rows[--pool->num_free];
+    }
+    if (pool->num_rows == sv_pool_capacity(pool) && !_pool_grow(pool)) {
+        return -1;
+    }
+    return pool->num_rows++;
+}
+
+void sv_pool_free(sv_pool_t* pool, int row) {
+    // trim으로 잘린 행은 무시 (compaction 전에 삭제되어 유예 중이던 행)
+    if (row < 0 || row >= pool->num_rows) {
+        return;
+    }
+    pool->free_rows[pool->num_free++] = row;
+}
+
+uint8_t* sv_pool_clone_chunk(sv_pool_t* pool, int chunk) {
+    size_t size = pool->row_bytes * SV_DB_CHUNK_ROWS;
+    uint8_t* copy = _chunk_alloc(size);
+    if (!copy) {
+        LOG_E(TAG, "Failed to allocate chunk copy (%u bytes)", (unsigned)size);
+        return NULL;
+    }
+    uint8_t* old = pool->chunks[chunk];
+    memcpy(copy, old, size);
+    pool->chunks[chunk] = copy;
+    return old;
+}
+
+void sv_pool_trim(sv_pool_t* pool, int num_rows) {
+    int keep = (num_rows + SV_DB_CHUNK_ROWS - 1) >> SV_DB_CHUNK_SHIFT;
+    for (int c = keep; c < pool->num_chunks; ++c) {
+        sv_aligned_free(pool->chunks[c]);
+        pool->chunks[c] = NULL;
+    }
+    if (keep < pool->num_chunks) {
+        LOG_I(TAG, "Trimmed %d chunk(s), %d rows in use", pool->num_chunks - keep, num_rows);
+        pool->num_chunks = keep;
+    }
+    pool->num_rows = num_rows;
+    pool->num_free = 0;
+}
+
+
+//=========================== private ==============================
+static uint8_t* _chunk_alloc(size_t size) {
+#ifdef ESP_PLATFORM
+    // 화자 DB는 판정마다 순차로 한 번 읽히므로 PSRAM에 두고 내부 RAM은 남겨 둠
+    uint8_t* chunk = (uint8_t*)heap_caps_aligned_alloc(SV_KERNEL_ALIGN, size,
+                                                       MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (chunk) {
+        return chunk;
+    }
+#endif
+    return (uint8_t*)sv_aligned_alloc(size);
+}
+
+static bool _pool_grow(sv_pool_t* pool) {
+    if (pool->num_chunks == pool->table_size) {
+        int table_size = pool->table_size ? pool->table_size * 2 : SV_POOL_INITIAL_TABLE;
+        uint8_t** chunks = (uint8_t**)realloc(pool->chunks, sizeof(uint8_t*) * table_size);
+        if (!chunks) {
+            return false;
+        }
+        pool->chunks = chunks;
+        pool->table_size = table_size;
+    }
+
+    // free-list는 모든 행을 담을 수 있도록 chunk 추가 시에만 늘림 (행 반환 시 할당 없음)
+    int* free_rows = (int*)realloc(pool->free_rows, sizeof(int) * (pool->num_chunks + 1) * SV_DB_CHUNK_ROWS);
+    if (!free_rows) {
+        return false;
+    }
+    pool->free_rows = free_rows;
+
+    uint8_t* chunk = _chunk_alloc(pool->row_bytes * SV_DB_CHUNK_ROWS);
+    if (!chunk) {
+        LOG_E(TAG, "Failed to allocate chunk (%u bytes)", (unsigned)(pool->row_bytes * SV_DB_CHUNK_ROWS));
+        return false;
+    }
+    pool->chunks[pool->num_chunks++] = chunk;
+    return true;
+}
@@ -0,0 +1,377 @@
+//=========================== header ==========================
+#include <stdio.h>
+#include <stdlib.h> // malloc, free
+#include <string.h> // memcpy, memset, strncpy
+
+#include "sv_store.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_err.h"
+#else
+#include <fcntl.h>    // open
+#include <unistd.h>   // pwrite, close, ftruncate
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+#endif
+
+#define LOG_I(tag, format, ...) printf("[%s] " format "\n", tag, ##__VA_ARGS__)
+#define LOG_E(tag, format, ...) printf("[ERROR %s] " format "\n", tag, ##__VA_ARGS__)
+
+
+//=========================== variables ===========================
+static const char* TAG = SV_STORE_TAG;
+
+
+//=========================== prototypes ==========================
+// 플랫폼 계층 (target: esp_partition, host: 파일)
+static bool _platform_open(sv_store_t* store, const char* name);
+static void _platform_close(sv_store_t* store);
+static bool _flash_write(sv_store_t* store, size_t offset, const void* data, size_t len);
+static bool _flash_erase(sv_store_t* store, size_t offset, size_t len);
+
+// bank 관련
+static const sv_store_header_t* _bank_header(const sv_store_t* store, int bank);
+static bool _bank_header_valid(const sv_store_t* store, int bank);
+static bool _bank_format(sv_store_t* store, int bank, uint32_t generation);
+static int _bank_scan_used(const sv_store_t* store, int bank);
+static bool _slot_is_live(const sv_store_t* store, int slot);
+static size_t _slot_offset(const sv_store_t* store, int bank, int slot);
+static uint32_t _crc32(const void* data, size_t len);
+
+
+//=========================== public ==============================
+sv_store_t* sv_store_open(const char* name, int dim) {
+    sv_store_t* store = (sv_store_t*)malloc(sizeof(sv_store_t));
+    if (!store) {
+        LOG_E(TAG, "Failed to allocate memory for store");
+        return NULL;
+    }
+    memset(store, 0, sizeof(sv_store_t));
+
+    if (!_platform_open(store, name)) {
+        free(store);
+        return NULL;
+    }
+
+    // bank 크기와 record 배치 (임베딩이 16바이트 정렬되도록 stride를 16의 배수로)
+    store->dim = dim;
+    store->stride = (sizeof(sv_store_record_t) + sizeof(float) * dim + 15) & ~(size_t)15;
+    store->bank_size = (store->size / 2) & ~(size_t)(SV_STORE_SECTOR_SIZE - 1);
+    store->capacity = (int)((store->bank_size - SV_STORE_HEADER_SIZE) / store->stride);
+    if (store->bank_size == 0 || store->capacity <= 0) {
+        LOG_E(TAG, "Partition too small (%u bytes)", (unsigned)store->size);
+        sv_store_close(store);
+        return NULL;
+    }
+
+    // 유효한 header 중 generation이 큰 bank를 활성 bank로 선택
+    bool valid0 = _bank_header_valid(store, 0);
+    bool valid1 = _bank_header_valid(store, 1);
+    if (valid0 && valid1) {
+        store->active_bank = (_bank_header(store, 1)->generation > _bank_header(store, 0)->generation) ? 1 : 0;
+    } else if (valid0 || valid1) {
+        store->active_bank = valid1 ? 1 : 0;
+    } else {
+        LOG_I(TAG, "No valid bank found, formatting");
+        if (!_bank_format(store, 0, 1)) {
+            sv_store_close(store);
+            return NULL;
+        }
+        store->active_bank = 0;
+    }
+
+    const sv_store_header_t* header = _bank_header(store, store->active_bank);
+    if (header->dim != dim || header->record_stride != store->stride) {
+        LOG_E(TAG, "Stored DB layout mismatch (dim %d, expected %d)", header->dim, dim);
+        sv_store_close(store);
+        return NULL;
+    }
+
+    store->generation = header->generation;
+    store->used = _bank_scan_used(store, store->active_bank);
+
+    LOG_I(TAG, "Store opened: bank %d, gen %u, %d/%d records",
+          store->active_bank, (unsigned)store->generation, store->used, store->capacity);
+    return store;
+}
+
+void sv_store_close(sv_store_t* store) {
+    if (store) {
+        _platform_close(store);
+        free(store);
+    }
+}
+
+const sv_store_record_t* sv_store_record(const sv_store_t* store, int slot) {
+    return (const sv_store_record_t*)(store->base + _slot_offset(store, store->active_bank, slot));
+}
+
+const float* sv_store_embedding(const sv_store_t* store, int slot) {
+    return (const float*)((const uint8_t*)sv_store_record(store, slot) + sizeof(sv_store_record_t));
+}
+
+sv_status_t sv_store_append_add(sv_store_t* store, int speaker_id, const char* name, const float* embedding,
+                                uint32_t model_hash) {
+    if (store->used >= store->capacity) {
+        return SV_ERROR;
+    }
+
+    // op를 제외한 record 전체를 먼저 쓰고, 마지막에 op를 기록 (커밋)
+    uint8_t* buf = (uint8_t*)malloc(store->stride);
+    if (!buf) {
+        return SV_ERROR;
+    }
+    memset(buf, 0xFF, store->stride);
+
+    sv_store_record_t* rec = (sv_store_record_t*)buf;
+    rec->speaker_id = speaker_id;
+    memset(rec->name, 0, SV_MAX_NAME_LEN);
+    strncpy(rec->name, name, SV_MAX_NAME_LEN - 1);
+    rec->model_hash = model_hash;
+    memcpy(buf + sizeof(sv_store_record_t), embedding, sizeof(float) * store->dim);
+
+    size_t offset = _slot_offset(store, store->active_bank, store->used);
+    uint32_t op = SV_STORE_OP_ADD;
+    bool ok = _flash_write(store, offset + sizeof(uint32_t), buf + sizeof(uint32_t), store->stride - sizeof(uint32_t)) &&
+              _flash_write(store, offset, &op, sizeof(op));
+    free(buf);
+
+    // 실패한 slot은 끊긴 record로 남으므로 건너뜀
+    store->used++;
+    return ok ? SV_SUCCESS : SV_ERROR;
+}
+
+sv_status_t sv_store_append_del(sv_store_t* store, int speaker_id) {
+    if (store->used >= store->capacity) {
+        return SV_ERROR;
+    }
+
+    size_t offset = _slot_offset(store, store->active_bank, store->used);
+    int32_t id = speaker_id;
+    uint32_t op = SV_STORE_OP_DEL;
+    bool ok = _flash_write(store, offset + sizeof(uint32_t), &id, sizeof(id)) &&
+              _flash_write(store, offset, &op, sizeof(op));
+
+    store->used++;
+    return ok ? SV_SUCCESS : SV_ERROR;
+}
+
+sv_status_t sv_store_compact(sv_store_t* store) {
+    int src_bank = store->active_bank;
+    int dst_bank = 1 - src_bank;
+
+    // 대상 bank를 지우고 살아 있는 ADD record를 앞에서부터 옮겨 씀
+    // (flash 쓰기 중에는 매핑된 flash를 읽을 수 없으므로 RAM 버퍼를 거침)
+    if (!_flash_erase(store, dst_bank * store->bank_size, store->bank_size)) {
+        return SV_ERROR;
+    }
+
+    uint8_t* buf = (uint8_t*)malloc(store->stride);
+    if (!buf) {
+        return SV_ERROR;
+    }
+
+    int written = 0;
+    bool ok = true;
+    for (int slot = 0; slot < store->used && ok; ++slot) {
+        if (!_slot_is_live(store, slot)) {
+            continue;
+        }
+        memcpy(buf, sv_store_record(store, slot), store->stride);
+        ok = _flash_write(store, _slot_offset(store, dst_bank, written), buf, store->stride);
+        written++;
+    }
+    free(buf);
+
+    // header를 마지막에 써서 compaction을 커밋 (중간에 끊기면 이전 bank가 그대로 유효)
+    if (!ok || !_bank_format(store, dst_bank, store->generation + 1)) {
+        LOG_E(TAG, "Compaction failed");
+        return SV_ERROR;
+    }
+
+    store->active_bank = dst_bank;
+    store->generation++;
+    store->used = written;
+
+    LOG_I(TAG, "Compacted: bank %d, gen %u, %d/%d records",
+          dst_bank, (unsigned)store->generation, written, store->capacity);
+    return SV_SUCCESS;
+}
+
+
+//=========================== private ==============================
+static size_t _slot_offset(const sv_store_t* store, int bank, int slot) {
+    return bank * store->bank_size + SV_STORE_HEADER_SIZE + (size_t)slot * store->stride;
+}
+
+static const sv_store_header_t* _bank_header(const sv_store_t* store, int bank) {
+    return (const sv_store_header_t*)(store->base + bank * store->bank_size);
+}
+
+static bool _bank_header_valid(const sv_store_t* store, int bank) {
+    const sv_store_header_t* header = _bank_header(store, bank);
+    return header->magic == SV_STORE_MAGIC &&
+           header->version == SV_STORE_VERSION &&
+           header->crc == _crc32(header, offsetof(sv_store_header_t, crc));
+}
+
+/**
+ * @brief [Private] bank header를 기록합니다. (record 영역은 이미 지워져 있어야 함)
+ * 새 포맷일 때는 bank 전체를 먼저 지웁니다.
+ */
+static bool _bank_format(sv_store_t* store, int bank, uint32_t generation) {
+    if (generation == 1 && !_flash_erase(store, bank * store->bank_size, store->bank_size)) {
+        return false;
+    }
+
+    sv_store_header_t header;
+    memset(&header, 0xFF, sizeof(header));
+    header.magic = SV_STORE_MAGIC;
+    header.version = SV_STORE_VERSION;
+    header.dim = (uint16_t)store->dim;
+    header.record_stride = (uint32_t)store->stride;
+    header.capacity = (uint32_t)store->capacity;
+    header.generation = generation;
+    header.crc = _crc32(&header, offsetof(sv_store_header_t, crc));
+
+    return _flash_write(store, bank * store->bank_size, &header, sizeof(header));
+}
+
+/**
+ * @brief [Private] journal 끝(처음으로 완전히 비어 있는 slot)을 찾습니다.
+ * op와 speaker_id가 모두 지워진 상태여야 빈 slot이며, op만 지워진 slot은 끊긴 쓰기로 보고 건너뜁니다.
+ */
+static int _bank_scan_used(const sv_store_t* store, int bank) {
+    int used = 0;
+    while (used < store->capacity) {
+        const sv_store_record_t* rec = (const sv_store_record_t*)(store->base + _slot_offset(store, bank, used));
+        if (rec->op == SV_STORE_OP_ERASED && (uint32_t)rec->speaker_id == SV_STORE_OP_ERASED) {
+            break;
+        }
+        used++;
+    }
+    return used;
+}
+
+/**
+ * @brief [Private] slot이 살아 있는 ADD record인지 확인합니다. (이후에 같은 ID의 DEL이 없어야 함)
+ */
+static bool _slot_is_live(const sv_store_t* store, int slot) {
+    const sv_store_record_t* rec = sv_store_record(store, slot);
+    if (rec->op != SV_STORE_OP_ADD) {
+        return false;
+    }
+    for (int i = slot + 1; i < store->used; ++i) {
+        const sv_store_record_t* later = sv_store_record(store, i);
+        if ((later->op == SV_STORE_OP_DEL || later->op == SV_STORE_OP_ADD) &&
+            later->speaker_id == rec->speaker_id) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t _crc32(const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= p[i];
+        for (int b = 0; b < 8; ++b) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+#ifdef ESP_PLATFORM
+static bool _platform_open(sv_store_t* store, const char* name) {
+    store->part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name);
+    if (!store->part) {
+        LOG_E(TAG, "Partition '%s' not found", name);
+        return false;
+    }
+    store->size = store->part->size;
+
+    const void* ptr;
+    esp_err_t err = esp_partition_mmap(store->part, 0, store->size, ESP_PARTITION_MMAP_DATA,
+                                       &ptr, &store->mmap_handle);
+    if (err != ESP_OK) {
+        LOG_E(TAG, "Failed to mmap partition [%s]", esp_err_to_name(err));
+        return false;
+    }
+    store->base = (const uint8_t*)ptr;
+    return true;
+}
+
+static void _platform_close(sv_store_t* store) {
+    if (store->base) {
+        esp_partition_munmap(store->mmap_handle);
+    }
+}
+
+static bool _flash_write(sv_store_t* store, size_t offset, const void* data, size_t len) {
+    // 매핑된 영역의 cache는 esp_partition_write가 갱신함
+    return esp_partition_write(store->part, offset, data, len) == ESP_OK;
+}
+
+static bool _flash_erase(sv_store_t* store, size_t offset, size_t len) {
+    return esp_partition_erase_range(store->part, offset, len) == ESP_OK;
+}
+#else
+static bool _platform_open(sv_store_t* store, const char* name) {
+    store->fd = open(name, O_RDWR | O_CREAT, 0644);
+    if (store->fd < 0) {
+        LOG_E(TAG, "Failed to open '%s'", name);
+        return false;
+    }
+
+    // 새 파일은 지워진 flash(0xFF)처럼 채움
+    struct stat st;
+    if (fstat(store->fd, &st) != 0 || st.st_size == 0) {
+        store->size = SV_STORE_HOST_SIZE;
+        if (ftruncate(store->fd, store->size) != 0) {
+            close(store->fd);
+            return false;
+        }
+        store->base = NULL;
+        if (!_flash_erase(store, 0, store->size)) {
+            close(store->fd);
+            return false;
+        }
+    } else {
+        store->size = (size_t)st.st_size;
+    }
+
+    void* ptr = mmap(NULL, store->size, PROT_READ, MAP_SHARED, store->fd, 0);
+    if (ptr == MAP_FAILED) {
+        LOG_E(TAG, "Failed to mmap '%s'", name);
+        close(store->fd);
+        return false;
+    }
+    store->base = (const uint8_t*)ptr;
+    return true;
+}
+
+static void _platform_close(sv_store_t* store) {
+    if (store->base) {
+        munmap((void*)store->base, store->size);
+    }
+    close(store->fd);
+}
+
+static bool _flash_write(sv_store_t* store, size_t offset, const void* data, size_t len) {
+    return pwrite(store->fd, data, len, (off_t)offset) == (ssize_t)len;
+}
+
+static bool _flash_erase(sv_store_t* store, size_t offset, size_t len) {
+    uint8_t erased[SV_STORE_SECTOR_SIZE];
+    memset(erased, 0xFF, sizeof(erased));
+    for (size_t done = 0; done < len; done += sizeof(erased)) {
+        size_t n = (len - done < sizeof(erased)) ? len - done : sizeof(erased);
+        if (pwrite(store->fd, erased, n, (off_t)(offset + done)) != (ssize_t)n) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
@@ -1,10 +1,32 @@
 import csv
 import re
 import os
+import math
+import struct
 
 # --- 설정 ---
 CSV_FILE_PATH = "csv_file/ALL.csv"  # 변환할 CSV 파일 경로
 OUTPUT_H_FILE = 'sv_database.h'   # 생성할 C 헤더 파일 이름
+OUTPUT_BIN_FILE = 'sv_database.bin'  # 생성할 바이너리 DB 이미지 (None이면 생성 안 함, 형식: SV/main/include/sv_image.h)
+BIN_ENCODING = 'f32'              # 이미지 임베딩 인코딩: 'f32' | 'fp16' | 'int8'
+BIN_NORMALIZE = True              # 이미지에 L2 정규화된 임베딩 저장 (검증기의 행별 norm 계산 생략)
+PROJECTION_BIN_FILE = None        # 이미지 행을 투영할 projection (SV/host/sv_fit_projection 출력, config.projection과 같은 파일)
+# ---
+
+# --- sv_image.h 와 동일하게 유지 ---
+SV_IMAGE_MAGIC = 0x4D495653       # "SVIM"
+SV_IMAGE_VERSION = 1
+SV_IMAGE_HEADER_SIZE = 64
+SV_IMAGE_ALIGN = 16
+SV_IMAGE_FLAG_NORMALIZED = 0x01
+SV_IMAGE_ENCODINGS = {'f32': (0, 4), 'int8': (1, 1), 'fp16': (2, 2)}  # 이름: (코드, 원소 크기)
+SV_MAX_NAME_LEN = 20              # speaker_verifier.h 의 SV_MAX_NAME_LEN
+# ---
+
+# --- sv_projection.h 와 동일하게 유지 ---
+SV_PROJ_MAGIC = 0x4A505653        # "SVPJ"
+SV_PROJ_VERSION = 1
+SV_PROJ_FLAG_PLDA = 0x02
 # ---
 
 def create_c_variable_name(name):
@@ -30,6 +52,98 @@ def parse_embedding_string(emb_str):
     # float 리스트로 변환
     return [float(s) for s in float_strings]
 
+def align_up(n, a=SV_IMAGE_ALIGN):
+    return (n + a - 1) // a * a
+
+def quantize_s8(vec):
+    """
+    sv_kernels.c 의 sv_quantize_s8 과 같은 대칭 int8 양자화 (scale = max|x| / 127)
+    """
+    max_abs = max(abs(v) for v in vec)
+    if max_abs < 1e-12:
+        return [0] * len(vec), 0.0
+    inv = 127.0 / max_abs
+    return [max(-127, min(127, int(round(v * inv)))) for v in vec], max_abs / 127.0
+
+def load_projection(path):
+    """
+    sv_projection.h 형식의 projection을 읽어 (in_dim, out_dim, mean, matrix 행 목록, psi) 반환
+    psi는 PLDA 모델의 화자 간 분산 (PLDA가 아니면 None)
+    """
+    with open(path, mode='rb') as f:
+        data = f.read()
+    magic, version, flags, in_dim, out_dim, mean_offset, matrix_offset, total_size, psi_offset = \
+        struct.unpack_from('<IHHHHIIII', data, 0)
+    if magic != SV_PROJ_MAGIC or version != SV_PROJ_VERSION:
+        raise ValueError("projection: bad magic/version")
+    mean = list(struct.unpack_from(f'<{in_dim}f', data, mean_offset))
+    matrix = [list(struct.unpack_from(f'<{in_dim}f', data, matrix_offset + 4 * in_dim * r))
+              for r in range(out_dim)]
+    psi = None
+    if (flags & SV_PROJ_FLAG_PLDA) and psi_offset:
+        psi = list(struct.unpack_from(f'<{out_dim}f', data, psi_offset))
+    return in_dim, out_dim, mean, matrix, psi
+
+def project(vec, mean, matrix, psi=None):
+    """
+    y = matrix * (x - mean) (검증기 backend와 같은 투영, 정규화는 build_db_image에서)
+    PLDA 모델(psi 지정)은 입력을 L2 정규화한 뒤 투영하고 길이를 sqrt(sum(psi + 1))로 맞춤
+    (sv_backend.c의 PLDA enroll과 같음)
+    """
+    if psi:
+        norm = math.sqrt(sum(v * v for v in vec))
+        vec = [v / norm for v in vec] if norm > 1e-12 else vec
+    centered = [v - m for v, m in zip(vec, mean)]
+    out = [sum(w * c for w, c in zip(row, centered)) for row in matrix]
+    if psi:
+        norm = math.sqrt(sum(v * v for v in out))
+        scale = math.sqrt(sum(max(p, 0.0) + 1.0 for p in psi)) / norm if norm > 1e-12 else 0.0
+        out = [v * scale for v in out]
+    return out
+
+def build_db_image(speakers, dim, encoding, normalize):
+    """
+    화자 목록을 sv_image.h 형식의 바이너리 이미지로 변환
+    [header][speaker_id int32[N]][scale float[N] (int8)][name char[N][20]][pad][16바이트 정렬된 임베딩 행]
+    """
+    enc_code, elem_size = SV_IMAGE_ENCODINGS[encoding]
+    n = len(speakers)
+    row_stride = align_up(dim * elem_size)
+
+    ids_offset = SV_IMAGE_HEADER_SIZE
+    scales_offset = ids_offset + 4 * n if encoding == 'int8' else 0
+    names_offset = (scales_offset or ids_offset) + 4 * n
+    rows_offset = align_up(names_offset + SV_MAX_NAME_LEN * n)
+    total_size = rows_offset + row_stride * n
+
+    image = bytearray(total_size)
+    struct.pack_into('<IHHIBBHIIIIII', image, 0,
+                     SV_IMAGE_MAGIC, SV_IMAGE_VERSION, dim, n,
+                     enc_code, SV_IMAGE_FLAG_NORMALIZED if normalize else 0, SV_MAX_NAME_LEN,
+                     row_stride, ids_offset, scales_offset, names_offset, rows_offset, total_size)
+
+    for i, speaker in enumerate(speakers):
+        vec = speaker['embeddings']
+        if normalize:
+            norm = math.sqrt(sum(v * v for v in vec))
+            vec = [v / norm for v in vec] if norm >= 1e-6 else [0.0] * dim
+
+        struct.pack_into('<i', image, ids_offset + 4 * i, speaker['id'])
+        name = speaker['name'].encode('utf-8')[:SV_MAX_NAME_LEN - 1]
+        image[names_offset + SV_MAX_NAME_LEN * i:names_offset + SV_MAX_NAME_LEN * i + len(name)] = name
+
+        row = rows_offset + row_stride * i
+        if encoding == 'int8':
+            q, scale = quantize_s8(vec)
+            struct.pack_into('<f', image, scales_offset + 4 * i, scale)
+            struct.pack_into(f'<{dim}b', image, row, *q)
+        elif encoding == 'fp16':
+            struct.pack_into(f'<{dim}e', image, row, *vec)
+        else:
+            struct.pack_into(f'<{dim}f', image, row, *vec)
+
+    return bytes(image)
+
 # --- 메인 로직 ---
 speakers_data = []
 embedding_dim = 0
@@ -41,6 +155,10 @@ if not os.path.exists(CSV_FILE_PATH):
     print("스크립트를 speaker_db.csv 파일과 같은 폴더에 위치시키거나 CSV_FILE_PATH 변수를 수정해주세요.")
     exit()
 
+if BIN_ENCODING not in SV_IMAGE_ENCODINGS:
+    print(f"오류: 지원하지 않는 BIN_ENCODING '{BIN_ENCODING}' ({', '.join(SV_IMAGE_ENCODINGS)})")
+    exit()
+
 try:
     with open(CSV_FILE_PATH, mode='r', encoding='utf-8') as f:
         reader = csv.DictReader(f)
@@ -91,13 +209,14 @@ try:
         f.write("#ifndef SV_DATABASE_H\n")
         f.write("#define SV_DATABASE_H\n\n")
         
+        # 검증기의 입력 차원(config.embedding_dim)과는 별개의 이름: 다르면 검증기가 로드하지 않고 오류를 출력
         f.write(f"// TFLite 모델에서 출력되는 임베딩 벡터의 차원\n")
-        f.write(f"#define SV_EMBEDDING_DIM {embedding_dim}\n\n")
+        f.write(f"#define SV_DATABASE_DIM {embedding_dim}\n\n")
         
         # 1. 모든 화자의 const float[] 배열 선언
         for speaker in speakers_data:
             f.write(f"// 화자: {speaker['name']}\n")
-            f.write(f"const float {speaker['var_name']}[SV_EMBEDDING_DIM] = {{\n    ")
+            f.write(f"const float {speaker['var_name']}[SV_DATABASE_DIM] = {{\n    ")
             
             # 8개씩 끊어서 줄바꿈
             for i, val in enumerate(speaker['embeddings']):
@@ -117,9 +236,9 @@ try:
         f.write("    int speaker_id;\n")
         f.write("    const char* name;\n")
         f.write("    const float* embedding;\n")
-        f.write("} sv_preregistered_speaker_t;\n\n")
+        f.write("} sv_registered_spk_t;\n\n")
         
-        f.write("static const sv_preregistered_speaker_t PRE_REGISTERED_SPEAKERS[] = {\n")
+        f.write("static const sv_registered_spk_t REGISTERED_SPEAKERS[] = {\n")
         
         for speaker in speakers_data:
             # {ID, "이름", C변수명}
@@ -129,11 +248,32 @@ try:
         
         # 3. 화자 수 define
         f.write(f"// enrolled spk: {len(speakers_data)}명\n")
-        f.write(f"static const int NUM_PRE_REGISTERED_SPEAKERS = {len(speakers_data)};\n\n")
+        f.write(f"static const int NUM_REGISTERED_SPEAKERS = {len(speakers_data)};\n\n")
         
         f.write("#endif // SV_DATABASE_H\n")
 
     print(f"성공: '{OUTPUT_H_FILE}' 파일이 생성되었습니다.")
 
 except Exception as e:
-    print(f"파일 쓰기 중 오류 발생: {e}")
\ No newline at end of file
+    print(f"파일 쓰기 중 오류 발생: {e}")
+
+# --- 바이너리 DB 이미지 생성 ---
+if OUTPUT_BIN_FILE:
+    try:
+        image_speakers, image_dim, normalize = speakers_data, embedding_dim, BIN_NORMALIZE
+        if PROJECTION_BIN_FILE:
+            # 이미지 행은 점수 계산 공간에 저장 (.h는 원본 임베딩, 검증기가 로드 시 투영)
+            in_dim, image_dim, mean, matrix, psi = load_projection(PROJECTION_BIN_FILE)
+            if in_dim != embedding_dim:
+                raise ValueError(f"projection 입력 차원 {in_dim} != 임베딩 차원 {embedding_dim}")
+            image_speakers = [dict(s, embeddings=project(s['embeddings'], mean, matrix, psi)) for s in speakers_data]
+            print(f"'{PROJECTION_BIN_FILE}'로 이미지 행 투영: {in_dim} -> {image_dim}")
+            if psi:
+                normalize = False  # PLDA 점수는 투영된 행을 그대로 사용 (SV_BACKEND_PLDA)
+        image = build_db_image(image_speakers, image_dim, BIN_ENCODING, normalize)
+        with open(OUTPUT_BIN_FILE, mode='wb') as f:
+            f.write(image)
+        print(f"성공: '{OUTPUT_BIN_FILE}' 파일이 생성되었습니다. ({len(image)} bytes, {BIN_ENCODING}, normalize={normalize})")
+
+    except Exception as e:
+        print(f"이미지 쓰기 중 오류 발생: {e}")